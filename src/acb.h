@@ -609,6 +609,14 @@ void acb_dot_precise(acb_t res, const acb_t initial, int subtract,
 void acb_dot(acb_t res, const acb_t initial, int subtract,
     acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec);
 
+#define ACB_DOT_BLOCK_LEN 1024
+#define ACB_DOT_BLOCK_CUTOFF 8192
+
+void _acb_dot_blocked(acb_t res, const acb_t initial, int subtract,
+    acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec);
+void acb_dot_many(acb_ptr res, acb_srcptr x, slong xstep,
+    acb_ptr const * y, slong ystep, slong num, slong len, slong prec);
+
 void acb_approx_dot(acb_t res, const acb_t initial, int subtract,
     acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec);
 
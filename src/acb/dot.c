@@ -330,6 +330,12 @@ acb_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong xstep,
         }
     }
 
+    if (len >= ACB_DOT_BLOCK_CUTOFF)
+    {
+        _acb_dot_blocked(res, initial, subtract, x, xstep, y, ystep, len, prec);
+        return;
+    }
+
     /* Number of nonzero midpoint terms in sum. */
     re_nonzero = 0;
     im_nonzero = 0;
@@ -39,6 +39,7 @@
 #include "t-div.c"
 #include "t-dot.c"
 #include "t-dot_fmpz.c"
+#include "t-dot_many.c"
 #include "t-dot_si.c"
 #include "t-dot_siui.c"
 #include "t-dot_ui.c"
@@ -118,6 +119,7 @@ test_struct tests[] =
     TEST_FUNCTION(acb_div),
     TEST_FUNCTION(acb_dot),
     TEST_FUNCTION(acb_dot_fmpz),
+    TEST_FUNCTION(acb_dot_many),
     TEST_FUNCTION(acb_dot_si),
     TEST_FUNCTION(acb_dot_siui),
     TEST_FUNCTION(acb_dot_ui),
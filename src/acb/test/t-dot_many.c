@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "acb.h"
+
+TEST_FUNCTION_START(acb_dot_many, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 300 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        acb_ptr x, y, res;
+        acb_ptr * yrows;
+        acb_t s, t;
+        slong i, j, num, len, prec, xstep, ystep;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        num = n_randint(state, 8);
+
+        if (n_randint(state, 8) == 0)
+            len = ACB_DOT_BLOCK_CUTOFF + n_randint(state, 2 * ACB_DOT_BLOCK_LEN);
+        else if (n_randint(state, 4) == 0)
+            len = n_randint(state, 3 * ACB_DOT_BLOCK_LEN);
+        else
+            len = n_randint(state, 50);
+
+        prec = 2 + n_randint(state, 300);
+        xstep = n_randint(state, 2) ? 1 : -1;
+        ystep = n_randint(state, 2) ? 1 : -1;
+
+        x = _acb_vec_init(len);
+        y = _acb_vec_init(num * len);
+        res = _acb_vec_init(num);
+        yrows = flint_malloc(sizeof(acb_ptr) * (num + 1));
+        acb_init(s);
+        acb_init(t);
+
+        for (i = 0; i < len; i++)
+            acb_randtest(x + i, state, 2 + n_randint(state, 300), 4);
+        for (i = 0; i < num * len; i++)
+            acb_randtest(y + i, state, 2 + n_randint(state, 300), 4);
+
+        for (j = 0; j < num; j++)
+            yrows[j] = y + j * len + (ystep == 1 ? 0 : FLINT_MAX(len - 1, 0));
+
+        acb_dot_many(res, x + (xstep == 1 ? 0 : FLINT_MAX(len - 1, 0)), xstep,
+            yrows, ystep, num, len, prec);
+
+        for (j = 0; j < num; j++)
+        {
+            acb_dot_simple(s, NULL, 0, x + (xstep == 1 ? 0 : FLINT_MAX(len - 1, 0)), xstep,
+                yrows[j], ystep, len, prec);
+
+            if (!acb_overlaps(res + j, s))
+            {
+                flint_printf("FAIL: acb_dot_many\n\n");
+                flint_printf("num = %wd, len = %wd, prec = %wd, j = %wd\n\n", num, len, prec, j);
+                flint_printf("res = "); acb_printd(res + j, 30); flint_printf("\n\n");
+                flint_printf("s = "); acb_printd(s, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* blocked dot product with an initial value */
+        if (len >= ACB_DOT_BLOCK_CUTOFF)
+        {
+            int subtract = n_randint(state, 2);
+
+            acb_randtest(t, state, 2 + n_randint(state, 300), 4);
+            acb_dot_simple(s, t, subtract, x, 1, y, 1, len, prec);
+            acb_dot(t, t, subtract, x, 1, y, 1, len, prec);
+
+            if (!acb_overlaps(s, t) || (!acb_is_exact(s) &&
+                    acb_rel_accuracy_bits(t) < acb_rel_accuracy_bits(s) - 10))
+            {
+                flint_printf("FAIL: blocked acb_dot\n\n");
+                flint_printf("len = %wd, prec = %wd\n\n", len, prec);
+                flint_printf("s = "); acb_printd(s, 30); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _acb_vec_clear(x, len);
+        _acb_vec_clear(y, num * len);
+        _acb_vec_clear(res, num);
+        flint_free(yrows);
+        acb_clear(s);
+        acb_clear(t);
+    }
+
+    flint_set_num_threads(1);
+
+    TEST_FUNCTION_END(state);
+}
@@ -43,6 +43,7 @@ typedef struct
     slong depth_limit;
     int use_heap;
     int verbose;
+    slong threads;
 }
 acb_calc_integrate_opt_struct;
 
@@ -63,6 +64,16 @@ acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
     const acb_t a, const acb_t b, const mag_t tol,
     slong deg_limit, int verbose, slong prec);
 
+void acb_calc_gl_node(arb_ptr x, arb_ptr w, slong i, slong k, slong prec);
+
+int _acb_calc_gl_auto_deg_choose(slong * step, slong * deg, mag_t err,
+    mag_t rho, slong * eval_count, acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b, const mag_t tol, slong deg_limit, slong prec);
+
+void _acb_calc_gl_eval(acb_t res, acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b, arb_srcptr x, arb_srcptr w, slong n,
+    const mag_t err, slong prec);
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "acb.h"
 #include "arb_calc.h"
 #include "acb_calc.h"
@@ -106,6 +107,397 @@ _acb_overlaps(acb_t tmp, const acb_t a, const acb_t b, slong prec)
     return acb_contains_zero(tmp);
 }
 
+/*
+  Parallel version: intervals are taken off the work queue in batches of
+  about one per thread. The Gauss-Legendre degree selection (and the
+  bisection of intervals where no degree works) runs in parallel; the
+  nodes needed by the batch are then fetched from the node cache by the
+  calling thread, so that all threads share a single cache, and the
+  quadrature sums are evaluated in parallel. All updates of the running
+  sum, the tolerance and the work queue are done serially in batch order,
+  so the result does not depend on thread scheduling.
+*/
+
+typedef struct
+{
+    acb_struct u, a1, b1, v1, a2, b2, v2;
+    mag_struct err, m1, m2;
+    arb_srcptr x, w;
+    slong step, deg, feval;
+    int status, real;
+}
+integrate_job_struct;
+
+typedef struct
+{
+    integrate_job_struct * jobs;
+    const slong * idx;
+    acb_srcptr as, bs, vs;
+    acb_calc_func_t f;
+    void * param;
+    mag_srcptr tol;
+    slong deg_limit;
+    slong prec;
+    int phase;
+}
+integrate_work_t;
+
+static void
+integrate_worker(slong j, void * varg)
+{
+    integrate_work_t * work = (integrate_work_t *) varg;
+    integrate_job_struct * job = work->jobs + j;
+    acb_srcptr a = work->as + work->idx[j];
+    acb_srcptr b = work->bs + work->idx[j];
+    acb_srcptr v = work->vs + work->idx[j];
+    slong prec = work->prec;
+
+    if (work->phase == 0)
+    {
+        job->real = acb_is_finite(v) && acb_is_real(v);
+        job->feval = 0;
+        job->status = ARB_CALC_NO_CONVERGENCE;
+
+        if (acb_is_finite(v) && work->deg_limit > 0)
+            job->status = _acb_calc_gl_auto_deg_choose(&job->step, &job->deg,
+                &job->err, NULL, &job->feval, work->f, work->param,
+                a, b, work->tol, work->deg_limit, prec);
+
+        if (job->status != ARB_CALC_SUCCESS)
+        {
+            /* Bisection: [a, mid] and [mid, b]. */
+            acb_set(&job->a1, a);
+            acb_add(&job->b1, a, b, prec);
+            acb_mul_2exp_si(&job->b1, &job->b1, -1);
+            acb_set(&job->a2, &job->b1);
+            acb_set(&job->b2, b);
+
+            quad_simple(&job->v1, work->f, work->param, &job->a1, &job->b1, prec);
+            mag_hypot(&job->m1, arb_radref(acb_realref(&job->v1)), arb_radref(acb_imagref(&job->v1)));
+            quad_simple(&job->v2, work->f, work->param, &job->a2, &job->b2, prec);
+            mag_hypot(&job->m2, arb_radref(acb_realref(&job->v2)), arb_radref(acb_imagref(&job->v2)));
+        }
+    }
+    else if (job->status == ARB_CALC_SUCCESS)
+    {
+        _acb_calc_gl_eval(&job->u, work->f, work->param, a, b,
+            job->x, job->w, job->deg, &job->err, prec);
+    }
+}
+
+static int
+_acb_calc_integrate_threaded(acb_t res, acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b,
+    slong goal, const mag_t tol,
+    slong depth_limit, slong eval_limit, slong deg_limit,
+    int use_heap, int verbose, slong num_threads, slong prec)
+{
+    acb_ptr as, bs, vs;
+    mag_ptr ms;
+    acb_t s, u;
+    mag_t tmpm, new_tol;
+    slong depth, depth_max, eval, top, nb, na, nn, i, j;
+    slong leaf_interval_count, alloc;
+    slong * idx, * node_step;
+    arb_ptr * node_x, * node_w;
+    slong * node_len;
+    integrate_job_struct * jobs;
+    integrate_work_t work;
+    int stopping, status;
+
+    status = ARB_CALC_SUCCESS;
+
+    acb_init(s);
+    acb_init(u);
+    mag_init(tmpm);
+    mag_init(new_tol);
+
+    idx = flint_malloc(sizeof(slong) * num_threads);
+    node_step = flint_malloc(sizeof(slong) * num_threads);
+    node_len = flint_malloc(sizeof(slong) * num_threads);
+    node_x = flint_malloc(sizeof(arb_ptr) * num_threads);
+    node_w = flint_malloc(sizeof(arb_ptr) * num_threads);
+    jobs = flint_malloc(sizeof(integrate_job_struct) * num_threads);
+
+    for (j = 0; j < num_threads; j++)
+    {
+        acb_init(&jobs[j].u);
+        acb_init(&jobs[j].a1);
+        acb_init(&jobs[j].b1);
+        acb_init(&jobs[j].v1);
+        acb_init(&jobs[j].a2);
+        acb_init(&jobs[j].b2);
+        acb_init(&jobs[j].v2);
+        mag_init(&jobs[j].err);
+        mag_init(&jobs[j].m1);
+        mag_init(&jobs[j].m2);
+    }
+
+    alloc = FLINT_MAX(4, 2 * num_threads + 2);
+    as = _acb_vec_init(alloc);
+    bs = _acb_vec_init(alloc);
+    vs = _acb_vec_init(alloc);
+    ms = _mag_vec_init(alloc);
+
+    /* Compute initial crude estimate for the whole interval. */
+    acb_set(as, a);
+    acb_set(bs, b);
+    quad_simple(vs, f, param, as, bs, prec);
+    mag_hypot(ms, arb_radref(acb_realref(vs)), arb_radref(acb_imagref(vs)));
+
+    depth = depth_max = 1;
+    eval = 1;
+    stopping = 0;
+    leaf_interval_count = 0;
+
+    /* Adjust absolute tolerance based on new information. */
+    acb_get_mag_lower(tmpm, vs);
+    mag_mul_2exp_si(tmpm, tmpm, -goal);
+    mag_max(new_tol, tol, tmpm);
+
+    acb_zero(s);
+
+    work.jobs = jobs;
+    work.idx = idx;
+    work.f = f;
+    work.param = param;
+    work.tol = new_tol;
+    work.deg_limit = deg_limit;
+    work.prec = prec;
+
+    while (depth >= 1)
+    {
+        if (stopping == 0 && eval >= eval_limit - 1)
+        {
+            if (verbose > 0)
+                flint_printf("stopping at eval_limit %wd\n", eval_limit);
+            status = ARB_CALC_NO_CONVERGENCE;
+            stopping = 1;
+        }
+
+        /* Take a batch off the queue; it ends up in [depth, depth + nb). */
+        nb = FLINT_MIN(depth, num_threads);
+
+        if (use_heap)
+        {
+            for (i = 0; i < nb; i++)
+            {
+                depth--;
+                if (depth > 0)
+                {
+                    acb_swap(as, as + depth);
+                    acb_swap(bs, bs + depth);
+                    acb_swap(vs, vs + depth);
+                    mag_swap(ms, ms + depth);
+                    heap_up(as, bs, vs, ms, depth);
+                }
+            }
+        }
+        else
+        {
+            depth -= nb;
+        }
+
+        /* Finished subintervals are summed directly. */
+        na = 0;
+        for (i = depth + nb - 1; i >= depth; i--)
+        {
+            if (mag_cmp(ms + i, new_tol) < 0 ||
+                _acb_overlaps(u, as + i, bs + i, prec) || stopping)
+            {
+                acb_add(s, s, vs + i, prec);
+                leaf_interval_count++;
+            }
+            else
+            {
+                idx[na++] = i;
+            }
+        }
+
+        if (na == 0)
+            continue;
+
+        work.as = as;
+        work.bs = bs;
+        work.vs = vs;
+
+        /* Choose Gauss-Legendre degrees, or bisect. */
+        work.phase = 0;
+        flint_parallel_do(integrate_worker, &work, na, num_threads, FLINT_PARALLEL_DYNAMIC);
+
+        /* Fetch the nodes needed by this batch from the shared cache. */
+        nn = 0;
+        for (j = 0; j < na; j++)
+        {
+            if (jobs[j].status != ARB_CALC_SUCCESS)
+                continue;
+
+            for (i = 0; i < nn; i++)
+                if (node_step[i] == jobs[j].step)
+                    break;
+
+            if (i == nn)
+            {
+                node_step[nn] = jobs[j].step;
+                node_len[nn] = (jobs[j].deg + 1) / 2;
+                node_x[nn] = _arb_vec_init(node_len[nn]);
+                node_w[nn] = _arb_vec_init(node_len[nn]);
+                acb_calc_gl_node(node_x[nn], node_w[nn], jobs[j].step, -1, prec);
+                nn++;
+            }
+
+            jobs[j].x = node_x[i];
+            jobs[j].w = node_w[i];
+        }
+
+        /* Evaluate the quadrature sums. */
+        if (nn != 0)
+        {
+            work.phase = 1;
+            flint_parallel_do(integrate_worker, &work, na, num_threads, FLINT_PARALLEL_DYNAMIC);
+        }
+
+        for (i = 0; i < nn; i++)
+        {
+            _arb_vec_clear(node_x[i], node_len[i]);
+            _arb_vec_clear(node_w[i], node_len[i]);
+        }
+
+        /* Merge the results in batch order. */
+        for (j = 0; j < na; j++)
+        {
+            integrate_job_struct * job = jobs + j;
+
+            eval += job->feval;
+
+            /* We are done with this subinterval. */
+            if (job->status == ARB_CALC_SUCCESS)
+            {
+                eval += job->deg;
+
+                /* We know that the result is real. */
+                if (job->real)
+                    arb_zero(acb_imagref(&job->u));
+
+                acb_add(s, s, &job->u, prec);
+                leaf_interval_count++;
+
+                /* Adjust absolute tolerance based on new information. */
+                acb_get_mag_lower(tmpm, &job->u);
+                mag_mul_2exp_si(tmpm, tmpm, -goal);
+                mag_max(new_tol, new_tol, tmpm);
+                continue;
+            }
+
+            eval += 2;
+
+            /* Adjust absolute tolerance based on new information. */
+            acb_get_mag_lower(tmpm, &job->v1);
+            mag_mul_2exp_si(tmpm, tmpm, -goal);
+            mag_max(new_tol, new_tol, tmpm);
+            acb_get_mag_lower(tmpm, &job->v2);
+            mag_mul_2exp_si(tmpm, tmpm, -goal);
+            mag_max(new_tol, new_tol, tmpm);
+
+            /* The children are still valid enclosures; they will be
+               summed as leaves once we are stopping. */
+            if (stopping == 0 && depth >= depth_limit - 1)
+            {
+                if (verbose > 0)
+                    flint_printf("stopping at depth_limit %wd\n", depth_limit);
+                status = ARB_CALC_NO_CONVERGENCE;
+                stopping = 1;
+            }
+
+            if (depth + 2 > alloc)
+            {
+                slong k;
+                as = flint_realloc(as, 2 * alloc * sizeof(acb_struct));
+                bs = flint_realloc(bs, 2 * alloc * sizeof(acb_struct));
+                vs = flint_realloc(vs, 2 * alloc * sizeof(acb_struct));
+                ms = flint_realloc(ms, 2 * alloc * sizeof(mag_struct));
+                for (k = alloc; k < 2 * alloc; k++)
+                {
+                    acb_init(as + k);
+                    acb_init(bs + k);
+                    acb_init(vs + k);
+                    mag_init(ms + k);
+                }
+                alloc *= 2;
+            }
+
+            /* Make the interval with the larger error the priority. */
+            if (mag_cmp(&job->m1, &job->m2) < 0)
+            {
+                acb_swap(&job->a1, &job->a2);
+                acb_swap(&job->b1, &job->b2);
+                acb_swap(&job->v1, &job->v2);
+                mag_swap(&job->m1, &job->m2);
+            }
+
+            top = depth;
+            acb_swap(as + top, &job->a2);
+            acb_swap(bs + top, &job->b2);
+            acb_swap(vs + top, &job->v2);
+            mag_swap(ms + top, &job->m2);
+            depth++;
+            if (use_heap)
+                heap_down(as, bs, vs, ms, depth);
+
+            top = depth;
+            acb_swap(as + top, &job->a1);
+            acb_swap(bs + top, &job->b1);
+            acb_swap(vs + top, &job->v1);
+            mag_swap(ms + top, &job->m1);
+            depth++;
+            if (use_heap)
+                heap_down(as, bs, vs, ms, depth);
+
+            depth_max = FLINT_MAX(depth, depth_max);
+        }
+    }
+
+    if (verbose > 0)
+    {
+        flint_printf("depth %wd/%wd, eval %wd/%wd, %wd leaf intervals\n",
+            depth_max, depth_limit, eval, eval_limit, leaf_interval_count);
+    }
+
+    acb_set(res, s);
+
+    for (j = 0; j < num_threads; j++)
+    {
+        acb_clear(&jobs[j].u);
+        acb_clear(&jobs[j].a1);
+        acb_clear(&jobs[j].b1);
+        acb_clear(&jobs[j].v1);
+        acb_clear(&jobs[j].a2);
+        acb_clear(&jobs[j].b2);
+        acb_clear(&jobs[j].v2);
+        mag_clear(&jobs[j].err);
+        mag_clear(&jobs[j].m1);
+        mag_clear(&jobs[j].m2);
+    }
+
+    flint_free(jobs);
+    flint_free(idx);
+    flint_free(node_step);
+    flint_free(node_len);
+    flint_free(node_x);
+    flint_free(node_w);
+
+    _acb_vec_clear(as, alloc);
+    _acb_vec_clear(bs, alloc);
+    _acb_vec_clear(vs, alloc);
+    _mag_vec_clear(ms, alloc);
+    acb_clear(s);
+    acb_clear(u);
+    mag_clear(tmpm);
+    mag_clear(new_tol);
+
+    return status;
+}
+
 int
 acb_calc_integrate(acb_t res, acb_calc_func_t f, void * param,
     const acb_t a, const acb_t b,
@@ -119,7 +511,7 @@ acb_calc_integrate(acb_t res, acb_calc_func_t f, void * param,
     mag_t tmpm, tmpn, new_tol;
     slong depth_limit, eval_limit, deg_limit;
     slong depth, depth_max, eval, feval, top;
-    slong leaf_interval_count;
+    slong leaf_interval_count, num_threads;
     slong alloc;
     int stopping, real_error, use_heap, status, gl_status, verbose;
 
@@ -130,15 +522,6 @@ acb_calc_integrate(acb_t res, acb_calc_func_t f, void * param,
         return acb_calc_integrate(res, f, param, a, b, goal, tol, opt, prec);
     }
 
-    status = ARB_CALC_SUCCESS;
-
-    acb_init(s);
-    acb_init(t);
-    acb_init(u);
-    mag_init(tmpm);
-    mag_init(tmpn);
-    mag_init(new_tol);
-
     depth_limit = options->depth_limit;
     if (depth_limit <= 0)
         depth_limit = 2 * prec;
@@ -157,6 +540,21 @@ acb_calc_integrate(acb_t res, acb_calc_func_t f, void * param,
     verbose = options->verbose;
     use_heap = options->use_heap;
 
+    num_threads = FLINT_MIN(options->threads, flint_get_num_threads());
+    if (num_threads >= 2)
+        return _acb_calc_integrate_threaded(res, f, param, a, b, goal, tol,
+            depth_limit, eval_limit, deg_limit, use_heap, verbose,
+            num_threads, prec);
+
+    status = ARB_CALC_SUCCESS;
+
+    acb_init(s);
+    acb_init(t);
+    acb_init(u);
+    mag_init(tmpm);
+    mag_init(tmpn);
+    mag_init(new_tol);
+
     alloc = 4;
     as = _acb_vec_init(alloc);
     bs = _acb_vec_init(alloc);
@@ -197,31 +197,26 @@ gl_worker(slong k, gl_work_t * args)
 }
 
 int
-acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
-    acb_calc_func_t f, void * param,
-    const acb_t a, const acb_t b, const mag_t tol,
-    slong deg_limit, int verbose, slong prec)
+_acb_calc_gl_auto_deg_choose(slong * step, slong * deg, mag_t err,
+    mag_t best_rho, slong * eval_count, acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b, const mag_t tol, slong deg_limit, slong prec)
 {
-    acb_t mid, delta, wide;
-    mag_t tmpm;
-    slong status;
-    acb_t s, v;
-    mag_t M, X, Y, rho, err, t, best_rho;
-    slong k, Xexp;
-    slong i, n, best_n;
+    acb_t mid, delta, wide, v;
+    mag_t M, X, Y, rho, t, tmpm;
+    slong i, n, Xexp;
+    int status;
 
     status = ARB_CALC_NO_CONVERGENCE;
 
-    if (deg_limit <= 0)
-    {
-        acb_indeterminate(res);
-        eval_count[0] = 0;
-        return status;
-    }
-
     acb_init(mid);
     acb_init(delta);
     acb_init(wide);
+    acb_init(v);
+    mag_init(M);
+    mag_init(X);
+    mag_init(Y);
+    mag_init(rho);
+    mag_init(t);
     mag_init(tmpm);
 
     /* delta = (b-a)/2 */
@@ -232,17 +227,8 @@ acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
     acb_add(mid, a, b, prec);
     acb_mul_2exp_si(mid, mid, -1);
 
-    acb_init(s);
-    acb_init(v);
-    mag_init(M);
-    mag_init(X);
-    mag_init(Y);
-    mag_init(rho);
-    mag_init(t);
-    mag_init(err);
-    mag_init(best_rho);
-
-    best_n = -1;
+    step[0] = -1;
+    deg[0] = -1;
     eval_count[0] = 0;
 
     mag_inf(err);
@@ -304,11 +290,13 @@ acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
                 status = ARB_CALC_SUCCESS;
 
                 /* The best so far. */
-                if (best_n == -1 || n < best_n)
+                if (deg[0] == -1 || n < deg[0])
                 {
                     mag_set(err, t);
-                    mag_set(best_rho, rho);
-                    best_n = n;
+                    if (best_rho != NULL)
+                        mag_set(best_rho, rho);
+                    step[0] = i;
+                    deg[0] = n;
                 }
 
                 /* Best possible n. */
@@ -318,6 +306,103 @@ acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
         }
     }
 
+    acb_clear(mid);
+    acb_clear(delta);
+    acb_clear(wide);
+    acb_clear(v);
+    mag_clear(M);
+    mag_clear(X);
+    mag_clear(Y);
+    mag_clear(rho);
+    mag_clear(t);
+    mag_clear(tmpm);
+
+    return status;
+}
+
+void
+_acb_calc_gl_eval(acb_t res, acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b, arb_srcptr x, arb_srcptr w, slong n,
+    const mag_t err, slong prec)
+{
+    acb_t mid, delta, t, v, s;
+    slong k, k2;
+
+    acb_init(mid);
+    acb_init(delta);
+    acb_init(t);
+    acb_init(v);
+    acb_init(s);
+
+    acb_sub(delta, b, a, prec);
+    acb_mul_2exp_si(delta, delta, -1);
+    acb_add(mid, a, b, prec);
+    acb_mul_2exp_si(mid, mid, -1);
+
+    for (k = 0; k < n; k++)
+    {
+        k2 = (2 * k < n) ? k : n - 1 - k;
+
+        acb_mul_arb(t, delta, x + k2, prec);
+        if (k2 != k)
+            acb_neg(t, t);
+        acb_add(t, t, mid, prec);
+        f(v, t, param, 0, prec);
+        acb_addmul_arb(s, v, w + k2, prec);
+    }
+
+    acb_mul(res, s, delta, prec);
+    acb_add_error_mag(res, err);
+
+    acb_clear(mid);
+    acb_clear(delta);
+    acb_clear(t);
+    acb_clear(v);
+    acb_clear(s);
+}
+
+int
+acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
+    acb_calc_func_t f, void * param,
+    const acb_t a, const acb_t b, const mag_t tol,
+    slong deg_limit, int verbose, slong prec)
+{
+    acb_t mid, delta, wide;
+    mag_t tmpm;
+    slong status;
+    acb_t s, v;
+    mag_t err, best_rho;
+    slong k;
+    slong i, best_n;
+
+    if (deg_limit <= 0)
+    {
+        acb_indeterminate(res);
+        eval_count[0] = 0;
+        return ARB_CALC_NO_CONVERGENCE;
+    }
+
+    acb_init(mid);
+    acb_init(delta);
+    acb_init(wide);
+    mag_init(tmpm);
+
+    /* delta = (b-a)/2 */
+    acb_sub(delta, b, a, prec);
+    acb_mul_2exp_si(delta, delta, -1);
+
+    /* mid = (a+b)/2 */
+    acb_add(mid, a, b, prec);
+    acb_mul_2exp_si(mid, mid, -1);
+
+    acb_init(s);
+    acb_init(v);
+    mag_init(err);
+    mag_init(best_rho);
+
+    status = _acb_calc_gl_auto_deg_choose(&i, &best_n, err, best_rho,
+        eval_count, f, param, a, b, tol, deg_limit, prec);
+
     /* Evaluate best found Gauss-Legendre quadrature rule. */
     if (status == ARB_CALC_SUCCESS)
     {
@@ -341,10 +426,6 @@ acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
         if (best_n == -1)
             flint_throw(FLINT_ERROR, "(%s)\n", __func__);
 
-        for (i = 0; i < GL_STEPS; i++)
-            if (gl_steps[i] == best_n)
-                break;
-
         nt = flint_get_num_threads();
 
         if (nt >= 2 && best_n >= 2)
@@ -408,11 +489,6 @@ acb_calc_integrate_gl_auto_deg(acb_t res, slong * eval_count,
 
     acb_clear(s);
     acb_clear(v);
-    mag_clear(M);
-    mag_clear(X);
-    mag_clear(Y);
-    mag_clear(rho);
-    mag_clear(t);
     mag_clear(err);
     mag_clear(best_rho);
 
@@ -19,5 +19,6 @@ acb_calc_integrate_opt_init(acb_calc_integrate_opt_t options)
     options->depth_limit = 0;
     options->use_heap = 0;
     options->verbose = 0;
+    options->threads = 0;
 }
 
@@ -16,6 +16,7 @@
 
 #include "t-cauchy_bound.c"
 #include "t-integrate.c"
+#include "t-integrate_threaded.c"
 #include "t-integrate_taylor.c"
 
 /* Array of test functions ***************************************************/
@@ -24,6 +25,7 @@ test_struct tests[] =
 {
     TEST_FUNCTION(acb_calc_cauchy_bound),
     TEST_FUNCTION(acb_calc_integrate),
+    TEST_FUNCTION(acb_calc_integrate_threaded),
     TEST_FUNCTION(acb_calc_integrate_taylor)
 };
 
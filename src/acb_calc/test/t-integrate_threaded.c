@@ -0,0 +1,135 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "acb.h"
+#include "arb_calc.h"
+#include "acb_calc.h"
+
+static int
+_f_threaded(acb_ptr res, const acb_t z, void * param, slong order, slong prec)
+{
+    slong which = *((slong *) param);
+
+    if (order > 1)
+        flint_abort();  /* Would be needed for Taylor method. */
+
+    switch (which)
+    {
+        case 0:
+            acb_sin(res, z, prec);
+            break;
+        case 1:
+            /* sqrt(z), with a branch point at the endpoint */
+            acb_sqrt_analytic(res, z, order != 0, prec);
+            break;
+        case 2:
+            /* 1/(1+z^2), poles near the path */
+            acb_mul(res, z, z, prec);
+            acb_add_ui(res, res, 1, prec);
+            acb_inv(res, res, prec);
+            break;
+        case 3:
+            /* exp(-z^2) sin(8z) */
+            {
+                acb_t t;
+                acb_init(t);
+                acb_mul(t, z, z, prec);
+                acb_neg(t, t);
+                acb_exp(t, t, prec);
+                acb_mul_2exp_si(res, z, 3);
+                acb_sin(res, res, prec);
+                acb_mul(res, res, t, prec);
+                acb_clear(t);
+            }
+            break;
+        default:
+            /* |z|, not holomorphic: forces bisection down to small pieces */
+            acb_real_abs(res, z, order != 0, prec);
+            break;
+    }
+
+    return 0;
+}
+
+TEST_FUNCTION_START(acb_calc_integrate_threaded, state)
+{
+    slong iter, max_threads = 5;
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        acb_calc_integrate_opt_t opt;
+        acb_t a, b, r1, r2;
+        mag_t tol;
+        slong which, prec, goal;
+        int status1, status2;
+
+        acb_init(a);
+        acb_init(b);
+        acb_init(r1);
+        acb_init(r2);
+        mag_init(tol);
+
+        acb_calc_integrate_opt_init(opt);
+        opt->use_heap = n_randint(state, 2);
+
+        which = n_randint(state, 5);
+        prec = 32 + n_randint(state, 150);
+        goal = 10 + n_randint(state, prec - 10);
+        mag_set_ui_2exp_si(tol, 1, -goal);
+
+        if (which == 4)
+        {
+            acb_set_si(a, -1 - (slong) n_randint(state, 3));
+            acb_set_si(b, 1 + n_randint(state, 3));
+        }
+        else
+        {
+            acb_set_si(a, n_randint(state, 3) - (which == 1 ? 0 : 2));
+            acb_set_ui(b, 3 + n_randint(state, 5));
+            if (n_randint(state, 2))
+                acb_swap(a, b);
+        }
+
+        flint_set_num_threads(1);
+        status1 = acb_calc_integrate(r1, _f_threaded, &which, a, b, goal, tol, opt, prec);
+
+        flint_set_num_threads(2 + n_randint(state, max_threads - 1));
+        opt->threads = 2 + n_randint(state, max_threads - 1);
+        status2 = acb_calc_integrate(r2, _f_threaded, &which, a, b, goal, tol, opt, prec);
+        opt->threads = 0;
+
+        flint_set_num_threads(1);
+
+        if (!acb_overlaps(r1, r2) ||
+            (status1 == ARB_CALC_SUCCESS && status2 != ARB_CALC_SUCCESS) ||
+            (status2 == ARB_CALC_SUCCESS &&
+                acb_rel_accuracy_bits(r2) < FLINT_MIN(acb_rel_accuracy_bits(r1), goal) - 10))
+        {
+            flint_printf("FAIL!\n");
+            flint_printf("which = %wd, prec = %wd, goal = %wd, heap = %d\n\n",
+                which, prec, goal, opt->use_heap);
+            flint_printf("a = "); acb_printd(a, 20); flint_printf("\n\n");
+            flint_printf("b = "); acb_printd(b, 20); flint_printf("\n\n");
+            flint_printf("r1 = "); acb_printd(r1, 20); flint_printf(" (%d)\n\n", status1);
+            flint_printf("r2 = "); acb_printd(r2, 20); flint_printf(" (%d)\n\n", status2);
+            flint_abort();
+        }
+
+        acb_clear(a);
+        acb_clear(b);
+        acb_clear(r1);
+        acb_clear(r2);
+        mag_clear(tol);
+    }
+
+    TEST_FUNCTION_END(state);
+}
@@ -33,6 +33,7 @@ void acb_dft_rad2_inplace(acb_ptr v, int e, slong prec);
 void acb_dft_rad2(acb_ptr w, acb_srcptr v, int e, slong prec);
 void acb_dft_bluestein(acb_ptr w, acb_srcptr v, slong len, slong prec);
 void acb_dft_prod(acb_ptr w, acb_srcptr v, slong * cyc, slong num, slong prec);
+void acb_dft_sixstep(acb_ptr w, acb_srcptr v, slong len, slong prec);
 
 void acb_dft_rad2_inplace_threaded(acb_ptr v, int e, slong prec);
 
@@ -133,6 +134,20 @@ acb_dft_naive_struct;
 
 typedef acb_dft_naive_struct acb_dft_naive_t[1];
 
+typedef struct
+{
+    slong n;
+    slong dv;
+    int zclear;
+    acb_ptr z; /* z[k dz] = e(-k/n) */
+    slong dz;
+    /* n = m M: cyc[0] has the DFT of length m, cyc[1] that of length M */
+    acb_dft_step_ptr cyc;
+}
+acb_dft_sixstep_struct;
+
+typedef acb_dft_sixstep_struct acb_dft_sixstep_t[1];
+
 typedef struct
 {
     slong n;
@@ -145,6 +160,7 @@ typedef struct
         acb_dft_crt_t crt;
         acb_dft_naive_t naive;
         acb_dft_bluestein_t bluestein;
+        acb_dft_sixstep_t sixstep;
     } t;
 }
 acb_dft_pre_struct;
@@ -173,9 +189,12 @@ acb_dft_step_struct
 
 #define DFT_VERB 0
 
+/* composite lengths from which the six-step scheme is used by default */
+#define ACB_DFT_SIXSTEP_CUTOFF 10000
+
 enum
 {
-    DFT_NAIVE, DFT_CYC, DFT_PROD, DFT_CRT , DFT_RAD2 , DFT_CONV
+    DFT_NAIVE, DFT_CYC, DFT_PROD, DFT_CRT , DFT_RAD2 , DFT_CONV, DFT_SIXSTEP
 };
 
 void acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong prec);
@@ -190,6 +209,8 @@ void acb_dft_rad2_precomp(acb_ptr w, acb_srcptr v, const acb_dft_rad2_t rad2, sl
 void acb_dft_crt_precomp(acb_ptr w, acb_srcptr v, const acb_dft_crt_t crt, slong prec);
 void acb_dft_prod_precomp(acb_ptr w, acb_srcptr v, const acb_dft_prod_t prod, slong prec);
 void acb_dft_bluestein_precomp(acb_ptr w, acb_srcptr v, const acb_dft_bluestein_t t, slong prec);
+void acb_dft_sixstep_precomp(acb_ptr w, acb_srcptr v, const acb_dft_sixstep_t t, slong prec);
+void acb_dft_sixstep_precomp_inplace(acb_ptr v, const acb_dft_sixstep_t t, slong prec);
 
 void acb_dft_rad2_precomp_inplace_threaded(acb_ptr v, const acb_dft_rad2_t rad2, slong prec);
 
@@ -204,6 +225,9 @@ void acb_dft_precomp_clear(acb_dft_pre_t pre);
 void acb_dft(acb_ptr w, acb_srcptr v, slong len, slong prec);
 void acb_dft_inverse(acb_ptr w, acb_srcptr v, slong len, slong prec);
 
+void acb_dft_precomp_many(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, slong prec);
+void acb_dft_many(acb_ptr w, acb_srcptr v, slong num, slong len, slong prec);
+
 acb_dft_step_ptr _acb_dft_steps_prod(slong * m, slong num, slong prec);
 
 ACB_DFT_INLINE void
@@ -278,6 +302,17 @@ void _acb_dft_crt_init(acb_dft_crt_t crt, slong dv, slong len, slong prec);
 void acb_dft_crt_init(acb_dft_crt_t crt, slong len, slong prec);
 void acb_dft_crt_clear(acb_dft_crt_t crt);
 
+slong _acb_dft_sixstep_split(slong len);
+void _acb_dft_sixstep_init(acb_dft_sixstep_t t, slong dv, acb_ptr z, slong dz, slong len, slong prec);
+
+ACB_DFT_INLINE void
+acb_dft_sixstep_init(acb_dft_sixstep_t t, slong len, slong prec)
+{
+    _acb_dft_sixstep_init(t, 1, NULL, 0, len, prec);
+}
+
+void acb_dft_sixstep_clear(acb_dft_sixstep_t t);
+
 /* utils, could be moved elsewhere */
 
 ACB_DFT_INLINE void
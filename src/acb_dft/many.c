@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "acb_dft.h"
+
+typedef struct
+{
+    acb_ptr w;
+    acb_srcptr v;
+    const acb_dft_pre_struct * pre;
+    slong prec;
+}
+many_work_t;
+
+static void
+many_worker(slong i, void * varg)
+{
+    many_work_t * work = (many_work_t *) varg;
+    slong n = work->pre->n;
+    acb_dft_precomp(work->w + i * n, work->v + i * n, work->pre, work->prec);
+}
+
+void
+acb_dft_precomp_many(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, slong prec)
+{
+    many_work_t work;
+
+    work.w = w;
+    work.v = v;
+    work.pre = pre;
+    work.prec = prec;
+
+    /* the plan is only read, so transforms can share it */
+    flint_parallel_do(many_worker, &work, num, -1, FLINT_PARALLEL_DYNAMIC);
+}
+
+void
+acb_dft_many(acb_ptr w, acb_srcptr v, slong num, slong len, slong prec)
+{
+    acb_dft_pre_t t;
+    acb_dft_precomp_init(t, len, prec);
+    acb_dft_precomp_many(w, v, num, t, prec);
+    acb_dft_precomp_clear(t);
+}
@@ -42,7 +42,15 @@ _acb_dft_precomp_init(acb_dft_pre_t pre, slong dv, acb_ptr z, slong dz, slong le
         n_factor_init(&fac);
         n_factor(&fac, len, 1);
 
-        if (fac.num == 1)
+        /* six-step only when len = m M splits nontrivially, otherwise
+           the factor of length M = len would select it again */
+        if (len >= ACB_DFT_SIXSTEP_CUTOFF && !(fac.num == 1 && fac.p[0] == 2)
+            && _acb_dft_sixstep_split(len) > 1)
+        {
+            pre->type = DFT_SIXSTEP;
+            _acb_dft_sixstep_init(pre->t.sixstep, dv, z, dz, len, prec);
+        }
+        else if (fac.num == 1)
         {
             /* TODO: could be p^e, or 2^e, but with dv shift */
             if (fac.p[0] == 2)
@@ -93,6 +101,9 @@ acb_dft_precomp_clear(acb_dft_pre_t pre)
         case DFT_CONV:
             acb_dft_bluestein_clear(pre->t.bluestein);
             break;
+        case DFT_SIXSTEP:
+            acb_dft_sixstep_clear(pre->t.sixstep);
+            break;
         default:
             flint_throw(FLINT_ERROR, "acb_dft_clear: unknown strategy code %i\n", pre->type);
     }
@@ -121,6 +132,9 @@ acb_dft_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec)
         case DFT_CONV:
             acb_dft_bluestein_precomp(w, v, pre->t.bluestein, prec);
             break;
+        case DFT_SIXSTEP:
+            acb_dft_sixstep_precomp(w, v, pre->t.sixstep, prec);
+            break;
         default:
             flint_throw(FLINT_ERROR, "acb_dft_precomp: unknown strategy code %i\n", pre->type);
     }
@@ -0,0 +1,226 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "thread_support.h"
+#include "acb_dft.h"
+
+/*
+  Six-step DFT of length n = m M with m <= M close to sqrt(n).
+  Writing j = j1 + m j2 and k = k2 + M k1, one has
+
+    w[k2 + M k1] = sum_j1 e(-j1 k1/m) e(-j1 k2/n) sum_j2 v[j1 + m j2] e(-j2 k2/M)
+
+  so the transform is done by m contiguous DFTs of length M followed by
+  twiddles and M contiguous DFTs of length m. The three transpositions
+  between these steps only move acb_struct headers, not limb data.
+  All sub-transforms and twiddles use the roots of order n in z.
+*/
+
+#define TRANSPOSE_BLOCK 16
+
+/* shallow transpose: dst[j * rows + i] = src[i * cols + j] */
+static void
+_acb_struct_transpose(acb_ptr dst, acb_srcptr src, slong rows, slong cols)
+{
+    slong i, j, ii, jj, iend, jend;
+
+    for (ii = 0; ii < rows; ii += TRANSPOSE_BLOCK)
+    {
+        iend = FLINT_MIN(ii + TRANSPOSE_BLOCK, rows);
+
+        for (jj = 0; jj < cols; jj += TRANSPOSE_BLOCK)
+        {
+            jend = FLINT_MIN(jj + TRANSPOSE_BLOCK, cols);
+
+            for (i = ii; i < iend; i++)
+                for (j = jj; j < jend; j++)
+                    dst[j * rows + i] = src[i * cols + j];
+        }
+    }
+}
+
+slong
+_acb_dft_sixstep_split(slong len)
+{
+    slong m;
+
+    for (m = n_sqrt(len); m > 1; m--)
+        if (len % m == 0)
+            break;
+
+    return FLINT_MAX(m, 1);
+}
+
+void
+_acb_dft_sixstep_init(acb_dft_sixstep_t t, slong dv, acb_ptr z, slong dz, slong len, slong prec)
+{
+    slong m, M;
+
+    t->n = len;
+    t->dv = dv;
+
+    if (len <= 1)
+    {
+        t->zclear = 0;
+        t->z = NULL;
+        t->dz = 0;
+        t->cyc = NULL;
+        return;
+    }
+
+    if (z == NULL)
+    {
+        z = _acb_vec_init(len);
+        _acb_vec_unit_roots(z, -len, len, prec);
+        dz = 1;
+        t->zclear = 1;
+    }
+    else
+    {
+        t->zclear = 0;
+    }
+
+    t->z = z;
+    t->dz = dz;
+
+    m = _acb_dft_sixstep_split(len);
+    M = len / m;
+
+    t->cyc = flint_malloc(2 * sizeof(acb_dft_step_struct));
+
+    /* outer transforms of length m */
+    t->cyc[0].m = m;
+    t->cyc[0].M = M;
+    t->cyc[0].dv = 1;
+    t->cyc[0].z = z;
+    t->cyc[0].dz = dz;
+    _acb_dft_precomp_init(t->cyc[0].pre, 1, z, dz * M, m, prec);
+
+    /* inner transforms of length M */
+    t->cyc[1].m = M;
+    t->cyc[1].M = m;
+    t->cyc[1].dv = 1;
+    t->cyc[1].z = z;
+    t->cyc[1].dz = dz * m;
+    _acb_dft_precomp_init(t->cyc[1].pre, 1, z, dz * m, M, prec);
+}
+
+void
+acb_dft_sixstep_clear(acb_dft_sixstep_t t)
+{
+    if (t->n <= 1)
+        return;
+
+    acb_dft_precomp_clear(t->cyc[0].pre);
+    acb_dft_precomp_clear(t->cyc[1].pre);
+    flint_free(t->cyc);
+
+    if (t->zclear)
+        _acb_vec_clear(t->z, t->n);
+}
+
+typedef struct
+{
+    acb_ptr v;
+    const acb_dft_sixstep_struct * t;
+    int twiddle;
+    slong prec;
+}
+sixstep_work_t;
+
+/* in-place DFT on row i, then multiply by e(-i k/n) if asked */
+static void
+sixstep_row_worker(slong i, void * varg)
+{
+    sixstep_work_t * work = (sixstep_work_t *) varg;
+    const acb_dft_step_struct * c = work->t->cyc + (work->twiddle ? 1 : 0);
+    slong len = c->m, n = work->t->n, dz = work->t->dz;
+    acb_ptr row = work->v + i * len;
+    acb_ptr tmp;
+    slong k, e;
+
+    tmp = _acb_vec_init(len);
+    acb_dft_precomp(tmp, row, c->pre, work->prec);
+    _acb_vec_swap(row, tmp, len);
+    _acb_vec_clear(tmp, len);
+
+    if (work->twiddle && i != 0)
+    {
+        for (k = 1, e = i; k < len; k++)
+        {
+            acb_mul(row + k, row + k, work->t->z + e * dz, work->prec);
+            e += i;
+            if (e >= n)
+                e -= n;
+        }
+    }
+}
+
+void
+acb_dft_sixstep_precomp_inplace(acb_ptr v, const acb_dft_sixstep_t t, slong prec)
+{
+    sixstep_work_t work;
+    acb_ptr tmp;
+    slong m, M;
+
+    if (t->n <= 1)
+        return;
+
+    m = t->cyc[0].m;
+    M = t->cyc[1].m;
+
+    tmp = flint_malloc(t->n * sizeof(acb_struct));
+
+    work.t = t;
+    work.prec = prec;
+
+    /* m rows of length M, v[j1 + m j2] -> tmp[j1 M + j2] */
+    _acb_struct_transpose(tmp, v, M, m);
+
+    work.v = tmp;
+    work.twiddle = 1;
+    flint_parallel_do(sixstep_row_worker, &work, m, -1, FLINT_PARALLEL_UNIFORM);
+
+    /* M rows of length m */
+    _acb_struct_transpose(v, tmp, m, M);
+
+    work.v = v;
+    work.twiddle = 0;
+    flint_parallel_do(sixstep_row_worker, &work, M, -1, FLINT_PARALLEL_UNIFORM);
+
+    /* w[k2 + M k1] */
+    _acb_struct_transpose(tmp, v, M, m);
+    memcpy(v, tmp, t->n * sizeof(acb_struct));
+
+    flint_free(tmp);
+}
+
+void
+acb_dft_sixstep_precomp(acb_ptr w, acb_srcptr v, const acb_dft_sixstep_t t, slong prec)
+{
+    slong k;
+
+    if (w != v)
+        for (k = 0; k < t->n; k++)
+            acb_set(w + k, v + k * t->dv);
+
+    acb_dft_sixstep_precomp_inplace(w, t, prec);
+}
+
+void
+acb_dft_sixstep(acb_ptr w, acb_srcptr v, slong len, slong prec)
+{
+    acb_dft_sixstep_t t;
+    acb_dft_sixstep_init(t, len, prec);
+    acb_dft_sixstep_precomp(w, v, t, prec);
+    acb_dft_sixstep_clear(t);
+}
@@ -65,9 +65,9 @@ TEST_FUNCTION_START(acb_dft, state)
     ulong q[19] = { 0, 1, 2, 3, 4, 5, 6, 23, 10, 15, 16, 30, 59, 125, 308, 335, 525, 961, 1225};
     slong nr = 5;
 
-    slong f, nf = 5;
-    do_f func[5] = { acb_dft_naive, acb_dft_cyc, acb_dft_crt, acb_dft_bluestein, acb_dft };
-    char * name[5] = { "naive", "cyc", "crt", "bluestein", "default" };
+    slong f, nf = 6;
+    do_f func[6] = { acb_dft_naive, acb_dft_cyc, acb_dft_crt, acb_dft_bluestein, acb_dft_sixstep, acb_dft };
+    char * name[6] = { "naive", "cyc", "crt", "bluestein", "sixstep", "default" };
 
     /* cyclic dft */
     for (k = 0; k < nq + nr; k++)
@@ -174,6 +174,84 @@ TEST_FUNCTION_START(acb_dft, state)
 
     }
 
+    /* multi-threaded six-step and batched dft */
+    for (k = 0; k < 6; k++)
+    {
+        slong n, num, j;
+        acb_dft_pre_t pre;
+        acb_ptr v, w1, w2;
+
+        if (k == 0)
+            n = 10010;
+        else
+            n = 2 + n_randint(state, 2000);
+
+        num = (k == 0) ? 1 : 1 + n_randint(state, 5);
+
+        v = _acb_vec_init(n * num);
+        w1 = _acb_vec_init(n * num);
+        w2 = _acb_vec_init(n * num);
+
+        flint_set_num_threads(k % 4 + 1);
+
+        for (j = 0; j < n * num; j++)
+            acb_set_si_si(v + j, j, 3 - j);
+
+        for (j = 0; j < num; j++)
+            acb_dft_crt(w1 + j * n, v + j * n, n, prec);
+
+        if (k % 2)
+        {
+            acb_dft_precomp_init(pre, n, prec);
+            acb_dft_precomp_many(w2, v, num, pre, prec);
+            acb_dft_precomp_clear(pre);
+        }
+        else
+        {
+            for (j = 0; j < num; j++)
+                acb_dft_sixstep(w2 + j * n, v + j * n, n, prec);
+        }
+
+        check_vec_eq_prec(w1, w2, n * num, prec, digits, n, "sixstep/many ", "crt", "sixstep/many");
+
+        _acb_vec_clear(v, n * num);
+        _acb_vec_clear(w1, n * num);
+        _acb_vec_clear(w2, n * num);
+    }
+
+    /* lengths above the six-step cutoff which do not split */
+    for (k = 0; k < 2; k++)
+    {
+        slong n = (k == 0) ? 10007 : 2 * 10007, j;
+        acb_ptr v, w1, w2;
+
+        v = _acb_vec_init(n);
+        w1 = _acb_vec_init(n);
+        w2 = _acb_vec_init(n);
+
+        flint_set_num_threads(k + 1);
+
+        for (j = 0; j < n; j++)
+            acb_set_si_si(v + j, j, 1 - j);
+
+        if (k == 0)
+            acb_dft_bluestein(w1, v, n, prec);
+        else
+            acb_dft_crt(w1, v, n, prec);
+
+        acb_dft(w2, v, n, prec);
+        check_vec_eq_prec(w1, w2, n, prec, digits, n, "prime length ", "bluestein/crt", "dft");
+
+        acb_dft_sixstep(w2, v, n, prec);
+        check_vec_eq_prec(w1, w2, n, prec, digits, n, "prime length ", "bluestein/crt", "sixstep");
+
+        _acb_vec_clear(v, n);
+        _acb_vec_clear(w1, n);
+        _acb_vec_clear(w2, n);
+    }
+
+    flint_set_num_threads(1);
+
     TEST_FUNCTION_END(state);
 }
 #undef do_f
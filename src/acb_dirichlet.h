@@ -310,6 +310,8 @@ slong acb_dirichlet_platt_local_hardy_z_zeros(
     arb_ptr res, const fmpz_t n, slong len, slong prec);
 slong acb_dirichlet_platt_hardy_z_zeros(
     arb_ptr res, const fmpz_t n, slong len, slong prec);
+slong acb_dirichlet_platt_hardy_z_zeros_checkpoint(arb_ptr res,
+    const fmpz_t n, slong len, const char * filename, slong prec);
 
 /* Discrete Fourier Transform */
 
@@ -9,8 +9,153 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include <stdio.h>
+#include <string.h>
+#include "thread_support.h"
 #include "acb_dirichlet.h"
 
+/* do not split a range into windows asking for fewer zeros than this */
+#define PLATT_MIN_BLOCK 16
+
+/*
+  The zeros with indices n + [start, start + count) are requested from
+  acb_dirichlet_platt_local_hardy_z_zeros, which may return fewer. Pending
+  ranges are processed in rounds, each round computing disjoint height
+  windows in parallel; whatever a window did not reach is pending for the
+  next round. A window returning no zeros truncates the computation there,
+  as in the serial loop.
+*/
+
+typedef struct
+{
+    arb_ptr res;
+    const fmpz * n;
+    slong * start;
+    slong * count;
+    slong * found;
+    slong prec;
+}
+platt_block_work_t;
+
+static void
+platt_block_worker(slong j, void * varg)
+{
+    platt_block_work_t * work = (platt_block_work_t *) varg;
+    fmpz_t k;
+    fmpz_init(k);
+    fmpz_add_si(k, work->n, work->start[j]);
+    work->found[j] = acb_dirichlet_platt_local_hardy_z_zeros(
+        work->res + work->start[j], k, work->count[j], work->prec);
+    fmpz_clear(k);
+}
+
+static int
+_platt_write_zeros(FILE * out, arb_srcptr res, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+    {
+        if (arb_dump_file(out, res + i) != 0 || fputc('\n', out) == EOF)
+            return 0;
+    }
+
+    return fflush(out) == 0;
+}
+
+/* Computes res[done, len), assuming res[0, done) is known. If out is not
+   NULL, zeros are appended to it as soon as they extend the known prefix. */
+static slong
+_platt_hardy_z_zeros_blocks(arb_ptr res, const fmpz_t n, slong len,
+        slong done, FILE * out, slong prec)
+{
+    platt_block_work_t work;
+    slong * start, * count, * found;
+    slong num, alloc, nt, i, j, m, prefix;
+
+    nt = FLINT_MAX(flint_get_num_threads(), 1);
+    alloc = 2 * nt + 2;
+
+    start = flint_malloc(alloc * sizeof(slong));
+    count = flint_malloc(alloc * sizeof(slong));
+    found = flint_malloc(alloc * sizeof(slong));
+
+    num = 0;
+    if (done < len)
+    {
+        start[0] = done;
+        count[0] = len - done;
+        num = 1;
+    }
+
+    prefix = done;
+
+    work.res = res;
+    work.n = n;
+    work.start = start;
+    work.count = count;
+    work.found = found;
+    work.prec = prec;
+
+    while (num > 0)
+    {
+        /* split the largest ranges until every thread has a window */
+        while (num < nt)
+        {
+            for (m = 0, i = 1; i < num; i++)
+                if (count[i] > count[m])
+                    m = i;
+
+            if (count[m] < 2 * PLATT_MIN_BLOCK)
+                break;
+
+            for (i = num; i > m + 1; i--)
+            {
+                start[i] = start[i - 1];
+                count[i] = count[i - 1];
+            }
+
+            count[m + 1] = count[m] / 2;
+            count[m] -= count[m + 1];
+            start[m + 1] = start[m] + count[m];
+            num++;
+        }
+
+        flint_parallel_do(platt_block_worker, &work, num, nt, FLINT_PARALLEL_DYNAMIC);
+
+        /* keep what is still missing, in order */
+        for (i = j = 0; i < num; i++)
+        {
+            if (found[i] <= 0)
+            {
+                len = start[i];
+                break;
+            }
+
+            if (found[i] < count[i])
+            {
+                start[j] = start[i] + found[i];
+                count[j] = count[i] - found[i];
+                j++;
+            }
+        }
+        num = j;
+
+        m = (num > 0) ? start[0] : len;
+
+        if (out != NULL && m > prefix && !_platt_write_zeros(out, res + prefix, m - prefix))
+            flint_throw(FLINT_ERROR, "(%s): failed to write checkpoint\n", __func__);
+
+        prefix = m;
+    }
+
+    flint_free(start);
+    flint_free(count);
+    flint_free(found);
+
+    return prefix;
+}
+
 slong
 acb_dirichlet_platt_hardy_z_zeros(
         arb_ptr res, const fmpz_t n, slong len, slong prec)
@@ -25,18 +170,138 @@ acb_dirichlet_platt_hardy_z_zeros(
     }
     else
     {
-        slong r, s;
-        fmpz_t k;
-        fmpz_init(k);
-        fmpz_set(k, n);
-        for (s = 0; s < len; s += r)
+        return _platt_hardy_z_zeros_blocks(res, n, len, 0, NULL, prec);
+    }
+    return 0;
+}
+
+/* Reads a line into *buf; returns its length if it ends with a newline
+   (which is stripped) and -1 otherwise. */
+static slong
+_platt_read_line(char ** buf, slong * alloc, FILE * in)
+{
+    slong len = 0;
+    int c;
+
+    while ((c = fgetc(in)) != EOF)
+    {
+        if (len + 1 >= *alloc)
+        {
+            *alloc = FLINT_MAX(2 * (*alloc), 64);
+            *buf = flint_realloc(*buf, *alloc);
+        }
+
+        if (c == '\n')
+        {
+            (*buf)[len] = '\0';
+            return len;
+        }
+
+        (*buf)[len++] = c;
+    }
+
+    return -1;
+}
+
+static FILE *
+_platt_write_header(const char * filename, const fmpz_t n)
+{
+    FILE * out = fopen(filename, "w");
+
+    if (out == NULL)
+        return NULL;
+
+    if (fputs("platt_hardy_z_zeros ", out) == EOF ||
+        fmpz_fprint(out, n) <= 0 || fputc('\n', out) == EOF)
+    {
+        fclose(out);
+        return NULL;
+    }
+
+    return out;
+}
+
+slong
+acb_dirichlet_platt_hardy_z_zeros_checkpoint(arb_ptr res, const fmpz_t n,
+        slong len, const char * filename, slong prec)
+{
+    FILE * in, * out;
+    char * buf, * tmpname;
+    slong done, alloc, found;
+    arb_t t;
+    fmpz_t m;
+
+    if (len <= 0 || fmpz_sizeinbase(n, 10) < 5)
+        return 0;
+
+    if (fmpz_sgn(n) < 1)
+        flint_throw(FLINT_ERROR, "Nonpositive indices of Hardy Z zeros are not supported.\n");
+
+    done = 0;
+    buf = NULL;
+    alloc = 0;
+
+    tmpname = flint_malloc(strlen(filename) + 5);
+    strcpy(tmpname, filename);
+    strcat(tmpname, ".tmp");
+
+    out = _platt_write_header(tmpname, n);
+    if (out == NULL)
+        flint_throw(FLINT_ERROR, "(%s): failed to write %s\n", __func__, tmpname);
+
+    /* Reload the zeros of an earlier run into a fresh file, dropping an
+       incomplete last record. Records beyond len are kept as they are. */
+    in = fopen(filename, "r");
+    if (in != NULL)
+    {
+        if (_platt_read_line(&buf, &alloc, in) < 0 ||
+            strncmp(buf, "platt_hardy_z_zeros ", 20) != 0)
+        {
+            flint_throw(FLINT_ERROR, "(%s): %s is not a checkpoint file\n", __func__, filename);
+        }
+
+        fmpz_init(m);
+        if (fmpz_set_str(m, buf + 20, 10) != 0 || !fmpz_equal(m, n))
+            flint_throw(FLINT_ERROR, "(%s): %s was written for another n\n", __func__, filename);
+        fmpz_clear(m);
+
+        arb_init(t);
+        while (_platt_read_line(&buf, &alloc, in) >= 0)
         {
-            r = acb_dirichlet_platt_local_hardy_z_zeros(res + s, k, len - s, prec);
-            if (!r)
+            if (arb_load_str(done < len ? res + done : t, buf) != 0)
                 break;
-            fmpz_add_si(k, k, r);
+
+            if (fputs(buf, out) == EOF || fputc('\n', out) == EOF)
+                flint_throw(FLINT_ERROR, "(%s): failed to write %s\n", __func__, tmpname);
+
+            if (done < len)
+                done++;
         }
-        return s;
+        arb_clear(t);
+
+        fclose(in);
     }
-    return 0;
+
+    if (fclose(out) != 0)
+        flint_throw(FLINT_ERROR, "(%s): failed to write %s\n", __func__, tmpname);
+
+    if (rename(tmpname, filename) != 0)
+    {
+        /* rename does not replace existing files everywhere */
+        remove(filename);
+        if (rename(tmpname, filename) != 0)
+            flint_throw(FLINT_ERROR, "(%s): failed to rename %s\n", __func__, tmpname);
+    }
+
+    out = fopen(filename, "a");
+    if (out == NULL)
+        flint_throw(FLINT_ERROR, "(%s): failed to open %s\n", __func__, filename);
+
+    found = _platt_hardy_z_zeros_blocks(res, n, len, done, out, prec);
+
+    fclose(out);
+    flint_free(tmpname);
+    flint_free(buf);
+
+    return found;
 }
@@ -11,6 +11,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "acb_dirichlet.h"
 #include "arb_calc.h"
 
@@ -1271,6 +1272,38 @@ _refine_local_hardy_z_zero_illinois(arb_t res,
     arb_clear(z);
 }
 
+/* The isolated zeros are refined independently, in parallel. */
+typedef struct
+{
+    arb_ptr res;
+    arf_interval_srcptr p;
+    platt_ctx_srcptr ctx;
+    slong prec;
+}
+refine_work_t;
+
+static void
+refine_worker(slong i, void * varg)
+{
+    refine_work_t * work = (refine_work_t *) varg;
+
+    _refine_local_hardy_z_zero_illinois(work->res + i, work->ctx,
+        &work->p[i].a, &work->p[i].b, work->prec);
+}
+
+static void
+_refine_local_hardy_z_zeros(arb_ptr res, const platt_ctx_t ctx,
+        arf_interval_srcptr p, slong len, slong prec)
+{
+    refine_work_t work;
+
+    work.res = res;
+    work.p = p;
+    work.ctx = ctx;
+    work.prec = prec;
+
+    flint_parallel_do(refine_worker, &work, len, -1, FLINT_PARALLEL_DYNAMIC);
+}
 
 slong
 _acb_dirichlet_platt_local_hardy_z_zeros(
@@ -1279,17 +1312,14 @@ _acb_dirichlet_platt_local_hardy_z_zeros(
         const arb_t h, const fmpz_t J, slong K, slong sigma_grid,
         slong Ns_max, const arb_t H, slong sigma_interp, slong prec)
 {
-    slong zeros_count, i;
+    slong zeros_count;
     arf_interval_ptr p;
     platt_ctx_t ctx;
     platt_ctx_init(
             ctx, T, A, B, h, J, K, sigma_grid, Ns_max, H, sigma_interp, prec);
     p = _arf_interval_vec_init(len);
     zeros_count = _isolate_zeros(p, ctx, n, len, prec);
-    for (i = 0; i < zeros_count; i++)
-    {
-        _refine_local_hardy_z_zero_illinois(res+i, ctx, &p[i].a, &p[i].b, prec);
-    }
+    _refine_local_hardy_z_zeros(res, ctx, p, zeros_count, prec);
     platt_ctx_clear(ctx);
     _arf_interval_vec_clear(p, len);
     return zeros_count;
@@ -1490,14 +1520,9 @@ acb_dirichlet_platt_local_hardy_z_zeros(
         ctx = _create_heuristic_context(n, prec);
         if (ctx)
         {
-            slong i;
             arf_interval_ptr p = _arf_interval_vec_init(len);
             zeros_count = _isolate_zeros(p, ctx, n, len, prec);
-            for (i = 0; i < zeros_count; i++)
-            {
-                _refine_local_hardy_z_zero_illinois(
-                    res+i, ctx, &p[i].a, &p[i].b, prec);
-            }
+            _refine_local_hardy_z_zeros(res, ctx, p, zeros_count, prec);
             _arf_interval_vec_clear(p, len);
             platt_ctx_clear(ctx);
             flint_free(ctx);
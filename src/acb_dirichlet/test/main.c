@@ -43,6 +43,7 @@
 #include "t-l_vec_hurwitz.c"
 #include "t-platt_beta.c"
 #include "t-platt_hardy_z_zeros.c"
+#include "t-platt_hardy_z_zeros_checkpoint.c"
 #include "t-platt_local_hardy_z_zeros.c"
 #include "t-platt_multieval.c"
 #include "t-platt_multieval_threaded.c"
@@ -96,6 +97,7 @@ test_struct tests[] =
     TEST_FUNCTION(acb_dirichlet_l_vec_hurwitz),
     TEST_FUNCTION(acb_dirichlet_platt_beta),
     TEST_FUNCTION(acb_dirichlet_platt_hardy_z_zeros),
+    TEST_FUNCTION(acb_dirichlet_platt_hardy_z_zeros_checkpoint),
     TEST_FUNCTION(acb_dirichlet_platt_local_hardy_z_zeros),
     TEST_FUNCTION(acb_dirichlet_platt_multieval),
     TEST_FUNCTION(acb_dirichlet_platt_multieval_threaded),
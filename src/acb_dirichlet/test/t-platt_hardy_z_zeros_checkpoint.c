@@ -0,0 +1,131 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "test_helpers.h"
+#include "acb_dirichlet.h"
+
+TEST_FUNCTION_START(acb_dirichlet_platt_hardy_z_zeros_checkpoint, state)
+{
+/* assume file creation may be unavailable on windows */
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+    const char * filename = "platt_hardy_z_zeros_checkpoint.tmp";
+    fmpz_t n;
+    arb_ptr pa, pb, pc;
+    slong count, i, j, keep;
+    slong maxcount = 60;
+    slong prec = 64;
+    FILE * file;
+    char line[1000];
+
+    fmpz_init(n);
+    pa = _arb_vec_init(maxcount);
+    pb = _arb_vec_init(maxcount);
+    pc = _arb_vec_init(maxcount);
+
+    fmpz_set_si(n, 10000 + n_randint(state, 1000));
+    acb_dirichlet_hardy_z_zeros(pb, n, maxcount, prec);
+
+    /* block-parallel computation over several windows */
+    flint_set_num_threads(2 + n_randint(state, 3));
+    count = acb_dirichlet_platt_hardy_z_zeros(pc, n, maxcount, prec);
+    flint_set_num_threads(1);
+
+    for (i = 0; i < count; i++)
+    {
+        if (!arb_overlaps(pc + i, pb + i))
+        {
+            flint_printf("FAIL: overlap (threaded)\n\n");
+            flint_printf("i = %wd\n\n", i);
+            flint_abort();
+        }
+    }
+
+    if (count != maxcount)
+    {
+        flint_printf("FAIL: count (threaded) = %wd\n\n", count);
+        flint_abort();
+    }
+
+    /* fresh run writing a checkpoint */
+    remove(filename);
+    count = acb_dirichlet_platt_hardy_z_zeros_checkpoint(pa, n, maxcount / 2, filename, prec);
+
+    if (count != maxcount / 2)
+    {
+        flint_printf("FAIL: count (fresh) = %wd\n\n", count);
+        flint_abort();
+    }
+
+    /* simulate a run killed while writing: keep some records and a partial one */
+    keep = n_randint(state, count + 1);
+    file = fopen(filename, "r");
+    for (i = 0; i < keep + 2 && fgets(line, sizeof(line), file) != NULL; i++);
+    fclose(file);
+
+    file = fopen(filename, "w");
+    flint_fprintf(file, "platt_hardy_z_zeros ");
+    fmpz_fprint(file, n);
+    flint_fprintf(file, "\n");
+    for (j = 0; j < keep; j++)
+    {
+        arb_dump_file(file, pa + j);
+        flint_fprintf(file, "\n");
+    }
+    if (keep < count)
+        flint_fprintf(file, "%.5s", line);
+    fclose(file);
+
+    for (j = 0; j < maxcount; j++)
+        arb_indeterminate(pc + j);
+
+    count = acb_dirichlet_platt_hardy_z_zeros_checkpoint(pc, n, maxcount, filename, prec);
+
+    if (count != maxcount)
+    {
+        flint_printf("FAIL: count (resumed) = %wd\n\n", count);
+        flint_abort();
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if ((i < keep && !arb_equal(pc + i, pa + i)) || !arb_overlaps(pc + i, pb + i))
+        {
+            flint_printf("FAIL: resumed zero\n\n");
+            flint_printf("i = %wd, keep = %wd\n\n", i, keep);
+            flint_printf("observed = "); arb_printd(pc + i, 20); flint_printf("\n\n");
+            flint_printf("expected = "); arb_printd(pb + i, 20); flint_printf("\n\n");
+            flint_abort();
+        }
+    }
+
+    /* everything is in the file now; nothing is recomputed */
+    for (j = 0; j < maxcount; j++)
+        arb_indeterminate(pa + j);
+
+    count = acb_dirichlet_platt_hardy_z_zeros_checkpoint(pa, n, maxcount, filename, prec);
+
+    if (count != maxcount || !_arb_vec_equal(pa, pc, maxcount))
+    {
+        flint_printf("FAIL: reload\n\n");
+        flint_abort();
+    }
+
+    remove(filename);
+
+    fmpz_clear(n);
+    _arb_vec_clear(pa, maxcount);
+    _arb_vec_clear(pb, maxcount);
+    _arb_vec_clear(pc, maxcount);
+#endif
+
+    TEST_FUNCTION_END(state);
+}
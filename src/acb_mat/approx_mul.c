@@ -92,10 +92,10 @@ acb_mat_approx_mul(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec
     /* todo: detect small-integer matrices */
     if (prec <= 2 * FLINT_BITS)
         cutoff = 120;
-    else if (prec <= 16 * FLINT_BITS)
-        cutoff = 60;
-    else
+    else if (prec <= 8 * FLINT_BITS)
         cutoff = 40;
+    else
+        cutoff = 20;
 
     if (acb_mat_nrows(A) <= cutoff || acb_mat_ncols(A) <= cutoff ||
         acb_mat_ncols(B) <= cutoff)
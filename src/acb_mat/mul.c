@@ -49,6 +49,53 @@ int acb_mat_is_lagom(const acb_mat_t A)
     return 1;
 }
 
+/* upper bounds for the exponents of the real and imaginary midpoints */
+static void
+acb_mat_mid_exp_bounds(slong * re, slong * im, const acb_mat_t A)
+{
+    slong i, j, t;
+    acb_srcptr x;
+
+    *re = *im = -ARF_PREC_EXACT;
+
+    for (i = 0; i < acb_mat_nrows(A); i++)
+    {
+        for (j = 0; j < acb_mat_ncols(A); j++)
+        {
+            x = acb_mat_entry(A, i, j);
+            t = arf_abs_bound_lt_2exp_si(arb_midref(acb_realref(x)));
+            *re = FLINT_MAX(*re, t);
+            t = arf_abs_bound_lt_2exp_si(arb_midref(acb_imagref(x)));
+            *im = FLINT_MAX(*im, t);
+        }
+    }
+}
+
+/* Bits of accuracy in the imaginary part that the three-multiplication
+   formula loses compared to four real products. Computing
+   (Ar + Ai)(Br + Bi) - Ar Br - Ai Bi gives error terms of size
+   |Ar Br| + |Ai Bi|, which can be much larger than the result
+   Ar Bi + Ai Br when both matrices are nearly real or both are nearly
+   imaginary. */
+static slong
+acb_mat_mul_block_loss(const acb_mat_t A, const acb_mat_t B)
+{
+    slong are, aim, bre, bim, da, db;
+
+    acb_mat_mid_exp_bounds(&are, &aim, A);
+    acb_mat_mid_exp_bounds(&bre, &bim, B);
+
+    da = are - aim;
+    db = bre - bim;
+
+    if (da > 0 && db > 0)
+        return FLINT_MIN(da, db);
+    else if (da < 0 && db < 0)
+        return FLINT_MIN(-da, -db);
+    else
+        return 0;
+}
+
 void
 acb_mat_mul(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
 {
@@ -76,7 +123,15 @@ acb_mat_mul(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
 
         if (bits < 8000 && n >= 5 + bits / 64)
         {
-            acb_mat_mul_reorder(C, A, B, prec);
+            /* three block products instead of four, unless this would
+               cost more than a few bits in the imaginary part; at low
+               precision the extra bit in the sums makes it slower */
+            if (bits > 2 * FLINT_BITS &&
+                !acb_mat_is_real(A) && !acb_mat_is_real(B) &&
+                acb_mat_mul_block_loss(A, B) <= 4)
+                acb_mat_mul_block(C, A, B, prec);
+            else
+                acb_mat_mul_reorder(C, A, B, prec);
             return;
         }
     }
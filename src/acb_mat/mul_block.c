@@ -0,0 +1,70 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "arb_mat.h"
+#include "acb_mat.h"
+
+void
+acb_mat_mul_block(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
+{
+    arb_mat_t Ar, Ai, Br, Bi, T, U, V;
+    slong M, N, P;
+
+    M = acb_mat_nrows(A);
+    N = acb_mat_ncols(A);
+    P = acb_mat_ncols(B);
+
+    if (N != acb_mat_nrows(B) || M != acb_mat_nrows(C) || P != acb_mat_ncols(C))
+    {
+        flint_throw(FLINT_ERROR, "acb_mat_mul_block: incompatible dimensions\n");
+    }
+
+    /* one or two real products suffice */
+    if (acb_mat_is_real(A) || acb_mat_is_real(B))
+    {
+        acb_mat_mul_reorder(C, A, B, prec);
+        return;
+    }
+
+    arb_mat_init(Ar, M, N);
+    arb_mat_init(Ai, M, N);
+    arb_mat_init(Br, N, P);
+    arb_mat_init(Bi, N, P);
+    arb_mat_init(T, M, P);
+    arb_mat_init(U, M, P);
+    arb_mat_init(V, M, P);
+
+    acb_mat_get_real(Ar, A);
+    acb_mat_get_imag(Ai, A);
+    acb_mat_get_real(Br, B);
+    acb_mat_get_imag(Bi, B);
+
+    /* T = Ar Br, U = Ai Bi, V = (Ar + Ai)(Br + Bi) */
+    arb_mat_mul_block(T, Ar, Br, prec);
+    arb_mat_mul_block(U, Ai, Bi, prec);
+    arb_mat_add(Ar, Ar, Ai, prec);
+    arb_mat_add(Br, Br, Bi, prec);
+    arb_mat_mul_block(V, Ar, Br, prec);
+
+    /* C = (T - U) + (V - T - U) i */
+    arb_mat_sub(V, V, T, prec);
+    arb_mat_sub(V, V, U, prec);
+    arb_mat_sub(T, T, U, prec);
+    acb_mat_set_real_imag(C, T, V);
+
+    arb_mat_clear(Ar);
+    arb_mat_clear(Ai);
+    arb_mat_clear(Br);
+    arb_mat_clear(Bi);
+    arb_mat_clear(T);
+    arb_mat_clear(U);
+    arb_mat_clear(V);
+}
@@ -31,6 +31,7 @@
 #include "t-lu.c"
 #include "t-lu_recursive.c"
 #include "t-mul.c"
+#include "t-mul_block.c"
 #include "t-mul_entrywise.c"
 #include "t-mul_reorder.c"
 #include "t-mul_threaded.c"
@@ -66,6 +67,7 @@ test_struct tests[] =
     TEST_FUNCTION(acb_mat_lu),
     TEST_FUNCTION(acb_mat_lu_recursive),
     TEST_FUNCTION(acb_mat_mul),
+    TEST_FUNCTION(acb_mat_mul_block),
     TEST_FUNCTION(acb_mat_mul_entrywise),
     TEST_FUNCTION(acb_mat_mul_reorder),
     TEST_FUNCTION(acb_mat_mul_threaded),
@@ -0,0 +1,172 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "fmpq_mat.h"
+#include "arb_mat.h"
+#include "acb_mat.h"
+
+TEST_FUNCTION_START(acb_mat_mul_block, state)
+{
+    slong iter;
+
+    /* exact products of rational complex matrices */
+    for (iter = 0; iter < 1000 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        slong m, n, k, qbits1, qbits2, rbits1, rbits2, rbits3;
+        fmpq_mat_t A1, A2, B1, B2, C1, C2, T;
+        acb_mat_t a, b, c;
+        arb_mat_t a1, a2, b1, b2, c1, c2;
+
+        qbits1 = 2 + n_randint(state, 200);
+        qbits2 = 2 + n_randint(state, 200);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+        rbits3 = 2 + n_randint(state, 200);
+
+        m = n_randint(state, n_randint(state, 10) == 0 ? 40 : 8);
+        n = n_randint(state, n_randint(state, 10) == 0 ? 40 : 8);
+        k = n_randint(state, n_randint(state, 10) == 0 ? 40 : 8);
+
+        fmpq_mat_init(A1, m, n);
+        fmpq_mat_init(A2, m, n);
+        fmpq_mat_init(B1, n, k);
+        fmpq_mat_init(B2, n, k);
+        fmpq_mat_init(C1, m, k);
+        fmpq_mat_init(C2, m, k);
+        fmpq_mat_init(T, m, k);
+
+        acb_mat_init(a, m, n);
+        acb_mat_init(b, n, k);
+        acb_mat_init(c, m, k);
+        arb_mat_init(a1, m, n);
+        arb_mat_init(a2, m, n);
+        arb_mat_init(b1, n, k);
+        arb_mat_init(b2, n, k);
+        arb_mat_init(c1, m, k);
+        arb_mat_init(c2, m, k);
+
+        fmpq_mat_randtest(A1, state, qbits1);
+        fmpq_mat_randtest(A2, state, qbits1);
+        fmpq_mat_randtest(B1, state, qbits2);
+        fmpq_mat_randtest(B2, state, qbits2);
+
+        /* C1 + C2 i = (A1 + A2 i)(B1 + B2 i) */
+        fmpq_mat_mul(C1, A1, B1);
+        fmpq_mat_mul(T, A2, B2);
+        fmpq_mat_sub(C1, C1, T);
+        fmpq_mat_mul(C2, A1, B2);
+        fmpq_mat_mul(T, A2, B1);
+        fmpq_mat_add(C2, C2, T);
+
+        arb_mat_set_fmpq_mat(a1, A1, rbits1);
+        arb_mat_set_fmpq_mat(a2, A2, rbits1);
+        arb_mat_set_fmpq_mat(b1, B1, rbits2);
+        arb_mat_set_fmpq_mat(b2, B2, rbits2);
+        acb_mat_set_real_imag(a, a1, a2);
+        acb_mat_set_real_imag(b, b1, b2);
+
+        acb_mat_mul_block(c, a, b, rbits3);
+
+        acb_mat_get_real(c1, c);
+        acb_mat_get_imag(c2, c);
+
+        if (!arb_mat_contains_fmpq_mat(c1, C1) ||
+            !arb_mat_contains_fmpq_mat(c2, C2))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("m = %wd, n = %wd, k = %wd, bits3 = %wd\n", m, n, k, rbits3);
+            flint_printf("a = "); acb_mat_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); acb_mat_printd(b, 15); flint_printf("\n\n");
+            flint_printf("c = "); acb_mat_printd(c, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        fmpq_mat_clear(A1);
+        fmpq_mat_clear(A2);
+        fmpq_mat_clear(B1);
+        fmpq_mat_clear(B2);
+        fmpq_mat_clear(C1);
+        fmpq_mat_clear(C2);
+        fmpq_mat_clear(T);
+
+        acb_mat_clear(a);
+        acb_mat_clear(b);
+        acb_mat_clear(c);
+        arb_mat_clear(a1);
+        arb_mat_clear(a2);
+        arb_mat_clear(b1);
+        arb_mat_clear(b2);
+        arb_mat_clear(c1);
+        arb_mat_clear(c2);
+    }
+
+    /* compare with classical multiplication, and test aliasing */
+    for (iter = 0; iter < 1000 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        slong m, n, prec;
+        acb_mat_t a, b, c, d;
+
+        prec = 2 + n_randint(state, 200);
+
+        m = n_randint(state, 10);
+        n = n_randint(state, 10);
+
+        acb_mat_init(a, m, n);
+        acb_mat_init(b, n, n);
+        acb_mat_init(c, m, n);
+        acb_mat_init(d, m, n);
+
+        acb_mat_randtest(a, state, 2 + n_randint(state, 200), 10);
+        acb_mat_randtest(b, state, 2 + n_randint(state, 200), 10);
+
+        acb_mat_mul_block(c, a, b, prec);
+        acb_mat_mul_classical(d, a, b, prec);
+
+        if (!acb_mat_overlaps(c, d))
+        {
+            flint_printf("FAIL (overlap)\n\n");
+            flint_printf("a = "); acb_mat_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); acb_mat_printd(b, 15); flint_printf("\n\n");
+            flint_printf("c = "); acb_mat_printd(c, 15); flint_printf("\n\n");
+            flint_printf("d = "); acb_mat_printd(d, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        acb_mat_set(d, a);
+        acb_mat_mul_block(d, d, b, prec);
+
+        if (!acb_mat_equal(c, d))
+        {
+            flint_printf("FAIL (aliasing 1)\n\n");
+            flint_abort();
+        }
+
+        if (m == n)
+        {
+            acb_mat_set(d, b);
+            acb_mat_mul_block(d, a, d, prec);
+
+            if (!acb_mat_equal(c, d))
+            {
+                flint_printf("FAIL (aliasing 2)\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_mat_clear(a);
+        acb_mat_clear(b);
+        acb_mat_clear(c);
+        acb_mat_clear(d);
+    }
+
+    TEST_FUNCTION_END(state);
+}
@@ -60,7 +60,6 @@ _acb_mat_vector_mul_col(acb_ptr res, const acb_mat_t A, acb_srcptr v, slong prec
 {
     slong r = acb_mat_nrows(A);
     slong c = acb_mat_ncols(A);
-    slong k;
 
     if (acb_mat_is_empty(A))
     {
@@ -68,10 +67,7 @@ _acb_mat_vector_mul_col(acb_ptr res, const acb_mat_t A, acb_srcptr v, slong prec
     }
     else
     {
-        for (k = 0; k < r; k++)
-        {
-            acb_dot(&res[k], NULL, 0, A->rows[k], 1, v, 1, c, prec);
-        }
+        acb_dot_many(res, v, 1, A->rows, 1, r, c, prec);
     }
 }
 
@@ -10,9 +10,53 @@
 */
 
 #include "ulong_extras.h"
+#include "thread_support.h"
 #include "acb_mat.h"
 #include "acb_theta.h"
 
+typedef struct
+{
+    acb_ptr all_val;
+    acb_srcptr zetas;
+    acb_srcptr z;
+    const arf_struct * eps;
+    const acb_mat_struct * tau;
+    slong b;
+    slong prec;
+}
+acb_theta_jet_ql_work_t;
+
+/* Theta values at the k-th point of the grid around z */
+static void
+acb_theta_jet_ql_worker(slong k, void * varg)
+{
+    acb_theta_jet_ql_work_t * work = (acb_theta_jet_ql_work_t *) varg;
+    slong g = acb_mat_nrows(work->tau);
+    slong n2 = 1 << (2 * g);
+    slong b = work->b;
+    acb_ptr new_z;
+    arb_t t;
+    slong kmod, j;
+
+    new_z = _acb_vec_init(g);
+    arb_init(t);
+
+    kmod = k;
+    for (j = g - 1; j >= 0; j--)
+    {
+        acb_set(&new_z[j], &work->zetas[kmod % b]);
+        kmod = kmod / b;
+    }
+    arb_set_arf(t, work->eps);
+    _acb_vec_scalar_mul_arb(new_z, new_z, g, t, work->prec);
+    _acb_vec_add(new_z, new_z, work->z, g, work->prec);
+
+    acb_theta_ql_all(work->all_val + k * n2, new_z, work->tau, 0, work->prec);
+
+    _acb_vec_clear(new_z, g);
+    arb_clear(t);
+}
+
 static void
 acb_theta_jet_ql_all_red(acb_ptr dth, acb_srcptr z, const acb_mat_t tau, slong ord, slong prec)
 {
@@ -24,12 +68,13 @@ acb_theta_jet_ql_all_red(acb_ptr dth, acb_srcptr z, const acb_mat_t tau, slong o
     slong nb = acb_theta_jet_nb(ord, g);
     slong nb_low = acb_theta_jet_nb(ord + 2, g);
     int hasz = !_acb_vec_is_zero(z, g);
+    acb_theta_jet_ql_work_t work;
     arb_t c, rho, t;
     arf_t eps, err, e;
     acb_mat_t tau_mid;
-    acb_ptr z_mid, zetas, new_z, all_val, val, jet, dth_low;
+    acb_ptr z_mid, zetas, all_val, val, jet, dth_low;
     arb_ptr err_vec;
-    slong k, kmod, j;
+    slong k, j;
 
     arb_init(c);
     arb_init(rho);
@@ -60,7 +105,6 @@ acb_theta_jet_ql_all_red(acb_ptr dth, acb_srcptr z, const acb_mat_t tau, slong o
     acb_mat_init(tau_mid, g, g);
     z_mid = _acb_vec_init(g);
     zetas = _acb_vec_init(b);
-    new_z = _acb_vec_init(g);
     all_val = _acb_vec_init(n2 * n_pow(b, g));
     val = _acb_vec_init(n_pow(b, g));
     jet = _acb_vec_init(nb);
@@ -87,22 +131,17 @@ acb_theta_jet_ql_all_red(acb_ptr dth, acb_srcptr z, const acb_mat_t tau, slong o
         }
     }
 
-    /* Collect values around midpoint */
+    /* Collect values around midpoint; the grid points are independent */
     _acb_vec_unit_roots(zetas, b, b, hprec);
-    for (k = 0; k < n_pow(b, g); k++)
-    {
-        kmod = k;
-        for (j = g - 1; j >= 0; j--)
-        {
-            acb_set(&new_z[j], &zetas[kmod % b]);
-            kmod = kmod / b;
-        }
-        arb_set_arf(t, eps);
-        _acb_vec_scalar_mul_arb(new_z, new_z, g, t, hprec);
-        _acb_vec_add(new_z, new_z, z_mid, g, hprec);
-
-        acb_theta_ql_all(all_val + k * n2, new_z, tau_mid, 0, hprec);
-    }
+    work.all_val = all_val;
+    work.zetas = zetas;
+    work.z = z_mid;
+    work.eps = eps;
+    work.tau = tau_mid;
+    work.b = b;
+    work.prec = hprec;
+    flint_parallel_do(acb_theta_jet_ql_worker, &work, n_pow(b, g), -1,
+        FLINT_PARALLEL_DYNAMIC);
 
     /* Make finite differences */
     for (k = 0; k < n2; k++)
@@ -135,7 +174,6 @@ acb_theta_jet_ql_all_red(acb_ptr dth, acb_srcptr z, const acb_mat_t tau, slong o
     acb_mat_clear(tau_mid);
     _acb_vec_clear(z_mid, g);
     _acb_vec_clear(zetas, b);
-    _acb_vec_clear(new_z, g);
     _acb_vec_clear(all_val, n2 * n_pow(b, g));
     _acb_vec_clear(val, n_pow(b, g));
     _acb_vec_clear(jet, nb);
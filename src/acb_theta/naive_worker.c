@@ -11,9 +11,24 @@
 
 #include <math.h>
 #include "ulong_extras.h"
+#include "thread_support.h"
 #include "acb_mat.h"
 #include "acb_theta.h"
 
+/* A slab is a child of the top-level ellipsoid, i.e. the set of points with
+   a fixed last coordinate, together with the data needed to start the
+   recursion on it: the cofactor, the precision, and the entries (k, d - 1)
+   for k < d - 1 of lin_pow and lin_pow_inv. */
+
+typedef struct
+{
+    const struct acb_theta_eld_struct * E;
+    acb_t cf;
+    acb_ptr col;
+    slong prec;
+}
+acb_theta_naive_slab_struct;
+
 static slong
 acb_theta_naive_fullprec(const acb_theta_eld_t E, slong prec)
 {
@@ -96,14 +111,34 @@ acb_theta_naive_call_dim1(acb_ptr th, acb_ptr v1, acb_ptr v2, slong * precs,
     flint_free(coords);
 }
 
-/* Recursive call to smaller dimension; fall back to dim1 when appropriate */
+static void
+acb_theta_naive_slab_set(acb_theta_naive_slab_struct * slab,
+    const struct acb_theta_eld_struct * E, const acb_mat_t lin_pow,
+    const acb_mat_t lin_pow_inv, const acb_t cf, slong d, slong prec)
+{
+    slong k;
+
+    slab->E = E;
+    slab->prec = prec;
+    acb_set(slab->cf, cf);
+    for (k = 0; k < d - 1; k++)
+    {
+        acb_set(&slab->col[k], acb_mat_entry(lin_pow, k, d - 1));
+        acb_set(&slab->col[d - 1 + k], acb_mat_entry(lin_pow_inv, k, d - 1));
+    }
+}
+
+/* Recursive call to smaller dimension; fall back to dim1 when appropriate.
+   If slabs is not NULL, the children of E are recorded there instead of
+   being traversed. */
 
 static void
 acb_theta_naive_worker_rec(acb_ptr th, acb_ptr v1, acb_ptr v2, slong * precs,
     acb_mat_t lin_pow, acb_mat_t lin_pow_inv, const acb_t cf, acb_srcptr exp_z,
     acb_srcptr exp_z_inv, const acb_mat_t exp_tau, const acb_mat_t exp_tau_inv,
     const acb_ptr * sqr_pow, const acb_theta_eld_t E, slong ord, slong prec,
-    slong fullprec, acb_theta_naive_worker_t worker)
+    slong fullprec, acb_theta_naive_worker_t worker,
+    acb_theta_naive_slab_struct * slabs)
 {
     slong d = acb_theta_eld_dim(E);
     slong g = acb_theta_eld_ambient_dim(E);
@@ -211,9 +246,17 @@ acb_theta_naive_worker_rec(acb_ptr th, acb_ptr v1, acb_ptr v2, slong * precs,
         }
 
         acb_mul(full_cf, lin_cf, &sqr_pow[d - 1][FLINT_ABS(c)], newprec);
-        acb_theta_naive_worker_rec(th, v1, v2, precs, lin_pow, lin_pow_inv, full_cf,
-            exp_z, exp_z_inv, exp_tau, exp_tau_inv, sqr_pow, acb_theta_eld_rchild(E, k),
-            ord, newprec, fullprec, worker);
+        if (slabs != NULL)
+        {
+            acb_theta_naive_slab_set(&slabs[k], acb_theta_eld_rchild(E, k),
+                lin_pow, lin_pow_inv, full_cf, d, newprec);
+        }
+        else
+        {
+            acb_theta_naive_worker_rec(th, v1, v2, precs, lin_pow, lin_pow_inv, full_cf,
+                exp_z, exp_z_inv, exp_tau, exp_tau_inv, sqr_pow, acb_theta_eld_rchild(E, k),
+                ord, newprec, fullprec, worker, NULL);
+        }
     }
 
     /* Left loop */
@@ -237,9 +280,17 @@ acb_theta_naive_worker_rec(acb_ptr th, acb_ptr v1, acb_ptr v2, slong * precs,
         acb_mul(lin_cf, lin_cf, diff_cf_inv, newprec);
 
         acb_mul(full_cf, lin_cf, &sqr_pow[d - 1][FLINT_ABS(c)], newprec);
-        acb_theta_naive_worker_rec(th, v1, v2, precs, lin_pow, lin_pow_inv, full_cf,
-            exp_z, exp_z_inv, exp_tau, exp_tau_inv, sqr_pow, acb_theta_eld_lchild(E, k),
-            ord, newprec, fullprec, worker);
+        if (slabs != NULL)
+        {
+            acb_theta_naive_slab_set(&slabs[nr + k], acb_theta_eld_lchild(E, k),
+                lin_pow, lin_pow_inv, full_cf, d, newprec);
+        }
+        else
+        {
+            acb_theta_naive_worker_rec(th, v1, v2, precs, lin_pow, lin_pow_inv, full_cf,
+                exp_z, exp_z_inv, exp_tau, exp_tau_inv, sqr_pow, acb_theta_eld_lchild(E, k),
+                ord, newprec, fullprec, worker, NULL);
+        }
     }
 
     acb_clear(start_cf);
@@ -298,6 +349,66 @@ acb_theta_naive_precompute(acb_mat_t exp_tau, acb_mat_t exp_tau_inv,
     acb_clear(ddc);
 }
 
+typedef struct
+{
+    acb_ptr res;
+    slong len;
+    slong nb_slabs;
+    acb_theta_naive_slab_struct * slabs;
+    acb_srcptr exp_z;
+    acb_srcptr exp_z_inv;
+    const acb_mat_struct * exp_tau;
+    const acb_mat_struct * exp_tau_inv;
+    const acb_ptr * sqr_pow;
+    slong width;
+    slong ord;
+    slong fullprec;
+    acb_theta_naive_worker_t worker;
+}
+acb_theta_naive_work_t;
+
+/* Traverse one slab with its own temporaries, accumulating in its own block
+   of res */
+
+static void
+acb_theta_naive_slab_worker(slong i, void * varg)
+{
+    acb_theta_naive_work_t * work = (acb_theta_naive_work_t *) varg;
+    const acb_theta_naive_slab_struct * slab = work->slabs + i;
+    slong g = acb_mat_nrows(work->exp_tau);
+    slong d = acb_theta_eld_dim(slab->E) + 1;
+    slong j = i / work->nb_slabs;
+    acb_mat_t lin_pow, lin_pow_inv;
+    acb_ptr v1, v2;
+    slong * precs;
+    slong k;
+
+    acb_mat_init(lin_pow, g, g);
+    acb_mat_init(lin_pow_inv, g, g);
+    v1 = _acb_vec_init(work->width);
+    v2 = _acb_vec_init(work->width);
+    precs = flint_malloc(work->width * sizeof(slong));
+
+    acb_mat_set(lin_pow, work->exp_tau);
+    acb_mat_set(lin_pow_inv, work->exp_tau_inv);
+    for (k = 0; k < d - 1; k++)
+    {
+        acb_set(acb_mat_entry(lin_pow, k, d - 1), &slab->col[k]);
+        acb_set(acb_mat_entry(lin_pow_inv, k, d - 1), &slab->col[d - 1 + k]);
+    }
+
+    acb_theta_naive_worker_rec(work->res + i * work->len, v1, v2, precs,
+        lin_pow, lin_pow_inv, slab->cf, work->exp_z + j * g, work->exp_z_inv + j * g,
+        work->exp_tau, work->exp_tau_inv, work->sqr_pow, slab->E, work->ord,
+        slab->prec, work->fullprec, work->worker, NULL);
+
+    acb_mat_clear(lin_pow);
+    acb_mat_clear(lin_pow_inv);
+    _acb_vec_clear(v1, work->width);
+    _acb_vec_clear(v2, work->width);
+    flint_free(precs);
+}
+
 /* User function */
 
 void
@@ -306,14 +417,22 @@ acb_theta_naive_worker(acb_ptr th, slong len, acb_srcptr zs, slong nb,
     acb_theta_naive_worker_t worker)
 {
     slong g = acb_theta_eld_ambient_dim(E);
+    slong d = acb_theta_eld_dim(E);
     slong fullprec = acb_theta_naive_fullprec(E, prec);
+    slong nb_slabs = acb_theta_eld_nr(E) + acb_theta_eld_nl(E);
     slong width = 0;
     acb_mat_t exp_tau, exp_tau_inv, lin_pow, lin_pow_inv;
     acb_ptr * sqr_pow;
-    acb_ptr v1, v2, exp_z, exp_z_inv, res;
+    acb_ptr v1, v2, exp_z, exp_z_inv, res, aux;
+    acb_theta_naive_slab_struct * slabs;
+    acb_theta_naive_work_t work;
     slong * precs;
     acb_t cf;
     slong j, k;
+    int threaded;
+
+    threaded = (flint_get_num_threads() > 1 && d >= 2
+        && acb_theta_eld_nb_pts(E) > 0 && nb * nb_slabs >= 2);
 
     for (j = 0; j < g; j++)
     {
@@ -331,8 +450,8 @@ acb_theta_naive_worker(acb_ptr th, slong len, acb_srcptr zs, slong nb,
     }
     v1 = _acb_vec_init(width);
     v2 = _acb_vec_init(width);
-    exp_z = _acb_vec_init(g);
-    exp_z_inv = _acb_vec_init(g);
+    exp_z = _acb_vec_init(g * nb);
+    exp_z_inv = _acb_vec_init(g * nb);
     res = _acb_vec_init(len * nb);
     acb_init(cf);
     precs = flint_malloc(width * sizeof(slong));
@@ -340,21 +459,81 @@ acb_theta_naive_worker(acb_ptr th, slong len, acb_srcptr zs, slong nb,
     acb_theta_naive_precompute(exp_tau, exp_tau_inv, sqr_pow, tau, E, prec);
     acb_one(cf);
 
-    for (j = 0; j < nb; j++)
+    for (k = 0; k < g * nb; k++)
+    {
+        acb_mul_2exp_si(&exp_z[k], &zs[k], 1);
+        acb_exp_pi_i(&exp_z[k], &exp_z[k], prec);
+        acb_inv(&exp_z_inv[k], &exp_z[k], prec);
+    }
+
+    if (!threaded)
     {
-        for (k = 0; k < g; k++)
+        for (j = 0; j < nb; j++)
         {
-            acb_mul_2exp_si(&exp_z[k], &zs[j * g + k], 1);
-            acb_exp_pi_i(&exp_z[k], &exp_z[k], prec);
-            acb_inv(&exp_z_inv[k], &exp_z[k], prec);
+            acb_mat_set(lin_pow, exp_tau);
+            acb_mat_set(lin_pow_inv, exp_tau_inv);
+
+            acb_theta_naive_worker_rec(res + j * len, v1, v2, precs, lin_pow, lin_pow_inv,
+                cf, exp_z + j * g, exp_z_inv + j * g, exp_tau, exp_tau_inv, sqr_pow,
+                E, ord, fullprec, fullprec, worker, NULL);
+        }
+    }
+    else
+    {
+        /* Split the points of E into slabs along the last coordinate. Each
+           slab is summed separately and the partial sums are added in a
+           fixed order, so the result is the same for any number of threads
+           >= 2 (the serial loop above sums in a different order). */
+        slabs = flint_malloc(nb * nb_slabs * sizeof(acb_theta_naive_slab_struct));
+        for (k = 0; k < nb * nb_slabs; k++)
+        {
+            acb_init(slabs[k].cf);
+            slabs[k].col = _acb_vec_init(2 * (d - 1));
+        }
+        aux = _acb_vec_init(nb * nb_slabs * len);
+
+        for (j = 0; j < nb; j++)
+        {
+            acb_mat_set(lin_pow, exp_tau);
+            acb_mat_set(lin_pow_inv, exp_tau_inv);
+
+            acb_theta_naive_worker_rec(NULL, v1, v2, precs, lin_pow, lin_pow_inv,
+                cf, exp_z + j * g, exp_z_inv + j * g, exp_tau, exp_tau_inv, sqr_pow,
+                E, ord, fullprec, fullprec, worker, slabs + j * nb_slabs);
+        }
+
+        work.res = aux;
+        work.len = len;
+        work.nb_slabs = nb_slabs;
+        work.slabs = slabs;
+        work.exp_z = exp_z;
+        work.exp_z_inv = exp_z_inv;
+        work.exp_tau = exp_tau;
+        work.exp_tau_inv = exp_tau_inv;
+        work.sqr_pow = sqr_pow;
+        work.width = width;
+        work.ord = ord;
+        work.fullprec = fullprec;
+        work.worker = worker;
+
+        flint_parallel_do(acb_theta_naive_slab_worker, &work,
+            nb * nb_slabs, -1, FLINT_PARALLEL_DYNAMIC);
+
+        for (k = 0; k < nb * nb_slabs; k++)
+        {
+            j = k / nb_slabs;
+            _acb_vec_add(res + j * len, res + j * len, aux + k * len, len, fullprec);
         }
-        acb_mat_set(lin_pow, exp_tau);
-        acb_mat_set(lin_pow_inv, exp_tau_inv);
 
-        acb_theta_naive_worker_rec(res + j * len, v1, v2, precs, lin_pow, lin_pow_inv,
-            cf, exp_z, exp_z_inv, exp_tau, exp_tau_inv, sqr_pow, E, ord,
-            fullprec, fullprec, worker);
+        for (k = 0; k < nb * nb_slabs; k++)
+        {
+            acb_clear(slabs[k].cf);
+            _acb_vec_clear(slabs[k].col, 2 * (d - 1));
+        }
+        flint_free(slabs);
+        _acb_vec_clear(aux, nb * nb_slabs * len);
     }
+
     _acb_vec_set(th, res, len * nb);
 
     acb_mat_clear(exp_tau);
@@ -368,8 +547,8 @@ acb_theta_naive_worker(acb_ptr th, slong len, acb_srcptr zs, slong nb,
     flint_free(sqr_pow);
     _acb_vec_clear(v1, width);
     _acb_vec_clear(v2, width);
-    _acb_vec_clear(exp_z, g);
-    _acb_vec_clear(exp_z_inv, g);
+    _acb_vec_clear(exp_z, g * nb);
+    _acb_vec_clear(exp_z_inv, g * nb);
     _acb_vec_clear(res, len * nb);
     acb_clear(cf);
     flint_free(precs);
@@ -9,10 +9,67 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "arb_mat.h"
 #include "acb_mat.h"
 #include "acb_theta.h"
 
+typedef struct
+{
+    acb_ptr r;
+    acb_srcptr t;
+    acb_srcptr z;
+    arb_srcptr dist0;
+    arb_srcptr dist;
+    const acb_mat_struct * tau;
+    slong nbt;
+    slong prec;
+}
+acb_theta_ql_a0_err_work_t;
+
+/* Add the error bound on r[i], where i = k n + a */
+static void
+acb_theta_ql_a0_err_worker(slong i, void * varg)
+{
+    acb_theta_ql_a0_err_work_t * work = (acb_theta_ql_a0_err_work_t *) varg;
+    slong g = acb_mat_nrows(work->tau);
+    slong n = 1 << g;
+    slong k = i / n;
+    slong a = i % n;
+    int has_t = !_acb_vec_is_zero(work->t, g);
+    int has_z = !_acb_vec_is_zero(work->z, g);
+    slong nb_der = acb_theta_jet_nb(2, g);
+    acb_ptr x, dth;
+    arb_t err;
+    slong lp;
+
+    x = _acb_vec_init(g);
+    dth = _acb_vec_init(nb_der);
+    arb_init(err);
+
+    if (has_t)
+    {
+        _acb_vec_scalar_mul_ui(x, work->t, g, k % 3, work->prec);
+    }
+    if (has_z && (k >= work->nbt))
+    {
+        _acb_vec_add(x, x, work->z, g, work->prec);
+        lp = FLINT_MAX(ACB_THETA_LOW_PREC, acb_theta_dist_addprec(&work->dist[a]));
+    }
+    else
+    {
+        lp = FLINT_MAX(ACB_THETA_LOW_PREC, acb_theta_dist_addprec(&work->dist0[a]));
+    }
+
+    acb_theta_jet_naive_fixed_ab(dth, a << g, x, work->tau, 2, lp);
+    acb_theta_jet_error_bounds(err, x, work->tau, dth, 0, lp);
+    acb_add_error_arb(&work->r[i], err);
+
+    _acb_vec_clear(x, g);
+    _acb_vec_clear(dth, nb_der);
+    arb_clear(err);
+}
+
 static slong
 acb_theta_ql_split(const arb_mat_t cho)
 {
@@ -46,22 +103,19 @@ acb_theta_ql_a0(acb_ptr r, acb_srcptr t, acb_srcptr z, arb_srcptr dist0,
     int has_z = !_acb_vec_is_zero(z, g);
     slong nbt = (has_t ? 3 : 1);
     slong nbz = (has_z ? 2 : 1);
-    slong nb_der = acb_theta_jet_nb(2, g);
+    acb_theta_ql_a0_err_work_t work;
     arb_mat_t cho;
-    slong split, nb_steps, padding, lp;
+    slong split, nb_steps, padding;
     acb_mat_t tau_mid;
-    acb_ptr t_mid, z_mid, dth;
-    arb_t err;
+    acb_ptr t_mid, z_mid;
     arf_t e;
-    slong k, j, a;
+    slong k, j;
     int res;
 
     arb_mat_init(cho, g, g);
     acb_mat_init(tau_mid, g, g);
     t_mid = _acb_vec_init(g);
     z_mid = _acb_vec_init(g);
-    dth = _acb_vec_init(nb_der);
-    arb_init(err);
     arf_init(e);
 
     acb_siegel_cho(cho, tau, ACB_THETA_LOW_PREC);
@@ -102,41 +156,25 @@ acb_theta_ql_a0(acb_ptr r, acb_srcptr t, acb_srcptr z, arb_srcptr dist0,
     res = acb_theta_ql_a0_steps(r, t_mid, z_mid, dist0, dist, tau_mid, nb_steps,
         split, guard, prec + padding, &acb_theta_ql_a0);
 
-    /* Add error, using z_mid as temp */
-    for (k = 0; (k < nbz * nbt) && res; k++)
+    /* Add error; all vectors and characteristics are independent */
+    if (res)
     {
-        _acb_vec_zero(z_mid, g);
-        if (has_t)
-        {
-            _acb_vec_scalar_mul_ui(t_mid, t, g, k % 3, prec);
-            _acb_vec_add(z_mid, z_mid, t_mid, g, prec);
-        }
-        if (has_z && (k >= nbt))
-        {
-            _acb_vec_add(z_mid, z_mid, z, g, prec);
-        }
-        for (a = 0; a < n; a++)
-        {
-            if (has_z && (k >= nbt))
-            {
-                lp = FLINT_MAX(ACB_THETA_LOW_PREC, acb_theta_dist_addprec(&dist[a]));
-            }
-            else
-            {
-                lp = FLINT_MAX(ACB_THETA_LOW_PREC, acb_theta_dist_addprec(&dist0[a]));
-            }
-            acb_theta_jet_naive_fixed_ab(dth, a << g, z_mid, tau, 2, lp);
-            acb_theta_jet_error_bounds(err, z_mid, tau, dth, 0, lp);
-            acb_add_error_arb(&r[k * n + a], err);
-        }
+        work.r = r;
+        work.t = t;
+        work.z = z;
+        work.dist0 = dist0;
+        work.dist = dist;
+        work.tau = tau;
+        work.nbt = nbt;
+        work.prec = prec;
+        flint_parallel_do(acb_theta_ql_a0_err_worker, &work,
+            nbz * nbt * n, -1, FLINT_PARALLEL_DYNAMIC);
     }
 
     arb_mat_clear(cho);
     acb_mat_clear(tau_mid);
     _acb_vec_clear(t_mid, g);
     _acb_vec_clear(z_mid, g);
-    _acb_vec_clear(dth, nb_der);
-    arb_clear(err);
     arf_clear(e);
     return res;
 }
@@ -9,10 +9,44 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "acb_mat.h"
 #include "acb_modular.h"
 #include "acb_theta.h"
 
+typedef struct
+{
+    acb_ptr th;
+    acb_srcptr x;
+    slong nbt;
+    arb_srcptr d;
+    const acb_mat_struct * tau;
+    slong prec;
+}
+acb_theta_ql_a0_naive_work_t;
+
+/* Theta values for the characteristic (k, 0) at the nbt vectors in x */
+static void
+acb_theta_ql_a0_naive_worker(slong k, void * varg)
+{
+    acb_theta_ql_a0_naive_work_t * work = (acb_theta_ql_a0_naive_work_t *) varg;
+    slong g = acb_mat_nrows(work->tau);
+    slong n = 1 << g;
+    acb_ptr aux;
+    slong j;
+
+    aux = _acb_vec_init(work->nbt);
+
+    acb_theta_naive_fixed_ab(aux, k << g, work->x, work->nbt, work->tau,
+        work->prec + acb_theta_dist_addprec(&work->d[k]));
+    for (j = 0; j < work->nbt; j++)
+    {
+        acb_set(&work->th[j * n + k], &aux[j]);
+    }
+
+    _acb_vec_clear(aux, work->nbt);
+}
+
 static int
 acb_theta_ql_a0_naive_gen(acb_ptr th, acb_srcptr t, acb_srcptr z, arb_srcptr d0,
     arb_srcptr d, const acb_mat_t tau, slong guard, slong prec)
@@ -23,26 +57,27 @@ acb_theta_ql_a0_naive_gen(acb_ptr th, acb_srcptr t, acb_srcptr z, arb_srcptr d0,
     int hasz = !_acb_vec_is_zero(z, g);
     slong nbt = (hast ? 3 : 1);
     slong nbz = (hasz ? 2 : 1);
-    acb_ptr x, aux;
-    slong j, k;
+    acb_theta_ql_a0_naive_work_t work;
+    acb_ptr x;
+    slong k;
     int res;
 
     x = _acb_vec_init(g * nbt);
-    aux = _acb_vec_init(nbt);
 
     for (k = 0; k < nbt; k++)
     {
         _acb_vec_scalar_mul_ui(x + k * g, t, g, k, prec);
     }
-    for (k = 0; k < n; k++)
-    {
-        acb_theta_naive_fixed_ab(aux, k << g, x, nbt, tau,
-            prec + acb_theta_dist_addprec(&d0[k]));
-        for (j = 0; j < nbt; j++)
-        {
-            acb_set(&th[j * n + k], &aux[j]);
-        }
-    }
+
+    /* Characteristics are independent */
+    work.th = th;
+    work.x = x;
+    work.nbt = nbt;
+    work.d = d0;
+    work.tau = tau;
+    work.prec = prec;
+    flint_parallel_do(acb_theta_ql_a0_naive_worker, &work, n, -1,
+        FLINT_PARALLEL_DYNAMIC);
 
     if (hasz)
     {
@@ -50,20 +85,14 @@ acb_theta_ql_a0_naive_gen(acb_ptr th, acb_srcptr t, acb_srcptr z, arb_srcptr d0,
         {
             _acb_vec_add(x + k * g, x + k * g, z, g, prec);
         }
-        for (k = 0; k < n; k++)
-        {
-            acb_theta_naive_fixed_ab(aux, k << g, x, nbt, tau,
-                prec + acb_theta_dist_addprec(&d[k]));
-            for (j = 0; j < nbt; j++)
-            {
-                acb_set(&th[nbt * n + j * n + k], &aux[j]);
-            }
-        }
+        work.th = th + nbt * n;
+        work.d = d;
+        flint_parallel_do(acb_theta_ql_a0_naive_worker, &work, n, -1,
+            FLINT_PARALLEL_DYNAMIC);
     }
     res = _acb_vec_is_finite(th, n * nbz * nbt);
 
     _acb_vec_clear(x, g * nbt);
-    _acb_vec_clear(aux, nbt);
     return res;
 }
 
@@ -9,57 +9,100 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "arb_mat.h"
 #include "acb_mat.h"
 #include "acb_theta.h"
 
-static int
-acb_theta_ql_roots_1(acb_ptr rts, acb_srcptr z, arb_srcptr d,
-    const arb_t f, const acb_mat_t tau, slong nb_steps, slong prec)
+typedef struct
 {
-    slong g = acb_mat_nrows(tau);
+    acb_ptr rts;
+    int * ok;
+    acb_srcptr z;
+    arb_srcptr d;
+    const acb_mat_struct * tau;
+    slong prec;
+}
+acb_theta_ql_roots_work_t;
+
+/* Root for the characteristic a at step k, where i = k n + a */
+static void
+acb_theta_ql_roots_worker(slong i, void * varg)
+{
+    acb_theta_ql_roots_work_t * work = (acb_theta_ql_roots_work_t *) varg;
+    slong g = acb_mat_nrows(work->tau);
     slong n = 1 << g;
+    slong k = i / n;
+    slong a = i % n;
     acb_mat_t w;
     acb_ptr x;
-    arb_t c, h;
+    arb_t h;
     slong hprec, guard;
-    slong k, a;
-    int res = 1;
+    int res = 0;
 
     acb_mat_init(w, g, g);
     x = _acb_vec_init(g);
-    arb_init(c);
     arb_init(h);
 
-    for (k = 0; (k < nb_steps) && res; k++)
-    {
-        acb_mat_scalar_mul_2exp_si(w, tau, k);
-        _acb_vec_scalar_mul_2exp_si(x, z, g, k);
-        arb_mul_2exp_si(c, f, k);
-        arb_exp(c, c, prec);
+    acb_mat_scalar_mul_2exp_si(w, work->tau, k);
+    _acb_vec_scalar_mul_2exp_si(x, work->z, g, k);
+    arb_mul_2exp_si(h, &work->d[a], k);
 
-        for (a = 0; (a < n) && res; a++)
+    for (guard = 16; (guard <= work->prec) && !res; guard += 16)
+    {
+        hprec = guard + acb_theta_dist_addprec(h);
+        acb_theta_naive_fixed_ab(&work->rts[i], a << g, x, 1, w, hprec);
+        if (acb_is_finite(&work->rts[i]) && !acb_contains_zero(&work->rts[i]))
         {
-            arb_mul_2exp_si(h, &d[a], k);
-            res = 0;
-            for (guard = 16; (guard <= prec) && !res; guard += 16)
-            {
-                hprec = guard + acb_theta_dist_addprec(h);
-                acb_theta_naive_fixed_ab(&rts[k * n + a], a << g, x, 1, w, hprec);
-                if (acb_is_finite(&rts[k * n + a]) && !acb_contains_zero(&rts[k * n + a]))
-                {
-                    res = 1;
-                }
-            }
+            res = 1;
         }
-
-        _acb_vec_scalar_mul_arb(rts + k * n, rts + k * n, n, c, prec);
     }
+    work->ok[i] = res;
 
     acb_mat_clear(w);
     _acb_vec_clear(x, g);
-    arb_clear(c);
     arb_clear(h);
+}
+
+static int
+acb_theta_ql_roots_1(acb_ptr rts, acb_srcptr z, arb_srcptr d,
+    const arb_t f, const acb_mat_t tau, slong nb_steps, slong prec)
+{
+    slong g = acb_mat_nrows(tau);
+    slong n = 1 << g;
+    acb_theta_ql_roots_work_t work;
+    int * ok;
+    arb_t c;
+    slong k;
+    int res = 1;
+
+    ok = flint_malloc(nb_steps * n * sizeof(int));
+    arb_init(c);
+
+    /* Steps and characteristics are independent */
+    work.rts = rts;
+    work.ok = ok;
+    work.z = z;
+    work.d = d;
+    work.tau = tau;
+    work.prec = prec;
+    flint_parallel_do(acb_theta_ql_roots_worker, &work, nb_steps * n, -1,
+        FLINT_PARALLEL_DYNAMIC);
+
+    for (k = 0; (k < nb_steps * n) && res; k++)
+    {
+        res = ok[k];
+    }
+
+    for (k = 0; (k < nb_steps) && res; k++)
+    {
+        arb_mul_2exp_si(c, f, k);
+        arb_exp(c, c, prec);
+        _acb_vec_scalar_mul_arb(rts + k * n, rts + k * n, n, c, prec);
+    }
+
+    flint_free(ok);
+    arb_clear(c);
     return res;
 }
 
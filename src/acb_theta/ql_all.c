@@ -9,11 +9,33 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "acb_mat.h"
 #include "acb_theta.h"
 
 #define ACB_THETA_QL_TRY 100
 
+typedef struct
+{
+    acb_ptr rts;
+    acb_srcptr z;
+    arb_srcptr d;
+    const acb_mat_struct * tau;
+    slong guard;
+}
+acb_theta_ql_rts_work_t;
+
+static void
+acb_theta_ql_rts_worker(slong a, void * varg)
+{
+    acb_theta_ql_rts_work_t * work = (acb_theta_ql_rts_work_t *) varg;
+    slong g = acb_mat_nrows(work->tau);
+    slong n = 1 << g;
+    slong hprec = work->guard + acb_theta_dist_addprec(&work->d[a]);
+
+    acb_theta_naive_fixed_a(work->rts + a * n, a, work->z, 1, work->tau, hprec);
+}
+
 static void
 acb_theta_ql_dupl(acb_ptr th2, acb_srcptr th0, acb_srcptr th,
     arb_srcptr d0, arb_srcptr d, slong g, slong prec)
@@ -56,10 +78,10 @@ acb_theta_ql_all_with_t(acb_ptr th, acb_srcptr t, acb_srcptr z, arb_srcptr d0,
     int hast = !_acb_vec_is_zero(t, g);
     slong nbz = (hasz ? 2 : 1);
     slong nbt = (hast ? 3 : 1);
+    acb_theta_ql_rts_work_t work;
     acb_mat_t new_tau;
     acb_ptr rts, new_z, th_a0, aux;
     arb_ptr new_d0, new_d;
-    slong hprec;
     slong k, a;
     int res = 1;
 
@@ -74,10 +96,16 @@ acb_theta_ql_all_with_t(acb_ptr th, acb_srcptr t, acb_srcptr z, arb_srcptr d0,
     /* Collect roots: we only need theta_{a,b}(z + t, tau) */
     _acb_vec_add(new_z, z, t, g, prec);
 
+    work.rts = rts;
+    work.z = new_z;
+    work.d = d;
+    work.tau = tau;
+    work.guard = guard;
+    flint_parallel_do(acb_theta_ql_rts_worker, &work, n, -1,
+        FLINT_PARALLEL_DYNAMIC);
+
     for (a = 0; (a < n) && res; a++)
     {
-        hprec = guard + acb_theta_dist_addprec(&d[a]);
-        acb_theta_naive_fixed_a(rts + a * n, a, new_z, 1, tau, hprec);
         for (k = 0; (k < n) && res; k++)
         {
             /* Ignore theta constants if z = t = 0 */
@@ -19,6 +19,7 @@
 #include "t-agm_mul_tight.c"
 #include "t-agm_sqrt.c"
 #include "t-all.c"
+#include "t-all_threaded.c"
 #include "t-char_dot.c"
 #include "t-char_get_a.c"
 #include "t-char_is_even.c"
@@ -93,6 +94,7 @@ test_struct tests[] =
     TEST_FUNCTION(acb_theta_agm_mul_tight),
     TEST_FUNCTION(acb_theta_agm_sqrt),
     TEST_FUNCTION(acb_theta_all),
+    TEST_FUNCTION(acb_theta_all_threaded),
     TEST_FUNCTION(acb_theta_char_dot),
     TEST_FUNCTION(acb_theta_char_get_a),
     TEST_FUNCTION(acb_theta_char_is_even),
@@ -0,0 +1,108 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "thread_support.h"
+#include "acb_mat.h"
+#include "acb_theta.h"
+
+TEST_FUNCTION_START(acb_theta_all_threaded, state)
+{
+    slong iter, max_threads = 5;
+
+    /* Test: naive_all, ql_all and jet_ql_all agree with one and several
+       threads, and naive_all does not depend on the number of threads */
+    for (iter = 0; iter < 10 * flint_test_multiplier(); iter++)
+    {
+        slong g = 1 + n_randint(state, 3);
+        slong n2 = 1 << (2 * g);
+        slong nbz = 1 + n_randint(state, 3);
+        slong ord = n_randint(state, 2);
+        slong nb = acb_theta_jet_nb(ord, g);
+        slong prec = (g > 1 ? 100 : 500) + n_randint(state, 100);
+        slong bits = n_randint(state, 4);
+        int sqr = n_randint(state, 2);
+        acb_mat_t tau;
+        acb_ptr z, th1, th2, th3;
+
+        acb_mat_init(tau, g, g);
+        z = _acb_vec_init(g * nbz);
+        th1 = _acb_vec_init(n2 * FLINT_MAX(nbz, nb));
+        th2 = _acb_vec_init(n2 * FLINT_MAX(nbz, nb));
+        th3 = _acb_vec_init(n2 * FLINT_MAX(nbz, nb));
+
+        acb_siegel_randtest_reduced(tau, state, prec, bits);
+        acb_siegel_randtest_vec(z, state, g * nbz, prec);
+
+        flint_set_num_threads(1);
+        acb_theta_naive_all(th1, z, nbz, tau, prec);
+        flint_set_num_threads(2 + n_randint(state, max_threads - 1));
+        acb_theta_naive_all(th2, z, nbz, tau, prec);
+        flint_set_num_threads(2 + n_randint(state, max_threads - 1));
+        acb_theta_naive_all(th3, z, nbz, tau, prec);
+
+        if (!_acb_vec_overlaps(th1, th2, n2 * nbz) || !_acb_vec_equal(th2, th3, n2 * nbz))
+        {
+            flint_printf("FAIL (naive_all)\n");
+            flint_printf("g = %wd, prec = %wd, nbz = %wd, tau:\n", g, prec, nbz);
+            acb_mat_printd(tau, 5);
+            _acb_vec_printd(th1, n2 * nbz, 5);
+            _acb_vec_printd(th2, n2 * nbz, 5);
+            _acb_vec_printd(th3, n2 * nbz, 5);
+            flint_abort();
+        }
+
+        flint_set_num_threads(1);
+        acb_theta_ql_all(th1, z, tau, sqr, prec);
+        flint_set_num_threads(2 + n_randint(state, max_threads - 1));
+        acb_theta_ql_all(th2, z, tau, sqr, prec);
+
+        if (!_acb_vec_overlaps(th1, th2, n2))
+        {
+            flint_printf("FAIL (ql_all)\n");
+            flint_printf("g = %wd, prec = %wd, sqr = %wd, tau, z:\n", g, prec, sqr);
+            acb_mat_printd(tau, 5);
+            _acb_vec_printd(z, g, 5);
+            _acb_vec_printd(th1, n2, 5);
+            _acb_vec_printd(th2, n2, 5);
+            flint_abort();
+        }
+
+        if (g <= 2)
+        {
+            flint_set_num_threads(1);
+            acb_theta_jet_ql_all(th1, z, tau, ord, prec);
+            flint_set_num_threads(2 + n_randint(state, max_threads - 1));
+            acb_theta_jet_ql_all(th2, z, tau, ord, prec);
+
+            if (!_acb_vec_overlaps(th1, th2, n2 * nb))
+            {
+                flint_printf("FAIL (jet_ql_all)\n");
+                flint_printf("g = %wd, prec = %wd, ord = %wd, tau, z:\n", g, prec, ord);
+                acb_mat_printd(tau, 5);
+                _acb_vec_printd(z, g, 5);
+                _acb_vec_printd(th1, n2 * nb, 5);
+                _acb_vec_printd(th2, n2 * nb, 5);
+                flint_abort();
+            }
+        }
+
+        flint_set_num_threads(1);
+
+        acb_mat_clear(tau);
+        _acb_vec_clear(z, g * nbz);
+        _acb_vec_clear(th1, n2 * FLINT_MAX(nbz, nb));
+        _acb_vec_clear(th2, n2 * FLINT_MAX(nbz, nb));
+        _acb_vec_clear(th3, n2 * FLINT_MAX(nbz, nb));
+    }
+
+    TEST_FUNCTION_END(state);
+}
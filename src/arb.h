@@ -416,6 +416,14 @@ void arb_dot_precise(arb_t res, const arb_t initial, int subtract,
 void arb_dot(arb_t res, const arb_t initial, int subtract,
     arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec);
 
+#define ARB_DOT_BLOCK_LEN 2048
+#define ARB_DOT_BLOCK_CUTOFF 16384
+
+void _arb_dot_blocked(arb_t res, const arb_t initial, int subtract,
+    arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec);
+void arb_dot_many(arb_ptr res, arb_srcptr x, slong xstep,
+    arb_ptr const * y, slong ystep, slong num, slong len, slong prec);
+
 void arb_approx_dot(arb_t res, const arb_t initial, int subtract,
     arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec);
 
@@ -11,11 +11,142 @@
 
 #include "arb.h"
 
+/* Low-precision kernel for z = x + y rounded towards zero, where x and y
+   have mantissas of one or two limbs and lagom exponents, z has a lagom
+   exponent and prec <= 2 * FLINT_BITS. The exact sum is formed in a
+   three-limb window with one bit of headroom, so the result is identical
+   to that of arf_add with ARF_RND_DOWN. Returns -1 without modifying z if
+   the exponents are too far apart for the window. */
+static inline int
+_arf_add_2x2_lagom(arf_t z, const arf_t x, const arf_t y, slong prec)
+{
+    mp_limb_t a2, a1, a0, b2, b1, b0, r1, r0;
+    slong xn, yn, shift, exp;
+    int asgnbit, bsgnbit;
+    unsigned int c;
+
+    if (ARF_EXP(x) < ARF_EXP(y))
+        FLINT_SWAP(arf_srcptr, x, y);
+
+    shift = ARF_EXP(x) - ARF_EXP(y);
+
+    if (shift >= FLINT_BITS - 1)
+        return -1;
+
+    xn = ARF_SIZE(x);
+    yn = ARF_SIZE(y);
+    a2 = ARF_NOPTR_D(x)[xn - 1];
+    a1 = ARF_NOPTR_D(x)[0] & -(mp_limb_t) (xn - 1);
+    b2 = ARF_NOPTR_D(y)[yn - 1];
+    b1 = ARF_NOPTR_D(y)[0] & -(mp_limb_t) (yn - 1);
+
+    shift++;
+    a0 = a1 << (FLINT_BITS - 1);
+    a1 = (a2 << (FLINT_BITS - 1)) | (a1 >> 1);
+    a2 = a2 >> 1;
+    b0 = b1 << (FLINT_BITS - shift);
+    b1 = (b2 << (FLINT_BITS - shift)) | (b1 >> shift);
+    b2 = b2 >> shift;
+    exp = ARF_EXP(x) + 1;
+    asgnbit = ARF_SGNBIT(x);
+    bsgnbit = ARF_SGNBIT(y);
+
+    if (asgnbit == bsgnbit)
+    {
+        add_sssaaaaaa(a2, a1, a0, a2, a1, a0, b2, b1, b0);
+    }
+    else
+    {
+        sub_dddmmmsss(a2, a1, a0, a2, a1, a0, b2, b1, b0);
+
+        if (a2 >> (FLINT_BITS - 1))
+        {
+            sub_dddmmmsss(a2, a1, a0, 0, 0, 0, a2, a1, a0);
+            asgnbit = bsgnbit;
+        }
+    }
+
+    if (a2 == 0)
+    {
+        if (a1 == 0)
+        {
+            if (a0 == 0)
+            {
+                arf_zero(z);
+                return 0;
+            }
+
+            a1 = a0;
+            a0 = 0;
+            exp -= FLINT_BITS;
+        }
+
+        a2 = a1;
+        a1 = a0;
+        a0 = 0;
+        exp -= FLINT_BITS;
+    }
+
+    c = flint_clz(a2);
+    exp -= c;
+    a2 = (a2 << c) | ((a1 >> 1) >> (FLINT_BITS - 1 - c));
+    a1 = (a1 << c) | ((a0 >> 1) >> (FLINT_BITS - 1 - c));
+    a0 = a0 << c;
+
+    if (prec <= FLINT_BITS)
+    {
+        r1 = MASK_LIMB(a2, FLINT_BITS - prec);
+        r0 = 0;
+    }
+    else
+    {
+        r1 = a2;
+        r0 = MASK_LIMB(a1, 2 * FLINT_BITS - prec);
+    }
+
+    ARF_DEMOTE(z);
+    ARF_EXP(z) = exp;
+
+    if (r0 == 0)
+    {
+        ARF_XSIZE(z) = ARF_MAKE_XSIZE(1, asgnbit);
+        ARF_NOPTR_D(z)[0] = r1;
+    }
+    else
+    {
+        ARF_XSIZE(z) = ARF_MAKE_XSIZE(2, asgnbit);
+        ARF_NOPTR_D(z)[0] = r0;
+        ARF_NOPTR_D(z)[1] = r1;
+    }
+
+    return (r1 != a2) || (r0 != a1) || (a0 != 0);
+}
+
 void
 arb_add(arb_t z, const arb_t x, const arb_t y, slong prec)
 {
+    mag_t zr;
     int inexact;
 
+    if (prec <= 2 * FLINT_BITS &&
+        (ulong) (ARF_SIZE(arb_midref(x)) - 1) < 2 &&
+        (ulong) (ARF_SIZE(arb_midref(y)) - 1) < 2 &&
+        ARB_IS_LAGOM(x) && ARB_IS_LAGOM(y) && ARB_IS_LAGOM(z))
+    {
+        inexact = _arf_add_2x2_lagom(arb_midref(z), arb_midref(x), arb_midref(y), prec);
+
+        if (inexact != -1)
+        {
+            mag_fast_add(zr, arb_radref(x), arb_radref(y));
+
+            if (inexact)
+                arf_mag_fast_add_ulp(zr, zr, arb_midref(z), prec);
+
+            *arb_radref(z) = *zr;
+            return;
+        }
+    }
+
     inexact = arf_add(arb_midref(z), arb_midref(x), arb_midref(y), prec, ARB_RND);
 
     mag_add(arb_radref(z), arb_radref(x), arb_radref(y));
@@ -9,8 +9,275 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "mpn_extras.h"
 #include "arb.h"
 
+/* Low-precision kernel for z = z + x * y rounded towards zero, where x, y
+   and z have single-limb mantissas and lagom exponents and
+   prec <= FLINT_BITS. The exact sum is formed in a three-limb window with
+   one bit of headroom, so the result is identical to that of arf_addmul
+   with ARF_RND_DOWN. Returns -1 without modifying z if the exponents
+   are too far apart for the window. */
+static inline int
+_arf_addmul_1x1_lagom(arf_t z, const arf_t x, const arf_t y, slong prec)
+{
+    mp_limb_t p1, p0, zm, a2, a1, a0, b2, b1, b0, r;
+    slong pexp, shift, exp, fix;
+    int psgnbit, asgnbit, bsgnbit;
+    unsigned int c;
+
+    umul_ppmm(p1, p0, ARF_NOPTR_D(x)[0], ARF_NOPTR_D(y)[0]);
+
+    fix = !(p1 >> (FLINT_BITS - 1));
+    p1 = (p1 << fix) | ((p0 >> (FLINT_BITS - 1)) & fix);
+    p0 = p0 << fix;
+    pexp = ARF_EXP(x) + ARF_EXP(y) - fix;
+    psgnbit = ARF_SGNBIT(x) ^ ARF_SGNBIT(y);
+
+    zm = ARF_NOPTR_D(z)[0];
+    shift = pexp - ARF_EXP(z);
+
+    if (shift >= 0)
+    {
+        if (shift >= FLINT_BITS - 1)
+            return -1;
+
+        shift++;
+        a2 = p1 >> 1;
+        a1 = (p1 << (FLINT_BITS - 1)) | (p0 >> 1);
+        a0 = p0 << (FLINT_BITS - 1);
+        b2 = zm >> shift;
+        b1 = zm << (FLINT_BITS - shift);
+        b0 = 0;
+        exp = pexp + 1;
+        asgnbit = psgnbit;
+        bsgnbit = ARF_SGNBIT(z);
+    }
+    else
+    {
+        if (shift <= -(FLINT_BITS - 1))
+            return -1;
+
+        shift = 1 - shift;
+        a2 = zm >> 1;
+        a1 = zm << (FLINT_BITS - 1);
+        a0 = 0;
+        b2 = p1 >> shift;
+        b1 = (p1 << (FLINT_BITS - shift)) | (p0 >> shift);
+        b0 = p0 << (FLINT_BITS - shift);
+        exp = ARF_EXP(z) + 1;
+        asgnbit = ARF_SGNBIT(z);
+        bsgnbit = psgnbit;
+    }
+
+    if (asgnbit == bsgnbit)
+    {
+        add_sssaaaaaa(a2, a1, a0, a2, a1, a0, b2, b1, b0);
+    }
+    else
+    {
+        sub_dddmmmsss(a2, a1, a0, a2, a1, a0, b2, b1, b0);
+
+        if (a2 >> (FLINT_BITS - 1))
+        {
+            sub_dddmmmsss(a2, a1, a0, 0, 0, 0, a2, a1, a0);
+            asgnbit = bsgnbit;
+        }
+    }
+
+    if (a2 == 0)
+    {
+        if (a1 == 0)
+        {
+            if (a0 == 0)
+            {
+                arf_zero(z);
+                return 0;
+            }
+
+            a1 = a0;
+            a0 = 0;
+            exp -= FLINT_BITS;
+        }
+
+        a2 = a1;
+        a1 = a0;
+        a0 = 0;
+        exp -= FLINT_BITS;
+    }
+
+    c = flint_clz(a2);
+    exp -= c;
+    a2 = (a2 << c) | ((a1 >> 1) >> (FLINT_BITS - 1 - c));
+    a1 = a1 << c;
+
+    r = MASK_LIMB(a2, FLINT_BITS - prec);
+
+    ARF_EXP(z) = exp;
+    ARF_XSIZE(z) = ARF_MAKE_XSIZE(1, asgnbit);
+    ARF_NOPTR_D(z)[0] = r;
+
+    return (r != a2) || (a1 != 0) || (a0 != 0);
+}
+
+/* As above, but for x, y and z with mantissas of one or two limbs and
+   prec <= 2 * FLINT_BITS. The four-limb product and z are added in a
+   five-limb window with one bit of headroom. The smaller operand never
+   reaches the two low limbs of the window unless the larger operand
+   leaves them zero, so three-limb additions suffice. */
+static inline int
+_arf_addmul_2x2_lagom(arf_t z, const arf_t x, const arf_t y, slong prec)
+{
+    mp_limb_t x1, x0, y1, y0, z1, z0, p3, p2, p1, p0, r1, r0;
+    mp_limb_t a4, a3, a2, a1, a0, b4, b3, b2, b1, b0, borrow;
+    slong xn, yn, zn, pexp, shift, exp, fix;
+    int psgnbit, asgnbit, bsgnbit;
+    unsigned int c;
+
+    xn = ARF_SIZE(x);
+    yn = ARF_SIZE(y);
+    zn = ARF_SIZE(z);
+    x1 = ARF_NOPTR_D(x)[xn - 1];
+    x0 = ARF_NOPTR_D(x)[0] & -(mp_limb_t) (xn - 1);
+    y1 = ARF_NOPTR_D(y)[yn - 1];
+    y0 = ARF_NOPTR_D(y)[0] & -(mp_limb_t) (yn - 1);
+    z1 = ARF_NOPTR_D(z)[zn - 1];
+    z0 = ARF_NOPTR_D(z)[0] & -(mp_limb_t) (zn - 1);
+
+    flint_mpn_mul_2x2(p3, p2, p1, p0, x1, x0, y1, y0);
+
+    fix = !(p3 >> (FLINT_BITS - 1));
+    p3 = (p3 << fix) | ((p2 >> (FLINT_BITS - 1)) & fix);
+    p2 = (p2 << fix) | ((p1 >> (FLINT_BITS - 1)) & fix);
+    p1 = (p1 << fix) | ((p0 >> (FLINT_BITS - 1)) & fix);
+    p0 = p0 << fix;
+    pexp = ARF_EXP(x) + ARF_EXP(y) - fix;
+    psgnbit = ARF_SGNBIT(x) ^ ARF_SGNBIT(y);
+
+    shift = pexp - ARF_EXP(z);
+
+    if (shift >= 0)
+    {
+        if (shift >= FLINT_BITS - 1)
+            return -1;
+
+        shift++;
+        a4 = p3 >> 1;
+        a3 = (p3 << (FLINT_BITS - 1)) | (p2 >> 1);
+        a2 = (p2 << (FLINT_BITS - 1)) | (p1 >> 1);
+        a1 = (p1 << (FLINT_BITS - 1)) | (p0 >> 1);
+        a0 = p0 << (FLINT_BITS - 1);
+        b4 = z1 >> shift;
+        b3 = (z1 << (FLINT_BITS - shift)) | (z0 >> shift);
+        b2 = z0 << (FLINT_BITS - shift);
+        b1 = 0;
+        b0 = 0;
+        exp = pexp + 1;
+        asgnbit = psgnbit;
+        bsgnbit = ARF_SGNBIT(z);
+    }
+    else
+    {
+        if (shift <= -(FLINT_BITS - 1))
+            return -1;
+
+        shift = 1 - shift;
+        a4 = z1 >> 1;
+        a3 = (z1 << (FLINT_BITS - 1)) | (z0 >> 1);
+        a2 = z0 << (FLINT_BITS - 1);
+        a1 = 0;
+        a0 = 0;
+        b4 = p3 >> shift;
+        b3 = (p3 << (FLINT_BITS - shift)) | (p2 >> shift);
+        b2 = (p2 << (FLINT_BITS - shift)) | (p1 >> shift);
+        b1 = (p1 << (FLINT_BITS - shift)) | (p0 >> shift);
+        b0 = p0 << (FLINT_BITS - shift);
+        exp = ARF_EXP(z) + 1;
+        asgnbit = ARF_SGNBIT(z);
+        bsgnbit = psgnbit;
+    }
+
+    /* at most one of (a1, a0) and (b1, b0) is nonzero */
+    if (asgnbit == bsgnbit)
+    {
+        add_sssaaaaaa(a4, a3, a2, a4, a3, a2, b4, b3, b2);
+        a1 |= b1;
+        a0 |= b0;
+    }
+    else
+    {
+        borrow = (b1 | b0) != 0;
+        sub_ddmmss(a1, a0, a1, a0, b1, b0);
+        sub_dddmmmsss(a4, a3, a2, a4, a3, a2, b4, b3, b2);
+        sub_dddmmmsss(a4, a3, a2, a4, a3, a2, 0, 0, borrow);
+
+        if (a4 >> (FLINT_BITS - 1))
+        {
+            borrow = (a1 | a0) != 0;
+            sub_ddmmss(a1, a0, 0, 0, a1, a0);
+            sub_dddmmmsss(a4, a3, a2, 0, 0, 0, a4, a3, a2);
+            sub_dddmmmsss(a4, a3, a2, a4, a3, a2, 0, 0, borrow);
+            asgnbit = bsgnbit;
+        }
+    }
+
+    if ((a4 | a3 | a2 | a1 | a0) == 0)
+    {
+        arf_zero(z);
+        return 0;
+    }
+
+    while (a4 == 0)
+    {
+        a4 = a3;
+        a3 = a2;
+        a2 = a1;
+        a1 = a0;
+        a0 = 0;
+        exp -= FLINT_BITS;
+    }
+
+    c = flint_clz(a4);
+    exp -= c;
+    a4 = (a4 << c) | ((a3 >> 1) >> (FLINT_BITS - 1 - c));
+    a3 = (a3 << c) | ((a2 >> 1) >> (FLINT_BITS - 1 - c));
+    a2 = (a2 << c) | ((a1 >> 1) >> (FLINT_BITS - 1 - c));
+    a1 = (a1 << c) | ((a0 >> 1) >> (FLINT_BITS - 1 - c));
+    a0 = a0 << c;
+
+    if (prec <= FLINT_BITS)
+    {
+        r1 = MASK_LIMB(a4, FLINT_BITS - prec);
+        r0 = 0;
+    }
+    else
+    {
+        r1 = a4;
+        r0 = MASK_LIMB(a3, 2 * FLINT_BITS - prec);
+    }
+
+    ARF_EXP(z) = exp;
+
+    if (r0 == 0)
+    {
+        ARF_XSIZE(z) = ARF_MAKE_XSIZE(1, asgnbit);
+        ARF_NOPTR_D(z)[0] = r1;
+    }
+    else
+    {
+        ARF_XSIZE(z) = ARF_MAKE_XSIZE(2, asgnbit);
+        ARF_NOPTR_D(z)[0] = r0;
+        ARF_NOPTR_D(z)[1] = r1;
+    }
+
+    return (r1 != a4) || (r0 != a3) || ((a2 | a1 | a0) != 0);
+}
+
+/* x, y and z have nonzero mantissas of at most two limbs */
+#define ARF_ADDMUL_2X2_OK(z, x, y) \
+    ((ulong) (ARF_SIZE(x) - 1) < 2 && (ulong) (ARF_SIZE(y) - 1) < 2 && \
+     (ulong) (ARF_SIZE(z) - 1) < 2)
+
 void
 arb_addmul_arf(arb_t z, const arb_t x, const arf_t y, slong prec)
 {
@@ -28,7 +295,16 @@ arb_addmul_arf(arb_t z, const arb_t x, const arf_t y, slong prec)
     {
         mag_fast_init_set_arf(ym, y);
         mag_fast_addmul(arb_radref(z), ym, arb_radref(x));
-        inexact = arf_addmul(arb_midref(z), arb_midref(x), y, prec, ARB_RND);
+
+        inexact = -1;
+        if (prec <= FLINT_BITS && ARF_SIZE(arb_midref(x)) == 1 &&
+                ARF_SIZE(y) == 1 && ARF_SIZE(arb_midref(z)) == 1)
+            inexact = _arf_addmul_1x1_lagom(arb_midref(z), arb_midref(x), y, prec);
+        else if (prec <= 2 * FLINT_BITS && ARF_ADDMUL_2X2_OK(arb_midref(z), arb_midref(x), y))
+            inexact = _arf_addmul_2x2_lagom(arb_midref(z), arb_midref(x), y, prec);
+
+        if (inexact == -1)
+            inexact = arf_addmul(arb_midref(z), arb_midref(x), y, prec, ARB_RND);
 
         if (inexact)
             arf_mag_fast_add_ulp(arb_radref(z), arb_radref(z), arb_midref(z), prec);
@@ -77,8 +353,17 @@ arb_addmul(arb_t z, const arb_t x, const arb_t y, slong prec)
         mag_fast_addmul(zr, ym, arb_radref(x));
         mag_fast_addmul(zr, arb_radref(x), arb_radref(y));
 
-        inexact = arf_addmul(arb_midref(z), arb_midref(x), arb_midref(y),
-            prec, ARF_RND_DOWN);
+        inexact = -1;
+        if (prec <= FLINT_BITS && ARF_SIZE(arb_midref(x)) == 1 &&
+                ARF_SIZE(arb_midref(y)) == 1 && ARF_SIZE(arb_midref(z)) == 1)
+            inexact = _arf_addmul_1x1_lagom(arb_midref(z), arb_midref(x), arb_midref(y), prec);
+        else if (prec <= 2 * FLINT_BITS &&
+                ARF_ADDMUL_2X2_OK(arb_midref(z), arb_midref(x), arb_midref(y)))
+            inexact = _arf_addmul_2x2_lagom(arb_midref(z), arb_midref(x), arb_midref(y), prec);
+
+        if (inexact == -1)
+            inexact = arf_addmul(arb_midref(z), arb_midref(x), arb_midref(y),
+                prec, ARF_RND_DOWN);
 
         if (inexact)
             arf_mag_fast_add_ulp(zr, zr, arb_midref(z), prec);
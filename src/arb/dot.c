@@ -418,6 +418,12 @@ arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep,
         }
     }
 
+    if (len >= ARB_DOT_BLOCK_CUTOFF)
+    {
+        _arb_dot_blocked(res, initial, subtract, x, xstep, y, ystep, len, prec);
+        return;
+    }
+
     /* Number of nonzero midpoint terms in sum. */
     nonzero = 0;
 
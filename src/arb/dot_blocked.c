@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "arb.h"
+
+typedef struct
+{
+    arb_ptr partial;
+    arb_srcptr x;
+    slong xstep;
+    arb_srcptr y;
+    slong ystep;
+    slong len;
+    slong prec;
+}
+dot_blocked_work_t;
+
+static void
+_arb_dot_block_worker(slong j, void * args)
+{
+    dot_blocked_work_t * w = (dot_blocked_work_t *) args;
+    slong start = j * ARB_DOT_BLOCK_LEN;
+
+    arb_dot(w->partial + j, NULL, 0, w->x + start * w->xstep, w->xstep,
+        w->y + start * w->ystep, w->ystep,
+        FLINT_MIN(ARB_DOT_BLOCK_LEN, w->len - start), w->prec);
+}
+
+void
+_arb_dot_blocked(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec)
+{
+    dot_blocked_work_t work;
+    slong j, num_blocks, wp;
+    arb_ptr partial;
+
+    num_blocks = (len + ARB_DOT_BLOCK_LEN - 1) / ARB_DOT_BLOCK_LEN;
+
+    /* the partial sums are combined with a few guard bits so that the
+       extra rounding is negligible compared to the final rounding */
+    wp = prec + FLINT_BIT_COUNT(num_blocks) + 8;
+
+    partial = _arb_vec_init(num_blocks);
+
+    work.partial = partial;
+    work.x = x;
+    work.xstep = xstep;
+    work.y = y;
+    work.ystep = ystep;
+    work.len = len;
+    work.prec = wp;
+
+    if (flint_get_num_threads() >= 2)
+    {
+        flint_parallel_do(_arb_dot_block_worker, &work, num_blocks, 0, FLINT_PARALLEL_UNIFORM);
+    }
+    else
+    {
+        for (j = 0; j < num_blocks; j++)
+            _arb_dot_block_worker(j, &work);
+    }
+
+    for (j = 1; j < num_blocks; j++)
+        arb_add(partial, partial, partial + j, wp);
+
+    if (initial == NULL)
+    {
+        if (subtract)
+            arb_neg_round(res, partial, prec);
+        else
+            arb_set_round(res, partial, prec);
+    }
+    else
+    {
+        if (subtract)
+            arb_sub(res, initial, partial, prec);
+        else
+            arb_add(res, initial, partial, prec);
+    }
+
+    _arb_vec_clear(partial, num_blocks);
+}
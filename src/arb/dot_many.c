@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "arb.h"
+
+typedef struct
+{
+    arb_ptr res;
+    arb_srcptr x;
+    slong xstep;
+    arb_ptr const * y;
+    slong ystep;
+    slong num;
+    slong len;
+    slong prec;
+    slong chunk;
+}
+dot_many_work_t;
+
+/* Computes the dot products with index in [j0, j1). For long vectors,
+   x is traversed in blocks so that each block stays in cache while it
+   is multiplied by all the y vectors. */
+static void
+_arb_dot_many_range(const dot_many_work_t * w, slong j0, slong j1)
+{
+    slong i, j, n, wp;
+
+    if (w->len <= ARB_DOT_BLOCK_LEN)
+    {
+        for (j = j0; j < j1; j++)
+            arb_dot(w->res + j, NULL, 0, w->x, w->xstep, w->y[j], w->ystep, w->len, w->prec);
+        return;
+    }
+
+    wp = w->prec + FLINT_BIT_COUNT(w->len / ARB_DOT_BLOCK_LEN) + 8;
+
+    for (i = 0; i < w->len; i += ARB_DOT_BLOCK_LEN)
+    {
+        n = FLINT_MIN(ARB_DOT_BLOCK_LEN, w->len - i);
+
+        for (j = j0; j < j1; j++)
+            arb_dot(w->res + j, (i == 0) ? NULL : w->res + j, 0,
+                w->x + i * w->xstep, w->xstep, w->y[j] + i * w->ystep, w->ystep, n, wp);
+    }
+
+    for (j = j0; j < j1; j++)
+        arb_set_round(w->res + j, w->res + j, w->prec);
+}
+
+static void
+_arb_dot_many_worker(slong b, void * args)
+{
+    dot_many_work_t * w = (dot_many_work_t *) args;
+
+    _arb_dot_many_range(w, b * w->chunk, FLINT_MIN(w->num, (b + 1) * w->chunk));
+}
+
+void
+arb_dot_many(arb_ptr res, arb_srcptr x, slong xstep, arb_ptr const * y, slong ystep, slong num, slong len, slong prec)
+{
+    dot_many_work_t work;
+    slong num_threads;
+
+    if (num <= 0)
+        return;
+
+    if (len <= 0)
+    {
+        _arb_vec_zero(res, num);
+        return;
+    }
+
+    work.res = res;
+    work.x = x;
+    work.xstep = xstep;
+    work.y = y;
+    work.ystep = ystep;
+    work.num = num;
+    work.len = len;
+    work.prec = prec;
+
+    num_threads = flint_get_num_threads();
+
+    if (num_threads >= 2 && num >= 2 && num * (double) len >= ARB_DOT_BLOCK_CUTOFF)
+    {
+        work.chunk = (num + num_threads - 1) / num_threads;
+        flint_parallel_do(_arb_dot_many_worker, &work,
+            (num + work.chunk - 1) / work.chunk, 0, FLINT_PARALLEL_UNIFORM);
+    }
+    else
+    {
+        _arb_dot_many_range(&work, 0, num);
+    }
+}
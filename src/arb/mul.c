@@ -9,8 +9,99 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "mpn_extras.h"
 #include "arb.h"
 
+/* Low-precision kernel for z = x * y rounded towards zero, where x and y
+   have single-limb mantissas and lagom exponents, z has a lagom exponent
+   and prec <= FLINT_BITS. Equivalent to arf_mul with ARF_RND_DOWN. */
+static inline int
+_arf_mul_1x1_lagom(arf_t z, const arf_t x, const arf_t y, slong prec)
+{
+    mp_limb_t hi, lo, r;
+    slong fix;
+    int sgnbit;
+
+    sgnbit = ARF_SGNBIT(x) ^ ARF_SGNBIT(y);
+    umul_ppmm(hi, lo, ARF_NOPTR_D(x)[0], ARF_NOPTR_D(y)[0]);
+
+    fix = !(hi >> (FLINT_BITS - 1));
+    hi = (hi << fix) | ((lo >> (FLINT_BITS - 1)) & fix);
+    lo = lo << fix;
+
+    r = MASK_LIMB(hi, FLINT_BITS - prec);
+
+    fix = ARF_EXP(x) + ARF_EXP(y) - fix;
+    ARF_DEMOTE(z);
+    ARF_EXP(z) = fix;
+    ARF_XSIZE(z) = ARF_MAKE_XSIZE(1, sgnbit);
+    ARF_NOPTR_D(z)[0] = r;
+
+    return (r != hi) || (lo != 0);
+}
+
+/* Low-precision kernel for z = x * y rounded towards zero, where x and y
+   have mantissas of one or two limbs and lagom exponents, z has a lagom
+   exponent and prec <= 2 * FLINT_BITS. A single-limb operand is read as
+   a two-limb one with a zero low limb. Equivalent to arf_mul with
+   ARF_RND_DOWN. */
+static inline int
+_arf_mul_2x2_lagom(arf_t z, const arf_t x, const arf_t y, slong prec)
+{
+    mp_limb_t x1, x0, y1, y0, p3, p2, p1, p0, r1, r0;
+    slong xn, yn, fix;
+    int sgnbit;
+
+    xn = ARF_SIZE(x);
+    yn = ARF_SIZE(y);
+    x1 = ARF_NOPTR_D(x)[xn - 1];
+    x0 = ARF_NOPTR_D(x)[0] & -(mp_limb_t) (xn - 1);
+    y1 = ARF_NOPTR_D(y)[yn - 1];
+    y0 = ARF_NOPTR_D(y)[0] & -(mp_limb_t) (yn - 1);
+
+    sgnbit = ARF_SGNBIT(x) ^ ARF_SGNBIT(y);
+    flint_mpn_mul_2x2(p3, p2, p1, p0, x1, x0, y1, y0);
+
+    fix = !(p3 >> (FLINT_BITS - 1));
+    p3 = (p3 << fix) | ((p2 >> (FLINT_BITS - 1)) & fix);
+    p2 = (p2 << fix) | ((p1 >> (FLINT_BITS - 1)) & fix);
+    p1 = (p1 << fix) | ((p0 >> (FLINT_BITS - 1)) & fix);
+    p0 = p0 << fix;
+
+    if (prec <= FLINT_BITS)
+    {
+        r1 = MASK_LIMB(p3, FLINT_BITS - prec);
+        r0 = 0;
+    }
+    else
+    {
+        r1 = p3;
+        r0 = MASK_LIMB(p2, 2 * FLINT_BITS - prec);
+    }
+
+    fix = ARF_EXP(x) + ARF_EXP(y) - fix;
+    ARF_DEMOTE(z);
+    ARF_EXP(z) = fix;
+
+    if (r0 == 0)
+    {
+        ARF_XSIZE(z) = ARF_MAKE_XSIZE(1, sgnbit);
+        ARF_NOPTR_D(z)[0] = r1;
+    }
+    else
+    {
+        ARF_XSIZE(z) = ARF_MAKE_XSIZE(2, sgnbit);
+        ARF_NOPTR_D(z)[0] = r0;
+        ARF_NOPTR_D(z)[1] = r1;
+    }
+
+    return (r1 != p3) || (r0 != p2) || ((p1 | p0) != 0);
+}
+
+/* x and y have nonzero mantissas of at most two limbs */
+#define ARF_MUL_2X2_OK(x, y) \
+    ((ulong) (ARF_SIZE(x) - 1) < 2 && (ulong) (ARF_SIZE(y) - 1) < 2)
+
 void
 arb_mul_arf(arb_t z, const arb_t x, const arf_t y, slong prec)
 {
@@ -33,7 +124,12 @@ arb_mul_arf(arb_t z, const arb_t x, const arf_t y, slong prec)
 
         mag_fast_mul(zr, ym, arb_radref(x));
 
-        inexact = arf_mul(arb_midref(z), arb_midref(x), y, prec, ARB_RND);
+        if (prec <= FLINT_BITS && ARF_SIZE(arb_midref(x)) == 1 && ARF_SIZE(y) == 1)
+            inexact = _arf_mul_1x1_lagom(arb_midref(z), arb_midref(x), y, prec);
+        else if (prec <= 2 * FLINT_BITS && ARF_MUL_2X2_OK(arb_midref(x), y))
+            inexact = _arf_mul_2x2_lagom(arb_midref(z), arb_midref(x), y, prec);
+        else
+            inexact = arf_mul(arb_midref(z), arb_midref(x), y, prec, ARB_RND);
 
         if (inexact)
             arf_mag_fast_add_ulp(zr, zr, arb_midref(z), prec);
@@ -93,7 +189,12 @@ arb_mul(arb_t z, const arb_t x, const arb_t y, slong prec)
         mag_fast_addmul(zr, ym, arb_radref(x));
         mag_fast_addmul(zr, arb_radref(x), arb_radref(y));
 
-        inexact = arf_mul(arb_midref(z), arb_midref(x), arb_midref(y), prec, ARB_RND);
+        if (prec <= FLINT_BITS && ARF_SIZE(arb_midref(x)) == 1 && ARF_SIZE(arb_midref(y)) == 1)
+            inexact = _arf_mul_1x1_lagom(arb_midref(z), arb_midref(x), arb_midref(y), prec);
+        else if (prec <= 2 * FLINT_BITS && ARF_MUL_2X2_OK(arb_midref(x), arb_midref(y)))
+            inexact = _arf_mul_2x2_lagom(arb_midref(z), arb_midref(x), arb_midref(y), prec);
+        else
+            inexact = arf_mul(arb_midref(z), arb_midref(x), arb_midref(y), prec, ARB_RND);
 
         if (inexact)
             arf_mag_fast_add_ulp(zr, zr, arb_midref(z), prec);
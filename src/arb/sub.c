@@ -16,6 +16,19 @@ arb_sub(arb_t z, const arb_t x, const arb_t y, slong prec)
 {
     int inexact;
 
+    /* use the fast path of arb_add; a lagom ball with a midpoint of one
+       or two limbs owns no heap data, so a shallow copy can be negated */
+    if (prec <= 2 * FLINT_BITS &&
+        (ulong) (ARF_SIZE(arb_midref(x)) - 1) < 2 &&
+        (ulong) (ARF_SIZE(arb_midref(y)) - 1) < 2 &&
+        ARB_IS_LAGOM(x) && ARB_IS_LAGOM(y) && ARB_IS_LAGOM(z))
+    {
+        arb_struct t = *y;
+        ARF_XSIZE(arb_midref(&t)) ^= 1;
+        arb_add(z, x, &t, prec);
+        return;
+    }
+
     inexact = arf_sub(arb_midref(z), arb_midref(x), arb_midref(y), prec, ARB_RND);
 
     mag_add(arb_radref(z), arb_radref(x), arb_radref(y));
@@ -24,6 +24,7 @@
 #include "t-addmul_arf.c"
 #include "t-addmul.c"
 #include "t-addmul_fmpz.c"
+#include "t-addmul_lowprec.c"
 #include "t-addmul_si.c"
 #include "t-addmul_ui.c"
 #include "t-add_si.c"
@@ -88,6 +89,7 @@
 #include "t-div_ui.c"
 #include "t-dot.c"
 #include "t-dot_fmpz.c"
+#include "t-dot_many.c"
 #include "t-dot_si.c"
 #include "t-dot_siui.c"
 #include "t-dot_ui.c"
@@ -231,6 +233,7 @@ test_struct tests[] =
     TEST_FUNCTION(arb_addmul_arf),
     TEST_FUNCTION(arb_addmul),
     TEST_FUNCTION(arb_addmul_fmpz),
+    TEST_FUNCTION(arb_addmul_lowprec),
     TEST_FUNCTION(arb_addmul_si),
     TEST_FUNCTION(arb_addmul_ui),
     TEST_FUNCTION(arb_add_si),
@@ -295,6 +298,7 @@ test_struct tests[] =
     TEST_FUNCTION(arb_div_ui),
     TEST_FUNCTION(arb_dot),
     TEST_FUNCTION(arb_dot_fmpz),
+    TEST_FUNCTION(arb_dot_many),
     TEST_FUNCTION(arb_dot_si),
     TEST_FUNCTION(arb_dot_siui),
     TEST_FUNCTION(arb_dot_ui),
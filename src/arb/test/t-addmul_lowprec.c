@@ -0,0 +1,159 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "arb.h"
+
+/* random ball with a midpoint of one or two limbs */
+static void
+_arb_randtest_lowprec(arb_t x, flint_rand_t state, slong prec)
+{
+    arf_randtest(arb_midref(x), state, 1 + n_randint(state, FLINT_MIN(prec, 2 * FLINT_BITS)), 6);
+    arf_mul_2exp_si(arb_midref(x), arb_midref(x), (slong) n_randint(state, 140) - 70);
+
+    if (n_randint(state, 4) == 0)
+        mag_zero(arb_radref(x));
+    else
+        mag_randtest(arb_radref(x), state, 8);
+}
+
+TEST_FUNCTION_START(arb_addmul_lowprec, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 100000 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        arb_t a, b, c, d;
+        arf_t t, u;
+        slong prec;
+        int alias;
+
+        arb_init(a);
+        arb_init(b);
+        arb_init(c);
+        arb_init(d);
+        arf_init(t);
+        arf_init(u);
+
+        prec = 2 + n_randint(state, 2 * FLINT_BITS - 1);
+
+        _arb_randtest_lowprec(a, state, prec);
+        _arb_randtest_lowprec(b, state, prec);
+        _arb_randtest_lowprec(c, state, prec);
+
+        alias = n_randint(state, 5);
+
+        /* exercise cancellation and the edges of the exponent window */
+        if (n_randint(state, 2) && !arf_is_zero(arb_midref(a)) &&
+            !arf_is_zero(arb_midref(b)) && !arf_is_zero(arb_midref(c)))
+        {
+            slong shift;
+
+            if (alias >= 3)
+                shift = ARF_EXP(arb_midref(b)) - ARF_EXP(arb_midref(c));
+            else
+                shift = ARF_EXP(arb_midref(a)) + ARF_EXP(arb_midref(b)) - ARF_EXP(arb_midref(c));
+
+            if (n_randint(state, 2))
+                shift += (slong) n_randint(state, 7) - 3;
+            else
+                shift += (slong) n_randint(state, 2 * FLINT_BITS + 16) - FLINT_BITS - 8;
+
+            arf_mul_2exp_si(arb_midref(c), arb_midref(c), shift);
+        }
+
+        arb_set(d, c);
+
+        /* reference midpoints */
+        arf_mul(t, arb_midref(a), arb_midref(b), ARF_PREC_EXACT, ARF_RND_DOWN);
+        arf_add(u, arb_midref(c), t, ARF_PREC_EXACT, ARF_RND_DOWN);
+        arf_set_round(t, t, prec, ARF_RND_DOWN);
+
+        if (alias == 0)
+        {
+            arb_addmul(d, a, b, prec);
+        }
+        else if (alias == 3)
+        {
+            /* c + b, with the output aliasing the second operand */
+            arb_set(d, b);
+            arb_add(d, c, d, prec);
+            arf_add(u, arb_midref(c), arb_midref(b), ARF_PREC_EXACT, ARF_RND_DOWN);
+        }
+        else if (alias == 4)
+        {
+            arb_sub(d, d, b, prec);
+            arf_sub(u, arb_midref(c), arb_midref(b), ARF_PREC_EXACT, ARF_RND_DOWN);
+        }
+        else if (alias == 1)
+        {
+            arb_set(d, a);
+            arb_mul(d, d, b, prec);
+        }
+        else
+        {
+            arb_set(d, c);
+            arb_addmul_arf(d, a, arb_midref(b), prec);
+        }
+
+        if (alias == 1)
+        {
+            if (!arf_equal(arb_midref(d), t) || !arb_contains_arf(d, t))
+            {
+                flint_printf("FAIL: mul\n\n");
+                flint_printf("prec = %wd\n\n", prec);
+                flint_printf("a = "); arb_printd(a, 30); flint_printf("\n\n");
+                flint_printf("b = "); arb_printd(b, 30); flint_printf("\n\n");
+                flint_printf("d = "); arb_printd(d, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+
+            arf_mul(t, arb_midref(a), arb_midref(b), ARF_PREC_EXACT, ARF_RND_DOWN);
+        }
+        else
+        {
+            arf_set(t, u);
+            arf_set_round(u, u, prec, ARF_RND_DOWN);
+
+            if (!arf_equal(arb_midref(d), u))
+            {
+                flint_printf("FAIL: addmul midpoint (%d)\n\n", alias);
+                flint_printf("prec = %wd\n\n", prec);
+                flint_printf("a = "); arb_printd(a, 30); flint_printf("\n\n");
+                flint_printf("b = "); arb_printd(b, 30); flint_printf("\n\n");
+                flint_printf("c = "); arb_printd(c, 30); flint_printf("\n\n");
+                flint_printf("d = "); arb_printd(d, 30); flint_printf("\n\n");
+                flint_printf("u = "); arf_printd(u, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        if (!arb_contains_arf(d, t))
+        {
+            flint_printf("FAIL: containment (%d)\n\n", alias);
+            flint_printf("prec = %wd\n\n", prec);
+            flint_printf("a = "); arb_printd(a, 30); flint_printf("\n\n");
+            flint_printf("b = "); arb_printd(b, 30); flint_printf("\n\n");
+            flint_printf("c = "); arb_printd(c, 30); flint_printf("\n\n");
+            flint_printf("d = "); arb_printd(d, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        arb_clear(a);
+        arb_clear(b);
+        arb_clear(c);
+        arb_clear(d);
+        arf_clear(t);
+        arf_clear(u);
+    }
+
+    TEST_FUNCTION_END(state);
+}
@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "arb.h"
+
+TEST_FUNCTION_START(arb_dot_many, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 300 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        arb_ptr x, y, res;
+        arb_ptr * yrows;
+        arb_t s, t;
+        slong i, j, num, len, prec, xstep, ystep;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        num = n_randint(state, 8);
+
+        if (n_randint(state, 8) == 0)
+            len = ARB_DOT_BLOCK_CUTOFF + n_randint(state, 2 * ARB_DOT_BLOCK_LEN);
+        else if (n_randint(state, 4) == 0)
+            len = n_randint(state, 3 * ARB_DOT_BLOCK_LEN);
+        else
+            len = n_randint(state, 50);
+
+        prec = 2 + n_randint(state, 300);
+        xstep = n_randint(state, 2) ? 1 : -1;
+        ystep = n_randint(state, 2) ? 1 : -1;
+
+        x = _arb_vec_init(len);
+        y = _arb_vec_init(num * len);
+        res = _arb_vec_init(num);
+        yrows = flint_malloc(sizeof(arb_ptr) * (num + 1));
+        arb_init(s);
+        arb_init(t);
+
+        for (i = 0; i < len; i++)
+            arb_randtest(x + i, state, 2 + n_randint(state, 300), 4);
+        for (i = 0; i < num * len; i++)
+            arb_randtest(y + i, state, 2 + n_randint(state, 300), 4);
+
+        for (j = 0; j < num; j++)
+            yrows[j] = y + j * len + (ystep == 1 ? 0 : FLINT_MAX(len - 1, 0));
+
+        arb_dot_many(res, x + (xstep == 1 ? 0 : FLINT_MAX(len - 1, 0)), xstep,
+            yrows, ystep, num, len, prec);
+
+        for (j = 0; j < num; j++)
+        {
+            arb_dot_simple(s, NULL, 0, x + (xstep == 1 ? 0 : FLINT_MAX(len - 1, 0)), xstep,
+                yrows[j], ystep, len, prec);
+
+            if (!arb_overlaps(res + j, s))
+            {
+                flint_printf("FAIL: arb_dot_many\n\n");
+                flint_printf("num = %wd, len = %wd, prec = %wd, j = %wd\n\n", num, len, prec, j);
+                flint_printf("res = "); arb_printd(res + j, 30); flint_printf("\n\n");
+                flint_printf("s = "); arb_printd(s, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* blocked dot product with an initial value */
+        if (len >= ARB_DOT_BLOCK_CUTOFF)
+        {
+            int subtract = n_randint(state, 2);
+
+            arb_randtest(t, state, 2 + n_randint(state, 300), 4);
+            arb_dot_simple(s, t, subtract, x, 1, y, 1, len, prec);
+            arb_dot(t, t, subtract, x, 1, y, 1, len, prec);
+
+            if (!arb_overlaps(s, t) || (!arb_is_exact(s) &&
+                    arb_rel_accuracy_bits(t) < arb_rel_accuracy_bits(s) - 10))
+            {
+                flint_printf("FAIL: blocked arb_dot\n\n");
+                flint_printf("len = %wd, prec = %wd\n\n", len, prec);
+                flint_printf("s = "); arb_printd(s, 30); flint_printf("\n\n");
+                flint_printf("t = "); arb_printd(t, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(y, num * len);
+        _arb_vec_clear(res, num);
+        flint_free(yrows);
+        arb_clear(s);
+        arb_clear(t);
+    }
+
+    flint_set_num_threads(1);
+
+    TEST_FUNCTION_END(state);
+}
@@ -329,6 +329,83 @@ int arb_fpwrap_cdouble_modular_j(complex_double * res, complex_double tau, int f
 int arb_fpwrap_cdouble_modular_lambda(complex_double * res, complex_double tau, int flags);
 int arb_fpwrap_cdouble_modular_delta(complex_double * res, complex_double tau, int flags);
 
+/* vector versions */
+
+int arb_fpwrap_double_exp_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_exp_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_expm1_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_expm1_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_log_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_log_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_log1p_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_log1p_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_sqrt_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_sqrt_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_rsqrt_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_rsqrt_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_cbrt_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_cbrt_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_sin_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_sin_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_cos_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_cos_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_tan_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_tan_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_sin_pi_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_sin_pi_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_cos_pi_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_cos_pi_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_asin_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_asin_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_acos_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_acos_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_atan_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_atan_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_asinh_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_asinh_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_acosh_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_acosh_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_atanh_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_atanh_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_gamma_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_gamma_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_rgamma_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_rgamma_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_lgamma_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_lgamma_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_digamma_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_digamma_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_zeta_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_zeta_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_erf_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_erf_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
+int arb_fpwrap_double_erfc_vec(double * res, const double * x, slong n, int flags);
+int arb_fpwrap_cdouble_erfc_vec(complex_double * res, const complex_double * x, slong n, int flags);
+
 #ifdef __cplusplus
 }
 #endif
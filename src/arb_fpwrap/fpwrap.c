@@ -9,6 +9,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include <float.h>
 #include "double_extras.h"
 #include "acb.h"
 #include "acb_dirichlet.h"
@@ -17,6 +18,7 @@
 #include "acb_elliptic.h"
 #include "acb_modular.h"
 #include "arb_fpwrap.h"
+#include "thread_support.h"
 
 int
 arb_accurate_enough_d(const arb_t x, int flags)
@@ -1542,6 +1544,918 @@ int arb_fpwrap_cdouble_lambertw(complex_double * res, complex_double x, slong br
     return status;
 }
 
+/* Certified double-double kernels used by the vector versions of some
+   elementary functions. Each kernel evaluates the function in double-double
+   arithmetic built from error-free transformations (Joldes, Muller and
+   Popescu, "Tight and rigorous error bounds for basic building blocks of
+   double-word arithmetic", 2017), with an a priori relative error below
+   2^-77 on the stated domain. The result is only written if rounding the
+   double-double value meets the accuracy requirement of the flags;
+   otherwise the kernel returns 0 and the caller evaluates the element
+   with arb. The bounds assume round-to-nearest double arithmetic
+   without excess precision, so the kernels are disabled otherwise. */
+
+/* the value 16 only concerns _Float16 (e.g. with AVX512-FP16) */
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0 || FLT_EVAL_METHOD == 1 || FLT_EVAL_METHOD == 16)
+
+#define FPWRAP_DD(f) f
+
+typedef struct
+{
+    double hi;
+    double lo;
+}
+fpwrap_dd_t;
+
+/* |a| >= |b| or a == 0 */
+static inline fpwrap_dd_t
+dd_fast_two_sum(double a, double b)
+{
+    fpwrap_dd_t r;
+    r.hi = a + b;
+    r.lo = b - (r.hi - a);
+    return r;
+}
+
+static inline fpwrap_dd_t
+dd_two_sum(double a, double b)
+{
+    fpwrap_dd_t r;
+    double t;
+    r.hi = a + b;
+    t = r.hi - a;
+    r.lo = (a - (r.hi - t)) + (b - t);
+    return r;
+}
+
+static inline fpwrap_dd_t
+dd_two_prod(double a, double b)
+{
+    fpwrap_dd_t r;
+    r.hi = a * b;
+    r.lo = fma(a, b, -r.hi);
+    return r;
+}
+
+static inline fpwrap_dd_t
+dd_neg(fpwrap_dd_t x)
+{
+    x.hi = -x.hi;
+    x.lo = -x.lo;
+    return x;
+}
+
+/* relative error <= 2u^2 */
+static inline fpwrap_dd_t
+dd_add_d(fpwrap_dd_t x, double y)
+{
+    fpwrap_dd_t s = dd_two_sum(x.hi, y);
+    return dd_fast_two_sum(s.hi, x.lo + s.lo);
+}
+
+/* relative error <= 3u^2 + 13u^3 */
+static inline fpwrap_dd_t
+dd_add(fpwrap_dd_t x, fpwrap_dd_t y)
+{
+    fpwrap_dd_t s, t, v;
+    s = dd_two_sum(x.hi, y.hi);
+    t = dd_two_sum(x.lo, y.lo);
+    v = dd_fast_two_sum(s.hi, s.lo + t.hi);
+    return dd_fast_two_sum(v.hi, t.lo + v.lo);
+}
+
+/* relative error <= 2u^2 */
+static inline fpwrap_dd_t
+dd_mul_d(fpwrap_dd_t x, double y)
+{
+    fpwrap_dd_t c = dd_two_prod(x.hi, y);
+    return dd_fast_two_sum(c.hi, fma(x.lo, y, c.lo));
+}
+
+/* relative error <= 4u^2 */
+static inline fpwrap_dd_t
+dd_mul(fpwrap_dd_t x, fpwrap_dd_t y)
+{
+    fpwrap_dd_t c = dd_two_prod(x.hi, y.hi);
+    double t = fma(x.lo, y.hi, fma(x.hi, y.lo, x.lo * y.lo));
+    return dd_fast_two_sum(c.hi, c.lo + t);
+}
+
+/* relative error <= 3u^2 */
+static inline fpwrap_dd_t
+dd_div_d(fpwrap_dd_t x, double y)
+{
+    fpwrap_dd_t p;
+    double q, d;
+    q = x.hi / y;
+    p = dd_two_prod(q, y);
+    d = ((x.hi - p.hi) - p.lo) + x.lo;
+    return dd_fast_two_sum(q, d / y);
+}
+
+/* Rounds x, which has relative error less than 2^-77, to a double. Tiny
+   results are rejected since their low parts can be subnormal. With
+   correct rounding, we check that both ends of an enclosure with twice
+   the error round to x.hi, which suffices by monotonicity. */
+static int
+dd_get_d(double * res, fpwrap_dd_t x, int flags)
+{
+    double err;
+
+    if (!(fabs(x.hi) >= 1e-288 && fabs(x.hi) <= DBL_MAX))
+        return 0;
+
+    if (flags & FPWRAP_CORRECT_ROUNDING)
+    {
+        /* 2^-76 |x.hi| */
+        err = fabs(x.hi) * 1.3234889800848443e-23;
+
+        if (x.hi + (x.lo + err) != x.hi || x.hi + (x.lo - err) != x.hi)
+            return 0;
+    }
+
+    *res = x.hi;
+    return 1;
+}
+
+/* log(2)/32 = EXP_L1 + EXP_L2 + EXP_L3 where EXP_L1 and EXP_L2 have 36 bits */
+#define EXP_INV_L 46.166241308446828
+#define EXP_L1 0.021660849392446835
+#define EXP_L2 5.1456092446457696e-14
+#define EXP_L3 9.5682523000801882e-26
+
+/* 2^(j/32) */
+static const fpwrap_dd_t dd_exp_tab[32] = {
+    { 1.0, 0.0 },
+    { 1.0218971486541166, 5.1092250289734439e-17 },
+    { 1.0442737824274138, 8.5518897055379649e-17 },
+    { 1.0671404006768237, -7.8998539668415821e-17 },
+    { 1.0905077326652577, -3.0467820798124711e-17 },
+    { 1.1143867425958924, 1.0410278456845571e-16 },
+    { 1.1387886347566916, 8.9128126760254078e-17 },
+    { 1.1637248587775775, 3.8292048369240935e-17 },
+    { 1.189207115002721, 3.9820152314656461e-17 },
+    { 1.215247359980469, -7.7126306926814881e-17 },
+    { 1.241857812073484, 4.6580275918369368e-17 },
+    { 1.2690509571917332, 2.6679321313421861e-18 },
+    { 1.2968395546510096, 2.5382502794888315e-17 },
+    { 1.3252366431597413, -2.8587312100388614e-17 },
+    { 1.3542555469368927, 7.7009483798029895e-17 },
+    { 1.383909881963832, -6.7705116587947863e-17 },
+    { 1.4142135623730951, -9.6672933134529135e-17 },
+    { 1.4451808069770467, -3.0237581349939873e-17 },
+    { 1.4768261459394993, -3.4839945568927958e-17 },
+    { 1.5091644275934228, -1.016455327754295e-16 },
+    { 1.5422108254079407, 7.9498348096976209e-17 },
+    { 1.5759808451078865, -1.0136916471278304e-17 },
+    { 1.6104903319492543, 2.4707192569797888e-17 },
+    { 1.6457554781539649, -1.0125679913674773e-16 },
+    { 1.681792830507429, 8.1990100205814965e-17 },
+    { 1.7186192981224779, -1.851380418263111e-17 },
+    { 1.7562521603732995, 2.9601406954488733e-17 },
+    { 1.7947090750031072, 1.8227458427912087e-17 },
+    { 1.8340080864093424, 3.2831072242456272e-17 },
+    { 1.8741676341103, -6.1227634130041426e-17 },
+    { 1.9152065613971474, -1.0619946056195963e-16 },
+    { 1.9571441241754002, 8.9607677910366678e-17 },
+};
+
+static const fpwrap_dd_t dd_one_third = { 0.33333333333333331, 1.8503717077085941e-17 };
+static const fpwrap_dd_t dd_one_sixth = { 0.16666666666666666, 9.2518585385429707e-18 };
+static const fpwrap_dd_t dd_one_24th = { 0.041666666666666664, 2.3129646346357427e-18 };
+static const fpwrap_dd_t dd_one_120th = { 0.0083333333333333332, 1.1564823173178714e-19 };
+
+/* exp(xh + xl) with relative error < 2^-81 for -650 <= xh <= 709, where
+   |xl| <= ulp(xh). With x = k log(2)/32 + r and |r| < 0.011, the
+   truncation error of the Taylor polynomial for exp(r) is < 2^-97 and
+   the error of the terms of degree >= 4 evaluated in double precision
+   is < 2^-82. */
+static int
+dd_exp(fpwrap_dd_t * res, double xh, double xl)
+{
+    fpwrap_dd_t r, u;
+    double kd, q;
+    slong k, j;
+
+    if (!(xh >= -650.0 && xh <= 709.0))
+        return 0;
+
+    kd = nearbyint(xh * EXP_INV_L);
+    k = (slong) kd;
+    j = k & 31;
+
+    /* |k| < 2^15, so the first two products are exact */
+    r = dd_two_sum(xh - kd * EXP_L1, xl);
+    r = dd_add_d(r, -kd * EXP_L2);
+    r = dd_add_d(r, -kd * EXP_L3);
+
+    q = 2.7557319223985888e-07;
+    q = q * r.hi + 2.7557319223985893e-06;
+    q = q * r.hi + 2.4801587301587302e-05;
+    q = q * r.hi + 0.00019841269841269841;
+    q = q * r.hi + 0.0013888888888888889;
+    q = q * r.hi + 0.0083333333333333332;
+    q = q * r.hi + 0.041666666666666664;
+
+    u = dd_mul_d(r, q);
+    u = dd_add(u, dd_one_sixth);
+    u = dd_mul(u, r);
+    u = dd_add_d(u, 0.5);
+    u = dd_mul(u, r);
+    u = dd_add_d(u, 1.0);
+    u = dd_mul(u, r);
+    u = dd_add_d(u, 1.0);
+    u = dd_mul(u, dd_exp_tab[j]);
+
+    res->hi = ldexp(u.hi, (k - j) / 32);
+    res->lo = ldexp(u.lo, (k - j) / 32);
+    return 1;
+}
+
+static const fpwrap_dd_t dd_log2 = { 0.69314718055994529, 2.3190468138462996e-17 };
+
+/* r = 1/(1+j/64) rounded to a double and -log(r), for -19 <= j <= 27 */
+static const struct
+{
+    double r;
+    fpwrap_dd_t log;
+}
+dd_log_tab[47] = {
+    { 1.4222222222222223, { -0.35222059358935215, 1.1623903064849822e-17 } },
+    { 1.3913043478260869, { -0.33024168687057681, -1.6927253978145054e-17 } },
+    { 1.3617021276595744, { -0.30873548164961323, -1.5025836482434425e-17 } },
+    { 1.3333333333333333, { -0.28768207245178085, -2.6071606164425637e-17 } },
+    { 1.3061224489795917, { -0.26706278524904514, -2.3896107240262357e-17 } },
+    { 1.28, { -0.24686007793152581, -6.678539813576451e-18 } },
+    { 1.2549019607843137, { -0.22705745063534608, 4.3263720450759683e-18 } },
+    { 1.2307692307692308, { -0.20763936477824455, -1.2053243216686127e-17 } },
+    { 1.2075471698113207, { -0.18859116980754997, -9.9150705405711444e-18 } },
+    { 1.1851851851851851, { -0.16989903679539742, 4.8680087644390862e-19 } },
+    { 1.1636363636363636, { -0.15154989812720088, -1.2105853272368787e-17 } },
+    { 1.1428571428571428, { -0.13353139262452257, 3.6644576636600863e-18 } },
+    { 1.1228070175438596, { -0.11583181552512165, -4.3384843698080944e-18 } },
+    { 1.103448275862069, { -0.09844007281325251, 4.4390096336751359e-18 } },
+    { 1.0847457627118644, { -0.081345639453952401, -1.6076294039775555e-18 } },
+    { 1.0666666666666667, { -0.064538521137571164, 6.470486661692933e-18 } },
+    { 1.0491803278688525, { -0.048009219186360662, 2.0303566172243951e-18 } },
+    { 1.032258064516129, { -0.03174869831458027, -3.0382263084680854e-18 } },
+    { 1.0158730158730158, { -0.015748356968139112, -1.0021578630528958e-18 } },
+    { 1.0, { 0.0, 0.0 } },
+    { 0.98461538461538467, { 0.015504186535965199, -3.2783210228924137e-19 } },
+    { 0.96969696969696972, { 0.03077165866675366, 1.0431732029005972e-18 } },
+    { 0.95522388059701491, { 0.045809536031294222, 1.6823639049745016e-19 } },
+    { 0.94117647058823528, { 0.060624621816434854, 2.6424025938726934e-18 } },
+    { 0.92753623188405798, { 0.075223421237587518, -4.1958807203164336e-18 } },
+    { 0.91428571428571426, { 0.089612158689687166, -1.9573659817110993e-18 } },
+    { 0.90140845070422537, { 0.10379679368164355, -3.195893222617445e-18 } },
+    { 0.88888888888888884, { 0.11778303565638351, -1.1971685747593662e-18 } },
+    { 0.87671232876712324, { 0.13157635778871932, 1.112300087972959e-17 } },
+    { 0.86486486486486491, { 0.14518200984449783, 8.2424187830224769e-18 } },
+    { 0.85333333333333339, { 0.15860503017663852, 2.5833864922985579e-18 } },
+    { 0.84210526315789469, { 0.17185025692665928, -6.0224538210113689e-18 } },
+    { 0.83116883116883122, { 0.18492233849401193, -7.3846794405034346e-18 } },
+    { 0.82051282051282048, { 0.19782574332991992, -7.9954873387415432e-18 } },
+    { 0.810126582278481, { 0.21056476910734964, 1.1363105969061369e-17 } },
+    { 0.80000000000000004, { 0.22314355131420971, -9.0912705973247975e-18 } },
+    { 0.79012345679012341, { 0.23556607131276697, -2.3943371495187339e-18 } },
+    { 0.78048780487804881, { 0.24783616390458121, 8.384472133019162e-18 } },
+    { 0.77108433734939763, { 0.25995752443692599, 2.4167516341742964e-17 } },
+    { 0.76190476190476186, { 0.27193371548364181, 7.8331963769744355e-19 } },
+    { 0.75294117647058822, { 0.28376817313064462, -6.4488680034521052e-18 } },
+    { 0.7441860465116279, { 0.2954642128938359, -7.7683207962454429e-18 } },
+    { 0.73563218390804597, { 0.30702503529491187, 1.5578716077124932e-18 } },
+    { 0.72727272727272729, { 0.31845373111853459, -6.4079624830267774e-19 } },
+    { 0.7191011235955056, { 0.32975328637246804, -2.5633554999431966e-17 } },
+    { 0.71111111111111114, { 0.34092658697059319, -2.0696780027945009e-17 } },
+    { 0.70329670329670335, { 0.35197642315717809, 2.0005853013367377e-17 } },
+};
+
+/* log(x) with relative error < 2^-78 for finite x > 0, x != 1. With
+   x = 2^e m, m = (1 + j/64) (1 + t) and |t| < 0.0112 computed exactly,
+   the truncation error of the series for log(1+t) is < 2^-94 and the
+   error of the terms of degree >= 5 evaluated in double precision
+   is < 2^-79 relative to log(1+t). If e != 0 or j != 0, then
+   |log(x)| > 0.0077 > 0.69 |log(1+t)|. */
+static int
+dd_log(fpwrap_dd_t * res, double x)
+{
+    fpwrap_dd_t t, u;
+    double m, q;
+    int e;
+    slong j;
+
+    if (!(x > 0.0 && x <= DBL_MAX))
+        return 0;
+
+    m = frexp(x, &e);
+    if (m < 0.70710678118654752)
+    {
+        m *= 2.0;
+        e--;
+    }
+
+    j = (slong) nearbyint((m - 1.0) * 64.0);
+
+    /* t = m r - 1 exactly, using Sterbenz for the subtraction */
+    t = dd_two_prod(m, dd_log_tab[j + 19].r);
+    t = dd_two_sum(t.hi - 1.0, t.lo);
+
+    q = -0.071428571428571425;
+    q = q * t.hi + 0.076923076923076927;
+    q = q * t.hi - 0.083333333333333329;
+    q = q * t.hi + 0.090909090909090912;
+    q = q * t.hi - 0.10000000000000001;
+    q = q * t.hi + 0.1111111111111111;
+    q = q * t.hi - 0.125;
+    q = q * t.hi + 0.14285714285714285;
+    q = q * t.hi - 0.16666666666666666;
+    q = q * t.hi + 0.20000000000000001;
+
+    u = dd_mul_d(t, q);
+    u = dd_add_d(u, -0.25);
+    u = dd_mul(u, t);
+    u = dd_add(u, dd_one_third);
+    u = dd_mul(u, t);
+    u = dd_add_d(u, -0.5);
+    u = dd_mul(u, t);
+    u = dd_add_d(u, 1.0);
+    u = dd_mul(u, t);
+
+    u = dd_add(u, dd_log_tab[j + 19].log);
+    u = dd_add(u, dd_add_d(dd_two_prod(e, dd_log2.hi), e * dd_log2.lo));
+
+    *res = u;
+    return 1;
+}
+
+/* pi/32 = SIN_C1 + SIN_C2 + SIN_C3 + SIN_C4 where the first three have 29 bits */
+#define SIN_INV_C 10.185916357881302
+#define SIN_C1 0.09817477036267519
+#define SIN_C2 6.2005848806140351e-11
+#define SIN_C3 -7.6106573630486383e-20
+#define SIN_C4 1.8149099837371003e-29
+
+/* sin(j pi/32) */
+static const fpwrap_dd_t dd_sin_tab[17] = {
+    { 0.0, 0.0 },
+    { 0.098017140329560604, -1.634582362244256e-18 },
+    { 0.19509032201612828, -7.9910790684617313e-18 },
+    { 0.29028467725446239, -1.8927978707774251e-17 },
+    { 0.38268343236508978, -1.0050772696461588e-17 },
+    { 0.47139673682599764, 6.516678136069013e-18 },
+    { 0.55557023301960218, 4.7094109405616768e-17 },
+    { 0.63439328416364549, 1.0420901929280035e-17 },
+    { 0.70710678118654757, -4.8336466567264567e-17 },
+    { 0.77301045336273699, -3.2565907033649772e-17 },
+    { 0.83146961230254524, 1.4073856984728024e-18 },
+    { 0.88192126434835505, -1.9843248405890562e-17 },
+    { 0.92387953251128674, 1.7645047084336677e-17 },
+    { 0.95694033573220882, 4.0553869861875701e-17 },
+    { 0.98078528040323043, 1.8546939997825006e-17 },
+    { 0.99518472667219693, -4.248691367830441e-17 },
+    { 1.0, 0.0 },
+};
+
+/* sin(k pi/32) */
+static fpwrap_dd_t
+dd_sin_pi_32(slong k)
+{
+    slong j = k & 31;
+    fpwrap_dd_t v = dd_sin_tab[j <= 16 ? j : 32 - j];
+    return (k & 32) ? dd_neg(v) : v;
+}
+
+/* sin(x) and cos(x) with relative error < 2^-82 for |x| <= 2^20,
+   x != 0. With x = k pi/32 + r and |r| < 0.0491, the reduction error
+   is < 2^-120 absolute and the evaluation error of sin(r) and cos(r) is
+   < 2^-87 relative. Unless one of sin(k pi/32) and cos(k pi/32) vanishes,
+   both results are larger than sin(pi/64) in absolute value; otherwise
+   we need |r| >= 10^-9, which fails only if x is within 10^-9 of a
+   nonzero multiple of pi/32. */
+static int
+dd_sin_cos(fpwrap_dd_t * s, fpwrap_dd_t * c, double x)
+{
+    fpwrap_dd_t r, z, u, sr, cr, sk, ck;
+    double kd, q;
+    slong k;
+
+    if (!(fabs(x) <= 1048576.0))
+        return 0;
+
+    kd = nearbyint(x * SIN_INV_C);
+    k = (slong) kd;
+
+    /* |k| < 2^24, so the first three products are exact */
+    r = dd_two_sum(x - kd * SIN_C1, -kd * SIN_C2);
+    r = dd_add_d(r, -kd * SIN_C3);
+    r = dd_add_d(r, -kd * SIN_C4);
+
+    if (k != 0 && fabs(r.hi) < 1e-9)
+        return 0;
+
+    z = dd_mul(r, r);
+
+    q = 1.6059043836821613e-10;
+    q = q * z.hi - 2.505210838544172e-08;
+    q = q * z.hi + 2.7557319223985893e-06;
+    q = q * z.hi - 0.00019841269841269841;
+
+    u = dd_mul_d(z, q);
+    u = dd_add(u, dd_one_120th);
+    u = dd_mul(u, z);
+    u = dd_add(u, dd_neg(dd_one_sixth));
+    u = dd_mul(u, z);
+    u = dd_add_d(u, 1.0);
+    sr = dd_mul(u, r);
+
+    q = 2.08767569878681e-09;
+    q = q * z.hi - 2.7557319223985888e-07;
+    q = q * z.hi + 2.4801587301587302e-05;
+    q = q * z.hi - 0.0013888888888888889;
+
+    u = dd_mul_d(z, q);
+    u = dd_add(u, dd_one_24th);
+    u = dd_mul(u, z);
+    u = dd_add_d(u, -0.5);
+    u = dd_mul(u, z);
+    cr = dd_add_d(u, 1.0);
+
+    sk = dd_sin_pi_32(k);
+    ck = dd_sin_pi_32(k + 16);
+
+    *s = dd_add(dd_mul(sk, cr), dd_mul(ck, sr));
+    *c = dd_add(dd_mul(ck, cr), dd_neg(dd_mul(sk, sr)));
+    return 1;
+}
+
+static const fpwrap_dd_t dd_two_over_sqrt_pi = { 1.1283791670955126, 1.5335459613165881e-17 };
+
+/* erf(x) for 0 < x < 6 with relative error < 2^-80, using
+   erf(x) = 2x/sqrt(pi) exp(-x^2) sum_{n>=0} (2x^2)^n / (1 3 ... (2n+1)).
+   The terms are positive, so the sum has relative error < 2^-94 after the
+   at most 120 terms used, and it is truncated at a relative error < 2^-85. */
+static int
+dd_erf(fpwrap_dd_t * res, double x)
+{
+    fpwrap_dd_t z, e, t, s, v;
+    slong n;
+
+    z = dd_two_prod(x, x);
+    if (!dd_exp(&e, -z.hi, -z.lo))
+        return 0;
+
+    z.hi *= 2.0;
+    z.lo *= 2.0;
+    s.hi = t.hi = 1.0;
+    s.lo = t.lo = 0.0;
+
+    for (n = 0; ; n++)
+    {
+        t = dd_div_d(dd_mul(t, z), 2 * n + 3);
+        s = dd_add(s, t);
+
+        /* the remaining terms decrease at least geometrically by 1/2 */
+        if (t.hi < 1e-26 * s.hi && z.hi <= 0.5 * (2 * n + 5))
+            break;
+    }
+
+    v = dd_mul_d(dd_two_over_sqrt_pi, x);
+    v = dd_mul(v, e);
+    *res = dd_mul(v, s);
+    return 1;
+}
+
+static int
+_arb_fpwrap_double_exp_dd(double * res, double x, int flags)
+{
+    fpwrap_dd_t v;
+    return dd_exp(&v, x, 0.0) && dd_get_d(res, v, flags);
+}
+
+static int
+_arb_fpwrap_double_log_dd(double * res, double x, int flags)
+{
+    fpwrap_dd_t v;
+
+    if (x == 1.0)
+    {
+        *res = 0.0;
+        return 1;
+    }
+
+    return dd_log(&v, x) && dd_get_d(res, v, flags);
+}
+
+static int
+_arb_fpwrap_double_sin_dd(double * res, double x, int flags)
+{
+    fpwrap_dd_t s, c;
+    return x != 0.0 && dd_sin_cos(&s, &c, x) && dd_get_d(res, s, flags);
+}
+
+static int
+_arb_fpwrap_double_cos_dd(double * res, double x, int flags)
+{
+    fpwrap_dd_t s, c;
+
+    if (x == 0.0)
+    {
+        *res = 1.0;
+        return 1;
+    }
+
+    return dd_sin_cos(&s, &c, x) && dd_get_d(res, c, flags);
+}
+
+/* For |x| >= 6, erfc(|x|) < 2^-54 so that erf(x) rounds to +/- 1. */
+static int
+_arb_fpwrap_double_erf_dd(double * res, double x, int flags)
+{
+    fpwrap_dd_t v;
+
+    if (x == 0.0)
+    {
+        *res = 0.0;
+        return 1;
+    }
+
+    if (fabs(x) >= 6.0)
+    {
+        *res = (x > 0.0) ? 1.0 : -1.0;
+        return 1;
+    }
+
+    if (!dd_erf(&v, fabs(x)))
+        return 0;
+
+    if (x < 0.0)
+        v = dd_neg(v);
+
+    return dd_get_d(res, v, flags);
+}
+
+static int
+_arb_fpwrap_cdouble_exp_dd(complex_double * res, complex_double x, int flags)
+{
+    fpwrap_dd_t e, s, c;
+    complex_double y;
+
+    if (!dd_exp(&e, x.real, 0.0))
+        return 0;
+
+    if (x.imag == 0.0)
+    {
+        y.imag = 0.0;
+        if (!dd_get_d(&y.real, e, flags))
+            return 0;
+    }
+    else
+    {
+        if (!dd_sin_cos(&s, &c, x.imag) ||
+            !dd_get_d(&y.real, dd_mul(e, c), flags) ||
+            !dd_get_d(&y.imag, dd_mul(e, s), flags))
+            return 0;
+    }
+
+    *res = y;
+    return 1;
+}
+
+#else
+
+#define FPWRAP_DD(f) NULL
+
+#endif
+
+/* Vector versions. Each block of FPWRAP_VEC_BLOCK elements is first passed
+   through the double-double kernel of the function, if there is one; the
+   remaining elements share one set of arb variables, are evaluated at
+   WP_INITIAL, and only the elements that fail the accuracy test are
+   retried at doubled precision. Blocks are distributed over threads for
+   long inputs. */
+
+#define FPWRAP_VEC_BLOCK 256
+#define FPWRAP_VEC_THREAD_CUTOFF 1024
+
+typedef int (*fpwrap_double_dd_func)(double * res, double x, int flags);
+typedef int (*fpwrap_cdouble_dd_func)(complex_double * res, complex_double x, int flags);
+
+typedef struct
+{
+    void * res;
+    const void * x;
+    slong n;
+    arb_func_1 arb_func;
+    acb_func_1 acb_func;
+    fpwrap_double_dd_func double_dd;
+    fpwrap_cdouble_dd_func cdouble_dd;
+    int flags;
+    int * status;
+}
+fpwrap_vec_work_t;
+
+static int
+_arb_fpwrap_double_1_vec_block(double * res, arb_func_1 func, fpwrap_double_dd_func dd_func, const double * x, slong n, int flags)
+{
+    arb_t arb_res, arb_x;
+    slong pending[FPWRAP_VEC_BLOCK];
+    slong i, j, k, num, wp;
+    int status = FPWRAP_SUCCESS;
+
+    arb_init(arb_res);
+    arb_init(arb_x);
+
+    num = 0;
+    for (i = 0; i < n; i++)
+    {
+        if (x[i] - x[i] == 0.0)
+        {
+            if (dd_func == NULL || !dd_func(res + i, x[i], flags))
+                pending[num++] = i;
+        }
+        else
+        {
+            res[i] = D_NAN;
+            status = FPWRAP_UNABLE;
+        }
+    }
+
+    for (wp = WP_INITIAL; num != 0; wp *= 2)
+    {
+        for (j = k = 0; j < num; j++)
+        {
+            i = pending[j];
+
+            arb_set_d(arb_x, x[i]);
+            func(arb_res, arb_x, wp);
+
+            if (arb_accurate_enough_d(arb_res, flags))
+                res[i] = arf_get_d(arb_midref(arb_res), ARF_RND_NEAR);
+            else if (wp >= double_wp_max(flags))
+            {
+                res[i] = D_NAN;
+                status = FPWRAP_UNABLE;
+            }
+            else
+                pending[k++] = i;
+        }
+
+        num = k;
+    }
+
+    arb_clear(arb_x);
+    arb_clear(arb_res);
+
+    return status;
+}
+
+static int
+_arb_fpwrap_cdouble_1_vec_block(complex_double * res, acb_func_1 func, fpwrap_cdouble_dd_func dd_func, const complex_double * x, slong n, int flags)
+{
+    acb_t acb_res, acb_x;
+    slong pending[FPWRAP_VEC_BLOCK];
+    slong i, j, k, num, wp;
+    int status = FPWRAP_SUCCESS;
+
+    acb_init(acb_res);
+    acb_init(acb_x);
+
+    num = 0;
+    for (i = 0; i < n; i++)
+    {
+        if (x[i].real - x[i].real == 0.0 && x[i].imag - x[i].imag == 0.0)
+        {
+            if (dd_func == NULL || !dd_func(res + i, x[i], flags))
+                pending[num++] = i;
+        }
+        else
+        {
+            res[i].real = D_NAN;
+            res[i].imag = D_NAN;
+            status = FPWRAP_UNABLE;
+        }
+    }
+
+    for (wp = WP_INITIAL; num != 0; wp *= 2)
+    {
+        for (j = k = 0; j < num; j++)
+        {
+            i = pending[j];
+
+            acb_set_d_d(acb_x, x[i].real, x[i].imag);
+            func(acb_res, acb_x, wp);
+
+            if (acb_accurate_enough_d(acb_res, flags))
+            {
+                res[i].real = arf_get_d(arb_midref(acb_realref(acb_res)), ARF_RND_NEAR);
+                res[i].imag = arf_get_d(arb_midref(acb_imagref(acb_res)), ARF_RND_NEAR);
+            }
+            else if (wp >= double_wp_max(flags))
+            {
+                res[i].real = D_NAN;
+                res[i].imag = D_NAN;
+                status = FPWRAP_UNABLE;
+            }
+            else
+                pending[k++] = i;
+        }
+
+        num = k;
+    }
+
+    acb_clear(acb_x);
+    acb_clear(acb_res);
+
+    return status;
+}
+
+static void
+_arb_fpwrap_double_1_vec_worker(slong b, void * args)
+{
+    fpwrap_vec_work_t * w = (fpwrap_vec_work_t *) args;
+    slong start = b * FPWRAP_VEC_BLOCK;
+    slong len = FLINT_MIN(FPWRAP_VEC_BLOCK, w->n - start);
+
+    w->status[b] = _arb_fpwrap_double_1_vec_block((double *) w->res + start,
+        w->arb_func, w->double_dd, (const double *) w->x + start, len, w->flags);
+}
+
+static void
+_arb_fpwrap_cdouble_1_vec_worker(slong b, void * args)
+{
+    fpwrap_vec_work_t * w = (fpwrap_vec_work_t *) args;
+    slong start = b * FPWRAP_VEC_BLOCK;
+    slong len = FLINT_MIN(FPWRAP_VEC_BLOCK, w->n - start);
+
+    w->status[b] = _arb_fpwrap_cdouble_1_vec_block((complex_double *) w->res + start,
+        w->acb_func, w->cdouble_dd, (const complex_double *) w->x + start, len, w->flags);
+}
+
+static int
+_arb_fpwrap_vec(fpwrap_vec_work_t * work, do_func_t worker)
+{
+    slong b, num_blocks;
+    int status = FPWRAP_SUCCESS;
+
+    if (work->n <= 0)
+        return FPWRAP_SUCCESS;
+
+    num_blocks = (work->n + FPWRAP_VEC_BLOCK - 1) / FPWRAP_VEC_BLOCK;
+    work->status = flint_malloc(sizeof(int) * num_blocks);
+
+    if (work->n >= FPWRAP_VEC_THREAD_CUTOFF && flint_get_num_threads() >= 2)
+    {
+        flint_parallel_do(worker, work, num_blocks, 0, FLINT_PARALLEL_DYNAMIC);
+    }
+    else
+    {
+        for (b = 0; b < num_blocks; b++)
+            worker(b, work);
+    }
+
+    for (b = 0; b < num_blocks; b++)
+        if (work->status[b] != FPWRAP_SUCCESS)
+            status = FPWRAP_UNABLE;
+
+    flint_free(work->status);
+
+    return status;
+}
+
+static int
+_arb_fpwrap_double_1_vec(double * res, arb_func_1 func, fpwrap_double_dd_func dd_func, const double * x, slong n, int flags)
+{
+    fpwrap_vec_work_t work;
+
+    work.res = res;
+    work.x = x;
+    work.n = n;
+    work.arb_func = func;
+    work.acb_func = NULL;
+    work.double_dd = dd_func;
+    work.cdouble_dd = NULL;
+    work.flags = flags;
+
+    return _arb_fpwrap_vec(&work, _arb_fpwrap_double_1_vec_worker);
+}
+
+static int
+_arb_fpwrap_cdouble_1_vec(complex_double * res, acb_func_1 func, fpwrap_cdouble_dd_func dd_func, const complex_double * x, slong n, int flags)
+{
+    fpwrap_vec_work_t work;
+
+    work.res = res;
+    work.x = x;
+    work.n = n;
+    work.arb_func = NULL;
+    work.acb_func = func;
+    work.double_dd = NULL;
+    work.cdouble_dd = dd_func;
+    work.flags = flags;
+
+    return _arb_fpwrap_vec(&work, _arb_fpwrap_cdouble_1_vec_worker);
+}
+
+int arb_fpwrap_double_1_vec(double * res, arb_func_1 func, const double * x, slong n, int flags)
+{
+    return _arb_fpwrap_double_1_vec(res, func, NULL, x, n, flags);
+}
+
+int arb_fpwrap_cdouble_1_vec(complex_double * res, acb_func_1 func, const complex_double * x, slong n, int flags)
+{
+    return _arb_fpwrap_cdouble_1_vec(res, func, NULL, x, n, flags);
+}
+
+#define DEF_DOUBLE_FUN_1_VEC_DD(name, arb_fun, dd_fun) \
+    int arb_fpwrap_double_ ## name ## _vec(double * res, const double * x, slong n, int flags) \
+    { \
+        return _arb_fpwrap_double_1_vec(res, arb_fun, dd_fun, x, n, flags); \
+    } \
+
+#define DEF_CDOUBLE_FUN_1_VEC_DD(name, acb_fun, dd_fun) \
+    int arb_fpwrap_cdouble_ ## name ## _vec(complex_double * res, const complex_double * x, slong n, int flags) \
+    { \
+        return _arb_fpwrap_cdouble_1_vec(res, acb_fun, dd_fun, x, n, flags); \
+    } \
+
+#define DEF_DOUBLE_FUN_1_VEC(name, arb_fun) DEF_DOUBLE_FUN_1_VEC_DD(name, arb_fun, NULL)
+#define DEF_CDOUBLE_FUN_1_VEC(name, acb_fun) DEF_CDOUBLE_FUN_1_VEC_DD(name, acb_fun, NULL)
+
+DEF_DOUBLE_FUN_1_VEC_DD(exp, arb_exp, FPWRAP_DD(_arb_fpwrap_double_exp_dd))
+DEF_CDOUBLE_FUN_1_VEC_DD(exp, acb_exp, FPWRAP_DD(_arb_fpwrap_cdouble_exp_dd))
+
+DEF_DOUBLE_FUN_1_VEC(expm1, arb_expm1)
+DEF_CDOUBLE_FUN_1_VEC(expm1, acb_expm1)
+
+DEF_DOUBLE_FUN_1_VEC_DD(log, arb_log, FPWRAP_DD(_arb_fpwrap_double_log_dd))
+DEF_CDOUBLE_FUN_1_VEC(log, acb_log)
+
+DEF_DOUBLE_FUN_1_VEC(log1p, arb_log1p)
+DEF_CDOUBLE_FUN_1_VEC(log1p, acb_log1p)
+
+DEF_DOUBLE_FUN_1_VEC(sqrt, arb_sqrt)
+DEF_CDOUBLE_FUN_1_VEC(sqrt, acb_sqrt)
+
+DEF_DOUBLE_FUN_1_VEC(rsqrt, arb_rsqrt)
+DEF_CDOUBLE_FUN_1_VEC(rsqrt, acb_rsqrt)
+
+DEF_DOUBLE_FUN_1_VEC(cbrt, _arb_cbrt)
+DEF_CDOUBLE_FUN_1_VEC(cbrt, _acb_cbrt)
+
+DEF_DOUBLE_FUN_1_VEC_DD(sin, arb_sin, FPWRAP_DD(_arb_fpwrap_double_sin_dd))
+DEF_CDOUBLE_FUN_1_VEC(sin, acb_sin)
+
+DEF_DOUBLE_FUN_1_VEC_DD(cos, arb_cos, FPWRAP_DD(_arb_fpwrap_double_cos_dd))
+DEF_CDOUBLE_FUN_1_VEC(cos, acb_cos)
+
+DEF_DOUBLE_FUN_1_VEC(tan, arb_tan)
+DEF_CDOUBLE_FUN_1_VEC(tan, acb_tan)
+
+DEF_DOUBLE_FUN_1_VEC(sin_pi, arb_sin_pi)
+DEF_CDOUBLE_FUN_1_VEC(sin_pi, acb_sin_pi)
+
+DEF_DOUBLE_FUN_1_VEC(cos_pi, arb_cos_pi)
+DEF_CDOUBLE_FUN_1_VEC(cos_pi, acb_cos_pi)
+
+DEF_DOUBLE_FUN_1_VEC(asin, arb_asin)
+DEF_CDOUBLE_FUN_1_VEC(asin, acb_asin)
+
+DEF_DOUBLE_FUN_1_VEC(acos, arb_acos)
+DEF_CDOUBLE_FUN_1_VEC(acos, acb_acos)
+
+DEF_DOUBLE_FUN_1_VEC(atan, arb_atan)
+DEF_CDOUBLE_FUN_1_VEC(atan, acb_atan)
+
+DEF_DOUBLE_FUN_1_VEC(asinh, arb_asinh)
+DEF_CDOUBLE_FUN_1_VEC(asinh, acb_asinh)
+
+DEF_DOUBLE_FUN_1_VEC(acosh, arb_acosh)
+DEF_CDOUBLE_FUN_1_VEC(acosh, acb_acosh)
+
+DEF_DOUBLE_FUN_1_VEC(atanh, arb_atanh)
+DEF_CDOUBLE_FUN_1_VEC(atanh, acb_atanh)
+
+DEF_DOUBLE_FUN_1_VEC(gamma, arb_gamma)
+DEF_CDOUBLE_FUN_1_VEC(gamma, acb_gamma)
+
+DEF_DOUBLE_FUN_1_VEC(rgamma, arb_rgamma)
+DEF_CDOUBLE_FUN_1_VEC(rgamma, acb_rgamma)
+
+DEF_DOUBLE_FUN_1_VEC(lgamma, arb_lgamma)
+DEF_CDOUBLE_FUN_1_VEC(lgamma, acb_lgamma)
+
+DEF_DOUBLE_FUN_1_VEC(digamma, arb_digamma)
+DEF_CDOUBLE_FUN_1_VEC(digamma, acb_digamma)
+
+DEF_DOUBLE_FUN_1_VEC(zeta, arb_zeta)
+DEF_CDOUBLE_FUN_1_VEC(zeta, acb_zeta)
+
+DEF_DOUBLE_FUN_1_VEC_DD(erf, arb_hypgeom_erf, FPWRAP_DD(_arb_fpwrap_double_erf_dd))
+DEF_CDOUBLE_FUN_1_VEC(erf, acb_hypgeom_erf)
+
+DEF_DOUBLE_FUN_1_VEC(erfc, arb_hypgeom_erfc)
+DEF_CDOUBLE_FUN_1_VEC(erfc, acb_hypgeom_erfc)
+
 /* todo: functions with multiple outputs */
 /* todo: elliptic invariants, roots */
 /* todo: eisenstein series */
@@ -15,12 +15,14 @@
 /* Include functions *********************************************************/
 
 #include "t-fpwrap.c"
+#include "t-fpwrap_vec.c"
 
 /* Array of test functions ***************************************************/
 
 test_struct tests[] =
 {
-    TEST_FUNCTION(arb_fpwrap)
+    TEST_FUNCTION(arb_fpwrap),
+    TEST_FUNCTION(arb_fpwrap_vec)
 };
 
 /* main function *************************************************************/
@@ -0,0 +1,230 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "double_extras.h"
+#include "arb_fpwrap.h"
+
+typedef int (* fpwrap_d_t)(double *, double, int);
+typedef int (* fpwrap_d_vec_t)(double *, const double *, slong, int);
+typedef int (* fpwrap_c_t)(complex_double *, complex_double, int);
+typedef int (* fpwrap_c_vec_t)(complex_double *, const complex_double *, slong, int);
+
+static double
+_fpwrap_vec_randtest_d(flint_rand_t state)
+{
+    switch (n_randint(state, 16))
+    {
+        case 0:
+            return D_NAN;
+        case 1:
+            return D_INF;
+        case 2:
+            return -(double) n_randint(state, 5);
+        case 3:
+            return 1.0;
+        case 4:
+            return 1.0 + ldexp(d_randtest(state) - 0.5, -(slong) n_randint(state, 50));
+        case 5:
+            /* close to a multiple of pi/32 */
+            return ((slong) n_randint(state, 200) - 100) * 0.098174770424681035
+                * (1.0 + ldexp(d_randtest(state) - 0.5, -(slong) n_randint(state, 50)));
+        case 6:
+            return (d_randtest(state) - 0.5) * ldexp(1.0, n_randint(state, 22));
+        case 7:
+            return ldexp(d_randtest(state) - 0.5, -(slong) n_randint(state, 1100));
+        default:
+            return (d_randtest(state) - 0.5) * ldexp(1.0, n_randint(state, 12) - 4);
+    }
+}
+
+/* NaN-aware equality */
+static int
+_fpwrap_vec_equal_d(double a, double b)
+{
+    return (a == b) || (a != a && b != b);
+}
+
+/* Without correct rounding, the double-double kernels of some vector
+   functions may round differently from the scalar function. They can
+   also succeed where the scalar function gives up, e.g. for erf(x) with
+   large x and correct rounding; such entries are compared with the
+   scalar function evaluated with default flags. */
+static int
+_fpwrap_vec_close_d(double a, double b, double mag)
+{
+    return _fpwrap_vec_equal_d(a, b) || fabs(a - b) <= ldexp(mag, -51);
+}
+
+TEST_FUNCTION_START(arb_fpwrap_vec, state)
+{
+    fpwrap_d_t dfun[] = {
+        arb_fpwrap_double_exp, arb_fpwrap_double_log1p, arb_fpwrap_double_sqrt,
+        arb_fpwrap_double_sin, arb_fpwrap_double_atanh, arb_fpwrap_double_gamma,
+        arb_fpwrap_double_zeta, arb_fpwrap_double_erfc, arb_fpwrap_double_log,
+        arb_fpwrap_double_cos, arb_fpwrap_double_erf };
+    fpwrap_d_vec_t dvec[] = {
+        arb_fpwrap_double_exp_vec, arb_fpwrap_double_log1p_vec, arb_fpwrap_double_sqrt_vec,
+        arb_fpwrap_double_sin_vec, arb_fpwrap_double_atanh_vec, arb_fpwrap_double_gamma_vec,
+        arb_fpwrap_double_zeta_vec, arb_fpwrap_double_erfc_vec, arb_fpwrap_double_log_vec,
+        arb_fpwrap_double_cos_vec, arb_fpwrap_double_erf_vec };
+    fpwrap_c_t cfun[] = {
+        arb_fpwrap_cdouble_exp, arb_fpwrap_cdouble_log, arb_fpwrap_cdouble_rsqrt,
+        arb_fpwrap_cdouble_tan, arb_fpwrap_cdouble_lgamma, arb_fpwrap_cdouble_erf };
+    fpwrap_c_vec_t cvec[] = {
+        arb_fpwrap_cdouble_exp_vec, arb_fpwrap_cdouble_log_vec, arb_fpwrap_cdouble_rsqrt_vec,
+        arb_fpwrap_cdouble_tan_vec, arb_fpwrap_cdouble_lgamma_vec, arb_fpwrap_cdouble_erf_vec };
+    slong iter;
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        double * x, * y, * z;
+        slong i, n, which;
+        int flags, status, status2, alias;
+
+        n = n_randint(state, 3) == 0 ? n_randint(state, 1500) : n_randint(state, 20);
+        which = n_randint(state, sizeof(dfun) / sizeof(fpwrap_d_t));
+        flags = n_randint(state, 2) ? 0 : FPWRAP_CORRECT_ROUNDING;
+        alias = n_randint(state, 2);
+
+        x = flint_malloc(sizeof(double) * (n + 1));
+        y = flint_malloc(sizeof(double) * (n + 1));
+        z = flint_malloc(sizeof(double) * (n + 1));
+
+        for (i = 0; i < n; i++)
+            x[i] = _fpwrap_vec_randtest_d(state);
+
+        status2 = FPWRAP_SUCCESS;
+        for (i = 0; i < n; i++)
+            if (dfun[which](z + i, x[i], flags) != FPWRAP_SUCCESS)
+                status2 = FPWRAP_UNABLE;
+
+        if (alias)
+        {
+            for (i = 0; i < n; i++)
+                y[i] = x[i];
+            status = dvec[which](y, y, n, flags);
+        }
+        else
+        {
+            status = dvec[which](y, x, n, flags);
+        }
+
+        if (status != status2 && status2 != FPWRAP_UNABLE)
+        {
+            flint_printf("FAIL (double status)\n");
+            flint_printf("which = %wd, n = %wd, status = %d, %d\n", which, n, status, status2);
+            flint_abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            int ok;
+
+            if (z[i] != z[i] && y[i] == y[i])
+            {
+                dfun[which](z + i, x[i], 0);
+                ok = _fpwrap_vec_close_d(y[i], z[i], fabs(z[i]));
+            }
+            else if (flags & FPWRAP_CORRECT_ROUNDING)
+                ok = _fpwrap_vec_equal_d(y[i], z[i]);
+            else
+                ok = _fpwrap_vec_close_d(y[i], z[i], fabs(z[i]));
+
+            if (!ok)
+            {
+                flint_printf("FAIL (double value)\n");
+                flint_printf("which = %wd, i = %wd, x = %.17g, y = %.17g, z = %.17g\n",
+                    which, i, x[i], y[i], z[i]);
+                flint_abort();
+            }
+        }
+
+        flint_free(x);
+        flint_free(y);
+        flint_free(z);
+    }
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        complex_double * x, * y, * z;
+        slong i, n, which;
+        int flags, status, status2;
+
+        n = n_randint(state, 3) == 0 ? n_randint(state, 600) : n_randint(state, 20);
+        which = n_randint(state, sizeof(cfun) / sizeof(fpwrap_c_t));
+        flags = n_randint(state, 3);
+
+        x = flint_malloc(sizeof(complex_double) * (n + 1));
+        y = flint_malloc(sizeof(complex_double) * (n + 1));
+        z = flint_malloc(sizeof(complex_double) * (n + 1));
+
+        for (i = 0; i < n; i++)
+        {
+            x[i].real = _fpwrap_vec_randtest_d(state);
+            x[i].imag = n_randint(state, 4) ? _fpwrap_vec_randtest_d(state) : 0.0;
+        }
+
+        status2 = FPWRAP_SUCCESS;
+        for (i = 0; i < n; i++)
+            if (cfun[which](z + i, x[i], flags) != FPWRAP_SUCCESS)
+                status2 = FPWRAP_UNABLE;
+
+        status = cvec[which](y, x, n, flags);
+
+        if (status != status2 && status2 != FPWRAP_UNABLE)
+        {
+            flint_printf("FAIL (complex status)\n");
+            flint_printf("which = %wd, n = %wd, status = %d, %d\n", which, n, status, status2);
+            flint_abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            double mre, mim;
+
+            if ((z[i].real != z[i].real || z[i].imag != z[i].imag) &&
+                y[i].real == y[i].real && y[i].imag == y[i].imag)
+            {
+                cfun[which](z + i, x[i], 0);
+                mre = mim = 2.0 * (fabs(z[i].real) + fabs(z[i].imag));
+            }
+            else if (flags & FPWRAP_CORRECT_ROUNDING)
+            {
+                mre = mim = 0.0;
+            }
+            else if (flags & FPWRAP_ACCURATE_PARTS)
+            {
+                mre = fabs(z[i].real);
+                mim = fabs(z[i].imag);
+            }
+            else
+            {
+                /* only the norm is accurate */
+                mre = mim = 2.0 * (fabs(z[i].real) + fabs(z[i].imag));
+            }
+
+            if (!_fpwrap_vec_close_d(y[i].real, z[i].real, mre) ||
+                !_fpwrap_vec_close_d(y[i].imag, z[i].imag, mim))
+            {
+                flint_printf("FAIL (complex value)\n");
+                flint_printf("which = %wd, i = %wd\n", which, i);
+                flint_abort();
+            }
+        }
+
+        flint_free(x);
+        flint_free(y);
+        flint_free(z);
+    }
+
+    TEST_FUNCTION_END(state);
+}
@@ -60,7 +60,6 @@ _arb_mat_vector_mul_col(arb_ptr res, const arb_mat_t A, arb_srcptr v, slong prec
 {
     slong r = arb_mat_nrows(A);
     slong c = arb_mat_ncols(A);
-    slong k;
 
     if (arb_mat_is_empty(A))
     {
@@ -68,10 +67,7 @@ _arb_mat_vector_mul_col(arb_ptr res, const arb_mat_t A, arb_srcptr v, slong prec
     }
     else
     {
-        for (k = 0; k < r; k++)
-        {
-            arb_dot(&res[k], NULL, 0, A->rows[k], 1, v, 1, c, prec);
-        }
+        arb_dot_many(res, v, 1, A->rows, 1, r, c, prec);
     }
 }
 
@@ -0,0 +1,80 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef BIN_IO_H
+#define BIN_IO_H
+
+#include "flint.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+  Binary format shared by the *_fwrite_bin and *_fread_bin functions.
+  Every object starts with an 8 byte header
+
+    'F' 'L' 'B' version tag limb_bytes endianness 0
+
+  where endianness is 'L' or 'B', followed by a sequence of limbs of
+  limb_bytes bytes each in that byte order. Sizes are stored as single
+  limbs, integers as a signed limb count followed by the absolute value
+  least significant limb first.
+*/
+
+#define FLINT_BIN_VERSION 1
+#define FLINT_BIN_HEADER_SIZE 8
+
+/* Readers allocate at most this many limbs (or entries) in advance and
+   grow larger objects as their data is read, so that a corrupt size field
+   cannot cause a huge allocation. */
+#define FLINT_BIN_READ_CHUNK 65536
+
+#define FLINT_BIN_FMPZ      1
+#define FLINT_BIN_FMPZ_VEC  2
+#define FLINT_BIN_FMPZ_POLY 3
+#define FLINT_BIN_FMPZ_MAT  4
+#define FLINT_BIN_NMOD_POLY 5
+#define FLINT_BIN_NMOD_MAT  6
+
+void flint_bin_header(unsigned char * header, int tag);
+int flint_bin_check_header(const unsigned char * header, int tag, int * swap);
+
+void flint_bin_swap_limbs(mp_ptr x, slong n);
+
+#ifdef FLINT_HAVE_FILE
+int flint_bin_fwrite_header(FILE * file, int tag);
+int flint_bin_fread_header(FILE * file, int tag, int * swap);
+
+int flint_bin_fwrite_limbs(FILE * file, mp_srcptr x, slong n);
+int flint_bin_fread_limbs(FILE * file, mp_ptr x, slong n, int swap);
+#endif
+
+/* Read-only image of a file, memory-mapped where supported */
+
+typedef struct
+{
+    char * data;
+    size_t size;
+    int mapped;
+}
+flint_bin_map_struct;
+
+typedef flint_bin_map_struct flint_bin_map_t[1];
+
+int flint_bin_map_init(flint_bin_map_t map, const char * filename);
+void flint_bin_map_clear(flint_bin_map_t map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
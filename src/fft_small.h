@@ -12,6 +12,37 @@
 #ifndef FFT_SMALL_H
 #define FFT_SMALL_H
 
+#include "flint.h"
+
+/*
+    With FLINT_FFT_SMALL_DISPATCH the module is compiled for AVX2 in a build
+    which otherwise does not assume it. Code outside the module only sees the
+    entry points below and must check FFT_SMALL_AVAILABLE before calling them.
+*/
+#if FLINT_FFT_SMALL_DISPATCH
+# define FFT_SMALL_AVAILABLE ((flint_get_cpu_features() & FLINT_CPU_AVX2) != 0)
+#else
+# define FFT_SMALL_AVAILABLE 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void mpn_mul_default_mpn_ctx(mp_ptr r1, mp_srcptr i1, mp_size_t n1, mp_srcptr i2, mp_size_t n2);
+void _nmod_poly_mul_mid_default_mpn_ctx(mp_ptr res, slong zl, slong zh, mp_srcptr a, slong an, mp_srcptr b, slong bn, nmod_t mod);
+
+int _fmpz_poly_mul_mid_default_mpn_ctx(
+    fmpz * z, slong zl, slong zh,
+    const fmpz * a, slong an,
+    const fmpz * b, slong bn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#if !FLINT_FFT_SMALL_DISPATCH || defined(__AVX2__)
+
 #include "machine_vectors.h"
 
 #define LG_BLK_SZ 8
@@ -247,6 +278,27 @@ void sd_fft_trunc(const sd_fft_lctx_t Q, ulong I, ulong S, ulong k, ulong j, ulo
 /* sd_ifft.c */
 void sd_ifft_trunc(const sd_fft_lctx_t Q, ulong I, ulong S, ulong k, ulong j, ulong z, ulong n, int f);
 
+/*
+    When building for AVX2 without AVX-512, avx512.c compiles the transforms
+    and the pointwise products a second time with AVX-512 enabled, and these
+    are used if flint_get_cpu_features reports AVX-512 at runtime.
+*/
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) \
+    && defined(__AVX2__) && !defined(__AVX512F__)
+# define SD_FFT_AVX512_DISPATCH 1
+#else
+# define SD_FFT_AVX512_DISPATCH 0
+#endif
+
+#if SD_FFT_AVX512_DISPATCH
+void sd_fft_trunc_avx512(const sd_fft_lctx_t Q, ulong I, ulong S, ulong k, ulong j, ulong itrunc, ulong otrunc);
+void sd_ifft_trunc_avx512(const sd_fft_lctx_t Q, ulong I, ulong S, ulong k, ulong j, ulong z, ulong n, int f);
+void sd_fft_lctx_point_mul_avx512(const sd_fft_lctx_t Q,
+                            double* a, const double* b, ulong m_, ulong depth);
+void sd_fft_lctx_point_sqr_avx512(const sd_fft_lctx_t Q,
+                            double* a, ulong m_, ulong depth);
+#endif
+
 /* sd_fft_ctx.c */
 void sd_fft_ctx_clear(sd_fft_ctx_t Q);
 void sd_fft_ctx_init_prime(sd_fft_ctx_t Q, ulong pp);
@@ -266,6 +318,7 @@ FLINT_INLINE void sd_fft_lctx_clear(sd_fft_lctx_t LQ, sd_fft_ctx_t Q)
 {
 }
 
+/* sd_fft_point_mul.c */
 void sd_fft_lctx_point_mul(const sd_fft_lctx_t Q,
                             double* a, const double* b, ulong m_, ulong depth);
 void sd_fft_lctx_point_sqr(const sd_fft_lctx_t Q,
@@ -279,6 +332,11 @@ FLINT_INLINE void sd_fft_lctx_fft_trunc(sd_fft_lctx_t Q, double* d, ulong depth,
     FLINT_ASSERT(otrunc % BLK_SZ == 0);
     FLINT_ASSERT(Q->w2tab[depth - 1] != NULL);
     Q->data = d;
+#if SD_FFT_AVX512_DISPATCH
+    if (flint_get_cpu_features() & FLINT_CPU_AVX512)
+        sd_fft_trunc_avx512(Q, 0, 1, depth - LG_BLK_SZ, 0, itrunc/BLK_SZ, otrunc/BLK_SZ);
+    else
+#endif
     sd_fft_trunc(Q, 0, 1, depth - LG_BLK_SZ, 0, itrunc/BLK_SZ, otrunc/BLK_SZ);
 }
 
@@ -288,6 +346,11 @@ FLINT_INLINE void sd_fft_lctx_ifft_trunc(sd_fft_lctx_t Q, double* d, ulong depth
     FLINT_ASSERT(trunc % BLK_SZ == 0);
     FLINT_ASSERT(Q->w2tab[depth - 1] != NULL);
     Q->data = d;
+#if SD_FFT_AVX512_DISPATCH
+    if (flint_get_cpu_features() & FLINT_CPU_AVX512)
+        sd_ifft_trunc_avx512(Q, 0, 1, depth - LG_BLK_SZ, 0, trunc/BLK_SZ, trunc/BLK_SZ, 0);
+    else
+#endif
     sd_ifft_trunc(Q, 0, 1, depth - LG_BLK_SZ, 0, trunc/BLK_SZ, trunc/BLK_SZ, 0);
 }
 
@@ -525,23 +588,16 @@ int _nmod_poly_divrem_precomp(
 
 mpn_ctx_struct * get_default_mpn_ctx(void);
 
-void mpn_mul_default_mpn_ctx(mp_ptr r1, mp_srcptr i1, mp_size_t n1, mp_srcptr i2, mp_size_t n2);
-void _nmod_poly_mul_mid_default_mpn_ctx(mp_ptr res, slong zl, slong zh, mp_srcptr a, slong an, mp_srcptr b, slong bn, nmod_t mod);
-
-
 int _fmpz_poly_mul_mid_mpn_ctx(
     fmpz * z, ulong zl, ulong zh,
     const fmpz * a, ulong an,
     const fmpz * b, ulong bn,
     mpn_ctx_t R);
 
-int _fmpz_poly_mul_mid_default_mpn_ctx(
-    fmpz * z, slong zl, slong zh,
-    const fmpz * a, slong an,
-    const fmpz * b, slong bn);
-
 #ifdef __cplusplus
 }
 #endif
 
 #endif
+
+#endif
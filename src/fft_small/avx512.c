@@ -0,0 +1,39 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+/*
+    AVX-512 versions of sd_fft_trunc, sd_ifft_trunc, sd_fft_lctx_point_mul
+    and sd_fft_lctx_point_sqr for builds targeting AVX2 only. The target
+    pragma must come before any header so that machine_vectors.h sees
+    __AVX512F__ and picks the 512-bit vec8d. The conditions must match
+    SD_FFT_AVX512_DISPATCH in fft_small.h.
+*/
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) \
+    && defined(__AVX2__) && !defined(__AVX512F__)
+
+#pragma GCC target("avx512f,avx512dq,avx512vl")
+
+#define sd_fft_main sd_fft_main_avx512
+#define sd_fft_trunc sd_fft_trunc_avx512
+#define sd_ifft_trunc sd_ifft_trunc_avx512
+#define sd_fft_lctx_point_mul sd_fft_lctx_point_mul_avx512
+#define sd_fft_lctx_point_sqr sd_fft_lctx_point_sqr_avx512
+
+#include "sd_fft.c"
+#include "sd_ifft.c"
+#include "sd_fft_point_mul.c"
+
+#else
+
+typedef int sd_fft_avx512_dummy;
+
+#endif
@@ -217,14 +217,14 @@ void slow_mpn_to_fft_easy(
             X = vec8d_reduce_to_pm1n(X, p, pinv);
 
             /* _vec8i32_convert_vec8d make the Xs slightly out of order */
-            zI[ir+0*BLK_SZ/8] = X.e1[0];
-            zI[ir+1*BLK_SZ/8] = X.e1[1];
-            zI[ir+4*BLK_SZ/8] = X.e1[2];
-            zI[ir+5*BLK_SZ/8] = X.e1[3];
-            zI[ir+2*BLK_SZ/8] = X.e2[0];
-            zI[ir+3*BLK_SZ/8] = X.e2[1];
-            zI[ir+6*BLK_SZ/8] = X.e2[2];
-            zI[ir+7*BLK_SZ/8] = X.e2[3];
+            zI[ir+0*BLK_SZ/8] = vec8d_get_index(X, 0);
+            zI[ir+1*BLK_SZ/8] = vec8d_get_index(X, 1);
+            zI[ir+4*BLK_SZ/8] = vec8d_get_index(X, 2);
+            zI[ir+5*BLK_SZ/8] = vec8d_get_index(X, 3);
+            zI[ir+2*BLK_SZ/8] = vec8d_get_index(X, 4);
+            zI[ir+3*BLK_SZ/8] = vec8d_get_index(X, 5);
+            zI[ir+6*BLK_SZ/8] = vec8d_get_index(X, 6);
+            zI[ir+7*BLK_SZ/8] = vec8d_get_index(X, 7);
         }
     }
 }
@@ -1143,66 +1143,6 @@ void* mpn_ctx_fit_buffer(mpn_ctx_t R, ulong n)
     return R->buffer;
 }
 
-/* pointwise mul of a with b and m */
-void sd_fft_lctx_point_mul(
-    const sd_fft_lctx_t Q,
-    double* a,
-    const double* b,
-    ulong m_,
-    ulong depth)
-{
-    vec8d m = vec8d_set_d(vec1d_reduce_0n_to_pmhn((slong)m_, Q->p));
-    vec8d n    = vec8d_set_d(Q->p);
-    vec8d ninv = vec8d_set_d(Q->pinv);
-    FLINT_ASSERT(depth >= LG_BLK_SZ);
-    for (ulong I = 0; I < n_pow2(depth - LG_BLK_SZ); I++)
-    {
-        double* ax = a + sd_fft_ctx_blk_offset(I);
-        const double* bx = b + sd_fft_ctx_blk_offset(I);
-        ulong j = 0; do {
-            vec8d x0, x1, b0, b1;
-            x0 = vec8d_load(ax+j+0);
-            x1 = vec8d_load(ax+j+8);
-            b0 = vec8d_load(bx+j+0);
-            b1 = vec8d_load(bx+j+8);
-            x0 = vec8d_mulmod(x0, m, n, ninv);
-            x1 = vec8d_mulmod(x1, m, n, ninv);
-            x0 = vec8d_mulmod(x0, b0, n, ninv);
-            x1 = vec8d_mulmod(x1, b1, n, ninv);
-            vec8d_store(ax+j+0, x0);
-            vec8d_store(ax+j+8, x1);
-        } while (j += 16, j < BLK_SZ);
-    }
-}
-
-void sd_fft_lctx_point_sqr(
-    const sd_fft_lctx_t Q,
-    double* a,
-    ulong m_,
-    ulong depth)
-{
-    vec8d m = vec8d_set_d(vec1d_reduce_0n_to_pmhn((slong)m_, Q->p));
-    vec8d n    = vec8d_set_d(Q->p);
-    vec8d ninv = vec8d_set_d(Q->pinv);
-    FLINT_ASSERT(depth >= LG_BLK_SZ);
-
-    for (ulong I = 0; I < n_pow2(depth - LG_BLK_SZ); I++)
-    {
-        double* ax = a + sd_fft_ctx_blk_offset(I);
-        ulong j = 0; do {
-            vec8d x0, x1;
-            x0 = vec8d_load(ax+j+0);
-            x1 = vec8d_load(ax+j+8);
-            x0 = vec8d_mulmod(x0, x0, n, ninv);
-            x1 = vec8d_mulmod(x1, x1, n, ninv);
-            x0 = vec8d_mulmod(x0, m, n, ninv);
-            x1 = vec8d_mulmod(x1, m, n, ninv);
-            vec8d_store(ax+j+0, x0);
-            vec8d_store(ax+j+8, x1);
-        } while (j += 16, j < BLK_SZ);
-    }
-}
-
 typedef struct {
     to_ffts_func to_ffts;
     sd_fft_ctx_struct* ffts;
@@ -17,7 +17,7 @@
 
         16x 4-wide AVX registers  => N = 8
         32x 2-wide NEON registers => N = 8
-        32x 8-wide AVX512 registers  => N = ?
+        32x 8-wide AVX512 registers  => N = 8
 */
 
 #define N 8
@@ -425,7 +425,7 @@ DEFINE_IT(4, 4)
 
 /************************ the recursive stuff ********************************/
 
-void sd_fft_main_block(
+static void sd_fft_main_block(
     const sd_fft_lctx_t Q,
     ulong I, /* starting index */
     ulong S, /* stride */
@@ -571,7 +571,7 @@ void sd_fft_main(
 }
 
 
-void sd_fft_trunc_block(
+static void sd_fft_trunc_block(
     const sd_fft_lctx_t Q,
     ulong I, // starting index
     ulong S, // stride
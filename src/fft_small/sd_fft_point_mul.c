@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2022 Daniel Schultz
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+/* pointwise mul of a with b and m */
+void sd_fft_lctx_point_mul(
+    const sd_fft_lctx_t Q,
+    double* a,
+    const double* b,
+    ulong m_,
+    ulong depth)
+{
+    vec8d m, n, ninv;
+
+#if SD_FFT_AVX512_DISPATCH
+    if (flint_get_cpu_features() & FLINT_CPU_AVX512)
+    {
+        sd_fft_lctx_point_mul_avx512(Q, a, b, m_, depth);
+        return;
+    }
+#endif
+
+    m = vec8d_set_d(vec1d_reduce_0n_to_pmhn((slong)m_, Q->p));
+    n    = vec8d_set_d(Q->p);
+    ninv = vec8d_set_d(Q->pinv);
+    FLINT_ASSERT(depth >= LG_BLK_SZ);
+    for (ulong I = 0; I < n_pow2(depth - LG_BLK_SZ); I++)
+    {
+        double* ax = a + sd_fft_ctx_blk_offset(I);
+        const double* bx = b + sd_fft_ctx_blk_offset(I);
+        ulong j = 0; do {
+            vec8d x0, x1, b0, b1;
+            x0 = vec8d_load(ax+j+0);
+            x1 = vec8d_load(ax+j+8);
+            b0 = vec8d_load(bx+j+0);
+            b1 = vec8d_load(bx+j+8);
+            x0 = vec8d_mulmod(x0, m, n, ninv);
+            x1 = vec8d_mulmod(x1, m, n, ninv);
+            x0 = vec8d_mulmod(x0, b0, n, ninv);
+            x1 = vec8d_mulmod(x1, b1, n, ninv);
+            vec8d_store(ax+j+0, x0);
+            vec8d_store(ax+j+8, x1);
+        } while (j += 16, j < BLK_SZ);
+    }
+}
+
+void sd_fft_lctx_point_sqr(
+    const sd_fft_lctx_t Q,
+    double* a,
+    ulong m_,
+    ulong depth)
+{
+    vec8d m, n, ninv;
+
+#if SD_FFT_AVX512_DISPATCH
+    if (flint_get_cpu_features() & FLINT_CPU_AVX512)
+    {
+        sd_fft_lctx_point_sqr_avx512(Q, a, m_, depth);
+        return;
+    }
+#endif
+
+    m = vec8d_set_d(vec1d_reduce_0n_to_pmhn((slong)m_, Q->p));
+    n    = vec8d_set_d(Q->p);
+    ninv = vec8d_set_d(Q->pinv);
+    FLINT_ASSERT(depth >= LG_BLK_SZ);
+
+    for (ulong I = 0; I < n_pow2(depth - LG_BLK_SZ); I++)
+    {
+        double* ax = a + sd_fft_ctx_blk_offset(I);
+        ulong j = 0; do {
+            vec8d x0, x1;
+            x0 = vec8d_load(ax+j+0);
+            x1 = vec8d_load(ax+j+8);
+            x0 = vec8d_mulmod(x0, x0, n, ninv);
+            x1 = vec8d_mulmod(x1, x1, n, ninv);
+            x0 = vec8d_mulmod(x0, m, n, ninv);
+            x1 = vec8d_mulmod(x1, m, n, ninv);
+            vec8d_store(ax+j+0, x0);
+            vec8d_store(ax+j+8, x1);
+        } while (j += 16, j < BLK_SZ);
+    }
+}
@@ -395,7 +395,7 @@ DEFINE_IT(1)
 
 /* use with n = m-2 and m >= 6 */
 #define EXTEND_BASECASE(n, m) \
-void CAT3(sd_ifft_basecase, m, 1)(const sd_fft_lctx_t Q, double* X, ulong j_mr, ulong j_bits) \
+static void CAT3(sd_ifft_basecase, m, 1)(const sd_fft_lctx_t Q, double* X, ulong j_mr, ulong j_bits) \
 { \
     ulong l = n_pow2(m - 2); \
     FLINT_ASSERT(j_bits == 0); \
@@ -411,7 +411,7 @@ void CAT3(sd_ifft_basecase, m, 1)(const sd_fft_lctx_t Q, double* X, ulong j_mr,
         FLINT_ASSERT(i == l); \
     } \
 } \
-void CAT3(sd_ifft_basecase, m, 0)(const sd_fft_lctx_t Q, double* X, ulong j_mr, ulong j_bits) \
+static void CAT3(sd_ifft_basecase, m, 0)(const sd_fft_lctx_t Q, double* X, ulong j_mr, ulong j_bits) \
 { \
     ulong l = n_pow2(m - 2); \
     FLINT_ASSERT(j_bits != 0); \
@@ -433,7 +433,7 @@ EXTEND_BASECASE(6, 8)
 #undef EXTEND_BASECASE
 
 /* parameter 1: j can be zero */
-void sd_ifft_base_1(const sd_fft_lctx_t Q, ulong I, ulong j)
+static void sd_ifft_base_1(const sd_fft_lctx_t Q, ulong I, ulong j)
 {
     ulong j_bits, j_mr;
     double* x = sd_fft_lctx_blk_index(Q, I);
@@ -447,7 +447,7 @@ void sd_ifft_base_1(const sd_fft_lctx_t Q, ulong I, ulong j)
 }
 
 /* parameter 0: j cannot be zero */
-void sd_ifft_base_0(const sd_fft_lctx_t Q, ulong I, ulong j)
+static void sd_ifft_base_0(const sd_fft_lctx_t Q, ulong I, ulong j)
 {
     ulong j_bits, j_mr;
     double* x = sd_fft_lctx_blk_index(Q, I);
@@ -1014,7 +1014,7 @@ static void radix_4_moth_inv_trunc_block_0_4_1(
 
 /************************ the recursive stuff ********************************/
 
-void sd_ifft_main_block(
+static void sd_ifft_main_block(
     const sd_fft_lctx_t Q,
     ulong I, /* starting index */
     ulong S, /* stride */
@@ -1087,7 +1087,7 @@ void sd_ifft_main_block(
     }
 }
 
-void sd_ifft_main(
+static void sd_ifft_main(
     const sd_fft_lctx_t Q,
     ulong I, /* starting index */
     ulong S, /* stride */
@@ -1134,7 +1134,7 @@ void sd_ifft_main(
     }
 }
 
-void sd_ifft_trunc_block(
+static void sd_ifft_trunc_block(
     const sd_fft_lctx_t Q,
     ulong I, /* starting index */
     ulong S, /* stride */
@@ -17,6 +17,13 @@
 
 TEST_FUNCTION_START(_fmpz_poly_mul_mid_mpn_ctx, state)
 {
+    if (!FFT_SMALL_AVAILABLE)
+    {
+        FLINT_TEST_CLEANUP(state);
+        printf("SKIPPED\n");
+        return 0;
+    }
+
     mpn_ctx_t R;
 
     mpn_ctx_init(R, UWORD(0x0003f00000000001));
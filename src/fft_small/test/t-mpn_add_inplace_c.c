@@ -36,6 +36,13 @@
 
 TEST_FUNCTION_START(flint_mpn_add_inplace_c, state)
 {
+    if (!FFT_SMALL_AVAILABLE)
+    {
+        FLINT_TEST_CLEANUP(state);
+        printf("SKIPPED\n");
+        return 0;
+    }
+
     slong iter;
 
     _flint_rand_init_gmp(state);
@@ -75,6 +75,13 @@ void test_mul(mpn_ctx_t R, ulong maxsize, ulong nreps, flint_rand_t state)
 
 TEST_FUNCTION_START(mpn_ctx_mpn_mul, state)
 {
+    if (!FFT_SMALL_AVAILABLE)
+    {
+        FLINT_TEST_CLEANUP(state);
+        printf("SKIPPED\n");
+        return 0;
+    }
+
     {
         mpn_ctx_t R;
         mpn_ctx_init(R, UWORD(0x0003f00000000001));
@@ -17,6 +17,13 @@
 
 TEST_FUNCTION_START(_nmod_poly_divrem_mpn_ctx, state)
 {
+    if (!FFT_SMALL_AVAILABLE)
+    {
+        FLINT_TEST_CLEANUP(state);
+        printf("SKIPPED\n");
+        return 0;
+    }
+
     flint_bitcnt_t nbits;
     mpn_ctx_t R;
     nmod_t mod;
@@ -47,6 +47,27 @@ void _fmpz_clear_mpz(fmpz f);
 void _fmpz_cleanup_mpz_content(void);
 void _fmpz_cleanup(void);
 
+typedef struct
+{
+    ulong hits;         /* mpz's reused from the cache */
+    ulong misses;       /* mpz's handed out for the first time */
+    ulong released;     /* mpz's given back instead of being cached */
+    ulong cached;       /* mpz's currently in the cache */
+    ulong cached_limbs; /* limbs held by the mpz's in the cache */
+    ulong peak;         /* largest number of mpz's held in the cache */
+}
+fmpz_mpz_cache_stats_struct;
+
+typedef fmpz_mpz_cache_stats_struct fmpz_mpz_cache_stats_t[1];
+
+void fmpz_mpz_cache_set_high_water(slong num);
+slong fmpz_mpz_cache_get_high_water(void);
+void fmpz_mpz_cache_set_max_limbs(slong limbs);
+slong fmpz_mpz_cache_get_max_limbs(void);
+void fmpz_mpz_cache_trim(slong num);
+void fmpz_mpz_cache_get_stats(fmpz_mpz_cache_stats_t stats);
+void fmpz_mpz_cache_reset_stats(void);
+
 mpz_ptr _fmpz_promote(fmpz_t f);
 mpz_ptr _fmpz_promote_val(fmpz_t f);
 
@@ -73,6 +94,8 @@ void _fmpz_promote_neg_ui(fmpz_t f, ulong v);
 void _fmpz_init_promote_set_ui(fmpz_t f, ulong v);
 void _fmpz_init_promote_set_si(fmpz_t f, slong v);
 
+void _flint_mpz_add_large(mpz_ptr z, mpz_srcptr x, mpz_srcptr y, int negate);
+
 FMPZ_INLINE
 void fmpz_init_set(fmpz_t f, const fmpz_t g)
 {
@@ -352,6 +375,11 @@ int fmpz_fprint(FILE * file, const fmpz_t x);
 
 size_t fmpz_inp_raw(fmpz_t x, FILE * fin);
 size_t fmpz_out_raw(FILE * fout, const fmpz_t x);
+
+int _fmpz_fwrite_bin(FILE * file, const fmpz_t x);
+int _fmpz_fread_bin(FILE * file, fmpz_t x, int swap);
+int fmpz_fwrite_bin(FILE * file, const fmpz_t x);
+int fmpz_fread_bin(FILE * file, fmpz_t x);
 #endif
 
 /* Basic arithmetic **********************************************************/
@@ -13,6 +13,127 @@
 #include "gmpcompat.h"
 #include "ulong_extras.h"
 #include "fmpz.h"
+#include "mpn_extras.h"
+
+#define MPZ_FIT_SIZE(z, nlimbs) \
+    do { \
+        if (z->_mp_alloc < nlimbs) \
+            _mpz_realloc(z, nlimbs); \
+    } while (0)
+
+/*
+    Sets z to x + y, or to x - y if negate is set, working directly on the
+    limbs. Operands of one or two limbs, by far the most common case for
+    promoted fmpz's, are handled without any function call. Will not get
+    called with x or y small.
+*/
+void
+_flint_mpz_add_large(mpz_ptr z, mpz_srcptr x, mpz_srcptr y, int negate)
+{
+    mp_size_t xn, yn, zn, x_sgn, y_sgn;
+    mp_srcptr xd, yd;
+    mp_ptr zd;
+
+    x_sgn = x->_mp_size;
+    y_sgn = negate ? -y->_mp_size : y->_mp_size;
+    xn = FLINT_ABS(x_sgn);
+    yn = FLINT_ABS(y_sgn);
+
+    if (xn < yn)
+    {
+        mpz_srcptr t;
+        mp_size_t tn;
+
+        t = x; x = y; y = t;
+        tn = xn; xn = yn; yn = tn;
+        tn = x_sgn; x_sgn = y_sgn; y_sgn = tn;
+    }
+
+    if (xn <= 2)
+    {
+        mp_limb_t x1, x0, y1, y0, r2, r1, r0;
+
+        /* read the inputs before z is touched, in case of aliasing */
+        x0 = x->_mp_d[0];
+        x1 = (xn == 2) ? x->_mp_d[1] : 0;
+        y0 = y->_mp_d[0];
+        y1 = (yn == 2) ? y->_mp_d[1] : 0;
+
+        if ((x_sgn ^ y_sgn) >= 0)
+        {
+            add_sssaaaaaa(r2, r1, r0, 0, x1, x0, 0, y1, y0);
+            zn = (r2 != 0) ? 3 : 2;
+            MPZ_FIT_SIZE(z, zn);
+            zd = z->_mp_d;
+            zd[0] = r0;
+            zd[1] = r1;
+            if (r2 != 0)
+                zd[2] = r2;
+        }
+        else
+        {
+            if (x1 < y1 || (x1 == y1 && x0 < y0))
+            {
+                sub_ddmmss(r1, r0, y1, y0, x1, x0);
+                x_sgn = y_sgn;
+            }
+            else
+            {
+                sub_ddmmss(r1, r0, x1, x0, y1, y0);
+            }
+
+            MPZ_FIT_SIZE(z, 2);
+            zd = z->_mp_d;
+            zd[0] = r0;
+            zd[1] = r1;
+            zn = 2;
+        }
+
+        while (zn > 0 && zd[zn - 1] == 0)
+            zn--;
+
+        z->_mp_size = (x_sgn >= 0) ? zn : -zn;
+        return;
+    }
+
+    if ((x_sgn ^ y_sgn) >= 0)
+    {
+        mp_limb_t cy;
+
+        MPZ_FIT_SIZE(z, xn + 1);
+        /* read after possibly resizing z, as in flint_mpz_mul */
+        zd = z->_mp_d;
+        xd = x->_mp_d;
+        yd = y->_mp_d;
+
+        cy = mpn_add(zd, xd, xn, yd, yn);
+        zd[xn] = cy;
+        zn = xn + (cy != 0);
+    }
+    else
+    {
+        MPZ_FIT_SIZE(z, xn);
+        zd = z->_mp_d;
+        xd = x->_mp_d;
+        yd = y->_mp_d;
+
+        if (xn == yn && mpn_cmp(xd, yd, xn) < 0)
+        {
+            mpn_sub_n(zd, yd, xd, xn);
+            x_sgn = y_sgn;
+        }
+        else
+        {
+            mpn_sub(zd, xd, xn, yd, yn);
+        }
+
+        zn = xn;
+        while (zn > 0 && zd[zn - 1] == 0)
+            zn--;
+    }
+
+    z->_mp_size = (x_sgn >= 0) ? zn : -zn;
+}
 
 void fmpz_add(fmpz_t f, const fmpz_t g, const fmpz_t h)
 {
@@ -48,7 +169,7 @@ void fmpz_add(fmpz_t f, const fmpz_t g, const fmpz_t h)
             __mpz_struct * mpz3 = _fmpz_promote(f);  /* aliasing means f is already large */
             __mpz_struct * mpz1 = COEFF_TO_PTR(c1);
             __mpz_struct * mpz2 = COEFF_TO_PTR(c2);
-            mpz_add(mpz3, mpz1, mpz2);
+            _flint_mpz_add_large(mpz3, mpz1, mpz2, 0);
             _fmpz_demote_val(f);  /* may have cancelled */
         }
     }
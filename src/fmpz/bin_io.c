@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <limits.h>
+#include "bin_io.h"
+#include "fmpz.h"
+
+int
+_fmpz_fwrite_bin(FILE * file, const fmpz_t x)
+{
+    mp_limb_t w[2];
+
+    if (!COEFF_IS_MPZ(*x))
+    {
+        slong c = *x;
+
+        w[0] = (c > 0) ? 1 : (c < 0) ? -UWORD(1) : 0;
+        w[1] = FLINT_ABS(c);
+
+        return flint_bin_fwrite_limbs(file, w, 1 + (c != 0));
+    }
+    else
+    {
+        mpz_srcptr z = COEFF_TO_PTR(*x);
+
+        w[0] = (slong) z->_mp_size;
+
+        return flint_bin_fwrite_limbs(file, w, 1) &&
+               flint_bin_fwrite_limbs(file, z->_mp_d, FLINT_ABS(z->_mp_size));
+    }
+}
+
+int
+_fmpz_fread_bin(FILE * file, fmpz_t x, int swap)
+{
+    mp_limb_t w;
+    slong size, n, done, k;
+    mpz_ptr z;
+
+    if (!flint_bin_fread_limbs(file, &w, 1, swap))
+        return 0;
+
+    size = (slong) w;
+    n = FLINT_ABS(size);
+
+    if (size == 0)
+    {
+        fmpz_zero(x);
+        return 1;
+    }
+
+    if (size == WORD_MIN || n > INT_MAX)
+        return 0;
+
+    z = _fmpz_promote(x);
+
+    /* n comes from the stream, so only grow z as the limbs arrive */
+    for (done = 0; done < n; done += k)
+    {
+        k = FLINT_MIN(n - done, FLINT_MAX(done, FLINT_BIN_READ_CHUNK));
+
+        if (z->_mp_alloc < done + k)
+            _mpz_realloc(z, done + k);
+
+        if (!flint_bin_fread_limbs(file, z->_mp_d + done, k, swap))
+            break;
+    }
+
+    if (done < n || z->_mp_d[n - 1] == 0)
+    {
+        z->_mp_size = 0;
+        _fmpz_demote_val(x);
+        return 0;
+    }
+
+    z->_mp_size = size;
+    _fmpz_demote_val(x);
+
+    return 1;
+}
+
+int
+fmpz_fwrite_bin(FILE * file, const fmpz_t x)
+{
+    return flint_bin_fwrite_header(file, FLINT_BIN_FMPZ) && _fmpz_fwrite_bin(file, x);
+}
+
+int
+fmpz_fread_bin(FILE * file, fmpz_t x)
+{
+    int swap;
+
+    return flint_bin_fread_header(file, FLINT_BIN_FMPZ, &swap) && _fmpz_fread_bin(file, x, swap);
+}
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include <string.h>
 #include "flint.h"
 #include "gmpcompat.h"
 #include "fmpz.h"
@@ -26,6 +27,10 @@ pthread_mutex_t fmpz_lock;
 /* The number of new mpz's allocated at a time */
 #define MPZ_BLOCK 64
 
+/* see fmpz_mpz_cache_set_high_water */
+static slong mpz_cache_max_limbs = FLINT_MPZ_MAX_CACHE_LIMBS;
+static slong mpz_cache_high_water = WORD_MAX;
+
 /* there's no point using TLS here as GC doesn't support it */
 __mpz_struct ** mpz_free_arr = NULL;
 __mpz_struct ** mpz_arr = NULL;
@@ -34,6 +39,11 @@ ulong mpz_alloc = 0;
 ulong mpz_free_num = 0;
 ulong mpz_free_alloc = 0;
 
+static ulong mpz_cache_hits = 0;
+static ulong mpz_cache_misses = 0;
+static ulong mpz_cache_released = 0;
+static ulong mpz_cache_peak = 0;
+
 #if FLINT_USES_PTHREAD
 void fmpz_lock_init()
 {
@@ -51,10 +61,14 @@ __mpz_struct * _fmpz_new_mpz(void)
 #endif
 
     if (mpz_free_num != 0)
+    {
         z = mpz_free_arr[--mpz_free_num];
+        mpz_cache_hits++;
+    }
     else
     {
         z = flint_malloc(sizeof(__mpz_struct));
+        mpz_cache_misses++;
 
         if (mpz_num == mpz_alloc) /* store pointer to prevent gc cleanup */
         {
@@ -77,13 +91,14 @@ void _fmpz_clear_mpz(fmpz f)
 {
     __mpz_struct * ptr = COEFF_TO_PTR(f);
 
-    if (ptr->_mp_alloc > FLINT_MPZ_MAX_CACHE_LIMBS)
+    if (ptr->_mp_alloc > mpz_cache_max_limbs)
         mpz_realloc2(ptr, 1);
 
 #if FLINT_USES_PTHREAD
     pthread_mutex_lock(&fmpz_lock);
 #endif
 
+    /* the collector owns the memory, so the high-water mark is ignored */
     if (mpz_free_num == mpz_free_alloc)
     {
         mpz_free_alloc = FLINT_MAX(64, mpz_free_alloc * 2);
@@ -92,6 +107,9 @@ void _fmpz_clear_mpz(fmpz f)
 
     mpz_free_arr[mpz_free_num++] = ptr;
 
+    if (mpz_free_num > mpz_cache_peak)
+        mpz_cache_peak = mpz_free_num;
+
 #if FLINT_USES_PTHREAD
     pthread_mutex_unlock(&fmpz_lock);
 #endif
@@ -126,6 +144,99 @@ void _fmpz_cleanup(void)
 #endif
 }
 
+void fmpz_mpz_cache_set_high_water(slong num)
+{
+    mpz_cache_high_water = (num < 0) ? WORD_MAX : num;
+}
+
+slong fmpz_mpz_cache_get_high_water(void)
+{
+    return (mpz_cache_high_water == WORD_MAX) ? -1 : mpz_cache_high_water;
+}
+
+void fmpz_mpz_cache_set_max_limbs(slong limbs)
+{
+    mpz_cache_max_limbs = (limbs < 0) ? FLINT_MPZ_MAX_CACHE_LIMBS : limbs;
+}
+
+slong fmpz_mpz_cache_get_max_limbs(void)
+{
+    return mpz_cache_max_limbs;
+}
+
+void fmpz_mpz_cache_trim(slong num)
+{
+    ulong i, k;
+
+    num = FLINT_MAX(num, 0);
+
+#if FLINT_USES_PTHREAD
+    pthread_once(&fmpz_initialised, fmpz_lock_init);
+    pthread_mutex_lock(&fmpz_lock);
+#endif
+
+    if (mpz_free_num > (ulong) num)
+    {
+        k = mpz_free_num - num;
+
+        /* as for _fmpz_cleanup_mpz_content */
+        for (i = 0; i < k; i++)
+        {
+            mpz_clear(mpz_free_arr[i]);
+            flint_free(mpz_free_arr[i]);
+        }
+
+        memmove(mpz_free_arr, mpz_free_arr + k, num * sizeof(__mpz_struct *));
+        mpz_free_num = num;
+        mpz_cache_released += k;
+    }
+
+#if FLINT_USES_PTHREAD
+    pthread_mutex_unlock(&fmpz_lock);
+#endif
+}
+
+void fmpz_mpz_cache_get_stats(fmpz_mpz_cache_stats_t stats)
+{
+    ulong i, limbs = 0;
+
+#if FLINT_USES_PTHREAD
+    pthread_once(&fmpz_initialised, fmpz_lock_init);
+    pthread_mutex_lock(&fmpz_lock);
+#endif
+
+    for (i = 0; i < mpz_free_num; i++)
+        limbs += mpz_free_arr[i]->_mp_alloc;
+
+    stats->hits = mpz_cache_hits;
+    stats->misses = mpz_cache_misses;
+    stats->released = mpz_cache_released;
+    stats->cached = mpz_free_num;
+    stats->cached_limbs = limbs;
+    stats->peak = mpz_cache_peak;
+
+#if FLINT_USES_PTHREAD
+    pthread_mutex_unlock(&fmpz_lock);
+#endif
+}
+
+void fmpz_mpz_cache_reset_stats(void)
+{
+#if FLINT_USES_PTHREAD
+    pthread_once(&fmpz_initialised, fmpz_lock_init);
+    pthread_mutex_lock(&fmpz_lock);
+#endif
+
+    mpz_cache_hits = 0;
+    mpz_cache_misses = 0;
+    mpz_cache_released = 0;
+    mpz_cache_peak = mpz_free_num;
+
+#if FLINT_USES_PTHREAD
+    pthread_mutex_unlock(&fmpz_lock);
+#endif
+}
+
 __mpz_struct * _fmpz_promote(fmpz_t f)
 {
     if (!COEFF_IS_MPZ(*f)) /* f is small so promote it first */
@@ -13,10 +13,15 @@
 #include "gmpcompat.h"
 #include "fmpz.h"
 
+/* nothing is cached, so every mpz is a miss and is released when cleared */
+static FLINT_TLS_PREFIX ulong mpz_cache_misses = 0;
+static FLINT_TLS_PREFIX ulong mpz_cache_released = 0;
+
 __mpz_struct * _fmpz_new_mpz(void)
 {
     __mpz_struct * mf = (__mpz_struct *) flint_malloc(sizeof(__mpz_struct));
     mpz_init2(mf, 2*FLINT_BITS);
+    mpz_cache_misses++;
     return mf;
 }
 
@@ -24,6 +29,7 @@ void _fmpz_clear_mpz(fmpz f)
 {
     mpz_clear(COEFF_TO_PTR(f));
     flint_free(COEFF_TO_PTR(f));
+    mpz_cache_released++;
 }
 
 void _fmpz_cleanup_mpz_content(void)
@@ -34,6 +40,44 @@ void _fmpz_cleanup(void)
 {
 }
 
+void fmpz_mpz_cache_set_high_water(slong num)
+{
+}
+
+slong fmpz_mpz_cache_get_high_water(void)
+{
+    return 0;
+}
+
+void fmpz_mpz_cache_set_max_limbs(slong limbs)
+{
+}
+
+slong fmpz_mpz_cache_get_max_limbs(void)
+{
+    return 0;
+}
+
+void fmpz_mpz_cache_trim(slong num)
+{
+}
+
+void fmpz_mpz_cache_get_stats(fmpz_mpz_cache_stats_t stats)
+{
+    stats->hits = 0;
+    stats->misses = mpz_cache_misses;
+    stats->released = mpz_cache_released;
+    stats->cached = 0;
+    stats->cached_limbs = 0;
+    stats->peak = 0;
+}
+
+void fmpz_mpz_cache_reset_stats(void)
+{
+    mpz_cache_misses = 0;
+    mpz_cache_released = 0;
+}
+
 __mpz_struct * _fmpz_promote(fmpz_t f)
 {
     if (!COEFF_IS_MPZ(*f))  /* f is small so promote it first */
@@ -18,6 +18,7 @@
 # include <windows.h> /* GetSystemInfo */
 #endif
 
+#include <string.h>
 #include "gmpcompat.h"
 #include "fmpz.h"
 
@@ -44,6 +45,10 @@ typedef struct
 /* Always free larger mpz's to avoid wasting too much heap space */
 #define FLINT_MPZ_MAX_CACHE_LIMBS 64
 
+/* Settings shared by all threads, see fmpz_mpz_cache_set_high_water */
+static slong mpz_cache_max_limbs = FLINT_MPZ_MAX_CACHE_LIMBS;
+static slong mpz_cache_high_water = WORD_MAX;
+
 #define PAGES_PER_BLOCK 16
 
 /* The number of new mpz's allocated at a time */
@@ -53,6 +58,15 @@ FLINT_TLS_PREFIX __mpz_struct ** mpz_free_arr = NULL;
 FLINT_TLS_PREFIX ulong mpz_free_num = 0;
 FLINT_TLS_PREFIX ulong mpz_free_alloc = 0;
 
+static FLINT_TLS_PREFIX ulong mpz_cache_hits = 0;
+static FLINT_TLS_PREFIX ulong mpz_cache_misses = 0;
+static FLINT_TLS_PREFIX ulong mpz_cache_released = 0;
+static FLINT_TLS_PREFIX ulong mpz_cache_peak = 0;
+
+/* number of mpz's at the bottom of mpz_free_arr which come from a new
+   block and have never been handed out */
+static FLINT_TLS_PREFIX ulong mpz_free_fresh = 0;
+
 static slong flint_page_size;
 static slong flint_mpz_structs_per_block;
 static slong flint_page_mask;
@@ -77,6 +91,31 @@ void * flint_align_ptr(void * ptr, slong size)
     return (void *)((mask & (slong) ptr) + size);
 }
 
+/*
+    Give an mpz back to its block, freeing the block once all of its mpz's
+    have been given back. Once this has happened for one mpz of a block,
+    the others are given back too when they are cleared, instead of being
+    cached again, so that the block is eventually freed.
+*/
+static void _fmpz_release_mpz(__mpz_struct * ptr)
+{
+    int new_count;
+    fmpz_block_header_s * header_ptr;
+
+    mpz_clear(ptr);
+
+    header_ptr = (fmpz_block_header_s *)((slong) ptr & flint_page_mask);
+    header_ptr = (fmpz_block_header_s *) header_ptr->address;
+
+#if FLINT_USES_PTHREAD
+    new_count = atomic_fetch_add(&(header_ptr->count), 1) + 1;
+#else
+    new_count = ++header_ptr->count;
+#endif
+    if (new_count == flint_mpz_structs_per_block)
+        flint_free(header_ptr);
+}
+
 __mpz_struct * _fmpz_new_mpz(void)
 {
     if (mpz_free_num == 0) /* allocate more mpz's */
@@ -132,6 +171,19 @@ __mpz_struct * _fmpz_new_mpz(void)
                 mpz_free_arr[mpz_free_num++] = page_ptr + j;
             }
         }
+
+        mpz_cache_peak = FLINT_MAX(mpz_cache_peak, mpz_free_num);
+        mpz_free_fresh = mpz_free_num;
+    }
+
+    if (mpz_free_num <= mpz_free_fresh)
+    {
+        mpz_free_fresh = mpz_free_num - 1;
+        mpz_cache_misses++;
+    }
+    else
+    {
+        mpz_cache_hits++;
     }
 
     return mpz_free_arr[--mpz_free_num];
@@ -146,28 +198,20 @@ void _fmpz_clear_mpz(fmpz f)
 
     header_ptr = (fmpz_block_header_s *) header_ptr->address;
 
-    /* clean up if this is left over from another thread */
+    /* clean up if this is left over from another thread, or if the
+       cache is at its high-water mark */
 #if FLINT_USES_PTHREAD
-    if (header_ptr->count != 0 || !pthread_equal(header_ptr->thread, pthread_self()))
+    if (header_ptr->count != 0 || !pthread_equal(header_ptr->thread, pthread_self())
+                               || mpz_free_num >= (ulong) mpz_cache_high_water)
 #else
-    if (header_ptr->count != 0)
+    if (header_ptr->count != 0 || mpz_free_num >= (ulong) mpz_cache_high_water)
 #endif
     {
-        int new_count;
-
-        mpz_clear(ptr);
-
-#if FLINT_USES_PTHREAD
-       new_count = atomic_fetch_add(&(header_ptr->count), 1) + 1;
-#else
-       new_count = ++header_ptr->count;
-#endif
-        if (new_count == flint_mpz_structs_per_block)
-
-            flint_free(header_ptr);
+        _fmpz_release_mpz(ptr);
+        mpz_cache_released++;
     } else
     {
-        if (ptr->_mp_alloc > FLINT_MPZ_MAX_CACHE_LIMBS)
+        if (ptr->_mp_alloc > mpz_cache_max_limbs)
             mpz_realloc2(ptr, 2*FLINT_BITS);
 
         if (mpz_free_num == mpz_free_alloc)
@@ -177,6 +221,9 @@ void _fmpz_clear_mpz(fmpz f)
         }
 
         mpz_free_arr[mpz_free_num++] = ptr;
+
+        if (mpz_free_num > mpz_cache_peak)
+            mpz_cache_peak = mpz_free_num;
     }
 }
 
@@ -185,27 +232,10 @@ void _fmpz_cleanup_mpz_content(void)
     ulong i;
 
     for (i = 0; i < mpz_free_num; i++)
-    {
-       int new_count;
-       fmpz_block_header_s * ptr;
-
-       mpz_clear(mpz_free_arr[i]);
-
-       /* update count of cleared mpz's for block */
-       ptr = (fmpz_block_header_s *)((slong) mpz_free_arr[i] & ~(flint_page_size - 1));
-
-       ptr = (fmpz_block_header_s *) ptr->address;
-
-#if FLINT_USES_PTHREAD
-       new_count = atomic_fetch_add(&(ptr->count), 1) + 1;
-#else
-       new_count = ++ptr->count;
-#endif
-       if (new_count == flint_mpz_structs_per_block)
-          flint_free(ptr);
-    }
+        _fmpz_release_mpz(mpz_free_arr[i]);
 
     mpz_free_num = mpz_free_alloc = 0;
+    mpz_free_fresh = 0;
 }
 
 void _fmpz_cleanup(void)
@@ -215,6 +245,86 @@ void _fmpz_cleanup(void)
     mpz_free_arr = NULL;
 }
 
+void fmpz_mpz_cache_set_high_water(slong num)
+{
+    mpz_cache_high_water = (num < 0) ? WORD_MAX : num;
+}
+
+slong fmpz_mpz_cache_get_high_water(void)
+{
+    return (mpz_cache_high_water == WORD_MAX) ? -1 : mpz_cache_high_water;
+}
+
+void fmpz_mpz_cache_set_max_limbs(slong limbs)
+{
+    mpz_cache_max_limbs = (limbs < 0) ? FLINT_MPZ_MAX_CACHE_LIMBS : limbs;
+}
+
+slong fmpz_mpz_cache_get_max_limbs(void)
+{
+    return mpz_cache_max_limbs;
+}
+
+void fmpz_mpz_cache_trim(slong num)
+{
+    ulong i, k;
+
+    num = FLINT_MAX(num, 0);
+
+    if (mpz_free_num <= (ulong) num)
+        return;
+
+    /* the mpz's at the bottom of the stack are the least recently used */
+    k = mpz_free_num - num;
+
+    for (i = 0; i < k; i++)
+        _fmpz_release_mpz(mpz_free_arr[i]);
+
+    mpz_cache_released += k;
+    mpz_free_num = num;
+    mpz_free_fresh = (mpz_free_fresh > k) ? mpz_free_fresh - k : 0;
+
+    if (num == 0)
+    {
+        flint_free(mpz_free_arr);
+        mpz_free_arr = NULL;
+        mpz_free_alloc = 0;
+    }
+    else
+    {
+        memmove(mpz_free_arr, mpz_free_arr + k, num * sizeof(__mpz_struct *));
+
+        if (mpz_free_alloc > 4 * (ulong) num)
+        {
+            mpz_free_alloc = FLINT_MAX(64, 2 * num);
+            mpz_free_arr = flint_realloc(mpz_free_arr, mpz_free_alloc * sizeof(__mpz_struct *));
+        }
+    }
+}
+
+void fmpz_mpz_cache_get_stats(fmpz_mpz_cache_stats_t stats)
+{
+    ulong i, limbs = 0;
+
+    for (i = 0; i < mpz_free_num; i++)
+        limbs += mpz_free_arr[i]->_mp_alloc;
+
+    stats->hits = mpz_cache_hits;
+    stats->misses = mpz_cache_misses;
+    stats->released = mpz_cache_released;
+    stats->cached = mpz_free_num;
+    stats->cached_limbs = limbs;
+    stats->peak = mpz_cache_peak;
+}
+
+void fmpz_mpz_cache_reset_stats(void)
+{
+    mpz_cache_hits = 0;
+    mpz_cache_misses = 0;
+    mpz_cache_released = 0;
+    mpz_cache_peak = mpz_free_num;
+}
+
 __mpz_struct * _fmpz_promote(fmpz_t f)
 {
     if (!COEFF_IS_MPZ(*f)) /* f is small so promote it first */
@@ -57,7 +57,7 @@ fmpz_sub(fmpz_t f, const fmpz_t g, const fmpz_t h)
             __mpz_struct *mpz3 = _fmpz_promote(f);  /* aliasing means f is already large */
             __mpz_struct *mpz1 = COEFF_TO_PTR(c1);
             __mpz_struct *mpz2 = COEFF_TO_PTR(c2);
-            mpz_sub(mpz3, mpz1, mpz2);
+            _flint_mpz_add_large(mpz3, mpz1, mpz2, 1);
             _fmpz_demote_val(f);    /* may have cancelled */
         }
     }
@@ -53,7 +53,27 @@ fmpz_tdiv_q(fmpz_t f, const fmpz_t g, const fmpz_t h)
         }
         else                    /* both are large */
         {
-            if (MPZ_WANT_FLINT_DIVISION(COEFF_TO_PTR(c1), COEFF_TO_PTR(c2)))
+            __mpz_struct * mg = COEFF_TO_PTR(c1);
+            __mpz_struct * mh = COEFF_TO_PTR(c2);
+
+            if (mh->_mp_size == 1 || mh->_mp_size == -1)
+            {
+                /* single limb divisor, work on the limbs directly */
+                mp_size_t gn = FLINT_ABS(mg->_mp_size);
+                mp_limb_t d = mh->_mp_d[0];
+                int neg = (mg->_mp_size ^ mh->_mp_size) < 0;
+
+                mf = _fmpz_promote(f);  /* g is large, so aliasing is safe */
+                if (mf->_mp_alloc < gn)
+                    _mpz_realloc(mf, gn);
+
+                mpn_divrem_1(mf->_mp_d, 0, mg->_mp_d, gn, d);
+                gn -= (mf->_mp_d[gn - 1] == 0);
+                mf->_mp_size = neg ? -gn : gn;
+
+                _fmpz_demote_val(f);    /* division by h may result in small value */
+            }
+            else if (MPZ_WANT_FLINT_DIVISION(mg, mh))
             {
                 _fmpz_tdiv_q_newton(f, g, h);
             }
@@ -88,6 +88,7 @@
 #include "t-fmpz.c"
 #include "t-fmpz_cleanup.c"
 #include "t-fmpz_stress.c"
+#include "t-fwrite_fread_bin.c"
 #include "t-gcd3.c"
 #include "t-gcd.c"
 #include "t-gcdinv.c"
@@ -124,6 +125,7 @@
 #include "t-mod.c"
 #include "t-mod_ui.c"
 #include "t-moebius_mu.c"
+#include "t-mpz_cache.c"
 #include "t-mpz_init_set_readonly.c"
 #include "t-mul_2exp.c"
 #include "t-mul2_uiui.c"
@@ -258,6 +260,7 @@ test_struct tests[] =
     TEST_FUNCTION(fmpz_fmms),
     TEST_FUNCTION(fmpz_fmpz),
     TEST_FUNCTION(fmpz_cleanup),
+    TEST_FUNCTION(fmpz_fwrite_fread_bin),
     TEST_FUNCTION(fmpz_stress),
     TEST_FUNCTION(fmpz_gcd3),
     TEST_FUNCTION(fmpz_gcd),
@@ -295,6 +298,7 @@ test_struct tests[] =
     TEST_FUNCTION(fmpz_mod),
     TEST_FUNCTION(fmpz_mod_ui),
     TEST_FUNCTION(fmpz_moebius_mu),
+    TEST_FUNCTION(fmpz_mpz_cache),
     TEST_FUNCTION(fmpz_mpz_init_set_readonly),
     TEST_FUNCTION(fmpz_mul_2exp),
     TEST_FUNCTION(fmpz_mul2_uiui),
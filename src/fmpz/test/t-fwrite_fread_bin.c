@@ -0,0 +1,140 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <limits.h>
+#include "test_helpers.h"
+#include "bin_io.h"
+#include "fmpz.h"
+
+TEST_FUNCTION_START(fmpz_fwrite_fread_bin, state)
+{
+    slong iter;
+
+/* assume tmpfile() is broken on windows */
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz x[5];
+        fmpz_t y;
+        FILE * tmp;
+        slong i, n;
+
+        n = 1 + n_randint(state, 5);
+        for (i = 0; i < n; i++)
+        {
+            fmpz_init(x + i);
+            fmpz_randtest(x + i, state, 1 + n_randint(state, 1000));
+        }
+        fmpz_init(y);
+        fmpz_randtest(y, state, 200);
+
+        tmp = tmpfile();
+        if (tmp == NULL)
+        {
+            flint_printf("FAIL (creating temporary file)\n");
+            flint_abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            if (!fmpz_fwrite_bin(tmp, x + i))
+            {
+                flint_printf("FAIL (write)\n");
+                flint_abort();
+            }
+        }
+
+        rewind(tmp);
+
+        for (i = 0; i < n; i++)
+        {
+            if (!fmpz_fread_bin(tmp, y) || !fmpz_equal(x + i, y) || !_fmpz_is_canonical(y))
+            {
+                flint_printf("FAIL (roundtrip)\n");
+                flint_printf("x = "); fmpz_print(x + i); flint_printf("\n");
+                flint_printf("y = "); fmpz_print(y); flint_printf("\n");
+                flint_abort();
+            }
+        }
+
+        if (fmpz_fread_bin(tmp, y))
+        {
+            flint_printf("FAIL (read past the end)\n");
+            flint_abort();
+        }
+
+        fclose(tmp);
+
+        for (i = 0; i < n; i++)
+            fmpz_clear(x + i);
+        fmpz_clear(y);
+    }
+
+    /* an integer above FLINT_BIN_READ_CHUNK limbs */
+    {
+        fmpz_t x, y;
+        FILE * tmp;
+
+        fmpz_init(x);
+        fmpz_init(y);
+        fmpz_randbits(x, state, (FLINT_BIN_READ_CHUNK + 1000) * FLINT_BITS);
+
+        tmp = tmpfile();
+        if (tmp == NULL || !fmpz_fwrite_bin(tmp, x))
+        {
+            flint_printf("FAIL (write large)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+        if (!fmpz_fread_bin(tmp, y) || !fmpz_equal(x, y))
+        {
+            flint_printf("FAIL (roundtrip large)\n");
+            flint_abort();
+        }
+
+        fclose(tmp);
+        fmpz_clear(x);
+        fmpz_clear(y);
+    }
+
+    /* sizes in a corrupt header must not be trusted */
+    {
+        mp_limb_t w[2] = { INT_MAX, 1 };
+        FILE * tmp = tmpfile();
+        fmpz_t y;
+
+        if (tmp == NULL || !flint_bin_fwrite_header(tmp, FLINT_BIN_FMPZ) ||
+            !flint_bin_fwrite_limbs(tmp, w, 2))
+        {
+            flint_printf("FAIL (writing corrupt header)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+        fmpz_init(y);
+
+        if (fmpz_fread_bin(tmp, y) || !_fmpz_is_canonical(y))
+        {
+            flint_printf("FAIL (corrupt header)\n");
+            flint_abort();
+        }
+
+        fmpz_clear(y);
+        fclose(tmp);
+    }
+
+#endif
+
+    TEST_FUNCTION_END(state);
+}
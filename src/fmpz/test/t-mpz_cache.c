@@ -0,0 +1,141 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "ulong_extras.h"
+
+TEST_FUNCTION_START(fmpz_mpz_cache, state)
+{
+    slong iter;
+    slong old_high_water, old_max_limbs;
+
+    old_high_water = fmpz_mpz_cache_get_high_water();
+    old_max_limbs = fmpz_mpz_cache_get_max_limbs();
+
+    for (iter = 0; iter < 300 * flint_test_multiplier(); iter++)
+    {
+        slong i, n, m;
+        fmpz *A, *B;
+        fmpz_t s1, s2;
+        fmpz_mpz_cache_stats_t stats;
+
+        n = n_randint(state, 200);
+
+        if (n_randint(state, 2))
+            fmpz_mpz_cache_set_high_water(n_randint(state, 300));
+        else
+            fmpz_mpz_cache_set_high_water(-1);
+
+        fmpz_mpz_cache_set_max_limbs(n_randint(state, 100));
+
+        /* every promotion counts as either a hit or a miss */
+        fmpz_mpz_cache_reset_stats();
+
+        A = _fmpz_vec_init(n);
+        B = _fmpz_vec_init(n);
+
+        for (i = 0; i < n; i++)
+            fmpz_set_ui(A + i, COEFF_MAX + 1 + n_randlimb(state) / 2);
+
+        fmpz_mpz_cache_get_stats(stats);
+
+        if (stats->hits + stats->misses != n)
+        {
+            flint_printf("FAIL (hits + misses)\n");
+            flint_printf("n = %wd, hits = %wu, misses = %wu\n",
+                n, stats->hits, stats->misses);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* trimming in the middle of a computation does not change it */
+        fmpz_init(s1);
+        fmpz_init(s2);
+
+        for (i = 0; i < n; i++)
+        {
+            fmpz_randtest(B + i, state, 1 + n_randint(state, 1000));
+            fmpz_mul(A + i, A + i, B + i);
+            fmpz_add(s1, s1, A + i);
+        }
+
+        _fmpz_vec_clear(B, n);
+
+        m = n_randint(state, 100);
+        fmpz_mpz_cache_trim(m);
+        fmpz_mpz_cache_get_stats(stats);
+
+        if (stats->cached > m)
+        {
+            flint_printf("FAIL (trim)\n");
+            flint_printf("m = %wd, cached = %wu\n", m, stats->cached);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        for (i = 0; i < n; i++)
+            fmpz_add(s2, s2, A + i);
+
+        if (!fmpz_equal(s1, s2))
+        {
+            flint_printf("FAIL (values)\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _fmpz_vec_clear(A, n);
+        fmpz_clear(s1);
+        fmpz_clear(s2);
+
+        if (n_randint(state, 10) == 0)
+        {
+            fmpz_mpz_cache_trim(0);
+            fmpz_mpz_cache_get_stats(stats);
+
+            if (stats->cached != 0 || stats->cached_limbs != 0)
+            {
+                flint_printf("FAIL (trim to zero)\n");
+                flint_printf("cached = %wu, cached_limbs = %wu\n",
+                    stats->cached, stats->cached_limbs);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            /* with nothing cached, every mpz is a miss */
+            fmpz_mpz_cache_reset_stats();
+
+            A = _fmpz_vec_init(n);
+
+            for (i = 0; i < n; i++)
+                fmpz_set_ui(A + i, COEFF_MAX + 1 + i);
+
+            fmpz_mpz_cache_get_stats(stats);
+
+            if (stats->hits != 0 || stats->misses != n)
+            {
+                flint_printf("FAIL (misses)\n");
+                flint_printf("n = %wd, hits = %wu, misses = %wu\n",
+                    n, stats->hits, stats->misses);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            _fmpz_vec_clear(A, n);
+        }
+    }
+
+    fmpz_mpz_cache_set_high_water(old_high_water);
+    fmpz_mpz_cache_set_max_limbs(old_max_limbs);
+
+    TEST_FUNCTION_END(state);
+}
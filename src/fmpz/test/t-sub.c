@@ -32,8 +32,8 @@ TEST_FUNCTION_START(fmpz_sub, state)
         mpz_init(f);
         mpz_init(g);
 
-        fmpz_randtest(a, state, 200);
-        fmpz_randtest(b, state, 200);
+        fmpz_randtest(a, state, n_randint(state, 2) ? 200 : 2 * FLINT_BITS);
+        fmpz_randtest(b, state, n_randint(state, 2) ? 200 : 2 * FLINT_BITS);
 
         fmpz_get_mpz(d, a);
         fmpz_get_mpz(e, b);
@@ -119,6 +119,8 @@ typedef struct ecm_s {
     mp_limb_t n_size;
     mp_limb_t normbits;
 
+    const volatile int * stop; /* if set and nonzero, stages return early */
+
 } ecm_s;
 
 typedef ecm_s ecm_t[1];
@@ -155,6 +157,12 @@ int fmpz_factor_ecm_stage_I(mp_ptr f, const mp_limb_t *prime_array,
 int fmpz_factor_ecm_stage_II(mp_ptr f, mp_limb_t B1, mp_limb_t B2,
                                        mp_limb_t P, mp_ptr n, ecm_t ecm_inf);
 
+int fmpz_factor_ecm_stage_II_fft(mp_ptr f, mp_limb_t B1, mp_limb_t B2,
+                                       mp_limb_t P, mp_ptr n, ecm_t ecm_inf);
+
+/* Value of B2 from which fmpz_factor_ecm uses the FFT continuation */
+#define FMPZ_FACTOR_ECM_FFT_B2_CUTOFF 100000
+
 int fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1,
                         mp_limb_t B2, flint_rand_t state, const fmpz_t n_in);
 
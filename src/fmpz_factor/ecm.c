@@ -16,6 +16,7 @@
 #include "mpn_extras.h"
 #include "fmpz.h"
 #include "fmpz_factor.h"
+#include "thread_support.h"
 
 static
 ulong n_ecm_primorial[] =
@@ -43,16 +44,130 @@ ulong n_ecm_primorial[] =
 #define num_n_ecm_primorials 9
 #endif
 
+typedef struct
+{
+    mp_srcptr n;
+    const ecm_s * ecm_inf;      /* shared precomputations */
+    mp_srcptr sigs;             /* normalised sigma for each curve */
+    mp_limb_t curves;
+    const mp_limb_t * prime_array;
+    mp_limb_t num, B1, B2, P;
+    int fft;
+    mp_limb_t next;             /* next curve to try */
+    volatile int stop;          /* set once a factor has been found */
+    int ret;
+    mp_ptr fac;
+    mp_size_t fac_size;
+#if FLINT_USES_PTHREAD
+    pthread_mutex_t mutex;
+#endif
+}
+_ecm_worker_arg_struct;
+
+/* try curves until all have been tried or some worker found a factor */
+static void
+_ecm_worker(slong idx, void * varg)
+{
+    _ecm_worker_arg_struct * arg = (_ecm_worker_arg_struct *) varg;
+    mp_limb_t n_size = arg->ecm_inf->n_size;
+    mp_ptr n = (mp_ptr) arg->n;
+    mp_ptr f, mpsig;
+    mp_limb_t j;
+    ecm_t ecm_inf;
+    int ret, stage;
+
+    fmpz_factor_ecm_init(ecm_inf, n_size);
+    flint_mpn_copyi(ecm_inf->ninv, arg->ecm_inf->ninv, n_size);
+    flint_mpn_copyi(ecm_inf->one, arg->ecm_inf->one, n_size);
+    ecm_inf->normbits = arg->ecm_inf->normbits;
+    ecm_inf->GCD_table = arg->ecm_inf->GCD_table;
+    ecm_inf->prime_table = arg->ecm_inf->prime_table;
+    ecm_inf->stop = &arg->stop;
+
+    f = flint_malloc((n_size + 1) * sizeof(mp_limb_t));
+    mpsig = flint_malloc(n_size * sizeof(mp_limb_t));
+
+    while (1)
+    {
+#if FLINT_USES_PTHREAD
+        pthread_mutex_lock(&arg->mutex);
+#endif
+        j = arg->next;
+        if (!arg->stop && j < arg->curves)
+            arg->next++;
+#if FLINT_USES_PTHREAD
+        pthread_mutex_unlock(&arg->mutex);
+#endif
+
+        if (arg->stop || j >= arg->curves)
+            break;
+
+        flint_mpn_copyi(mpsig, arg->sigs + j * n_size, n_size);
+
+        /************************ SELECT CURVE ************************/
+
+        ret = fmpz_factor_ecm_select_curve(f, mpsig, n, ecm_inf);
+        stage = -1;
+
+        if (ret == 0)
+        {
+            /************************** STAGE I ***************************/
+
+            ret = fmpz_factor_ecm_stage_I(f, arg->prime_array, arg->num,
+                                                           arg->B1, n, ecm_inf);
+            stage = 1;
+
+            /************************** STAGE II ***************************/
+
+            if (ret == 0 && !arg->stop)
+            {
+                if (arg->fft)
+                    ret = fmpz_factor_ecm_stage_II_fft(f, arg->B1, arg->B2,
+                                                          arg->P, n, ecm_inf);
+                else
+                    ret = fmpz_factor_ecm_stage_II(f, arg->B1, arg->B2,
+                                                          arg->P, n, ecm_inf);
+                stage = 2;
+            }
+        }
+
+        if (ret > 0)
+        {
+#if FLINT_USES_PTHREAD
+            pthread_mutex_lock(&arg->mutex);
+#endif
+            if (!arg->stop)
+            {
+                flint_mpn_copyi(arg->fac, f, ret);
+                arg->fac_size = ret;
+                arg->ret = stage;
+                arg->stop = 1;
+            }
+#if FLINT_USES_PTHREAD
+            pthread_mutex_unlock(&arg->mutex);
+#endif
+            break;
+        }
+    }
+
+    flint_free(f);
+    flint_free(mpsig);
+
+    fmpz_factor_ecm_clear(ecm_inf);
+}
+
 int
 fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
                 flint_rand_t state, const fmpz_t n_in)
 {
     fmpz_t sig, nm8;
     mp_limb_t P, num, maxP, mmin, mmax, mdiff, prod, maxj, n_size, cy;
-    int i, j, ret;
+    slong num_workers;
+    int i, j, ret, fft;
     ecm_t ecm_inf;
     __mpz_struct *fac, *mptr;
-    mp_ptr n, mpsig;
+    mp_ptr n, mpsig, sigs;
+    _ecm_worker_arg_struct arg;
 
     TMP_INIT;
 
@@ -71,7 +186,6 @@ fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
     TMP_START;
 
     n      = TMP_ALLOC(n_size * sizeof(mp_limb_t));
-    mpsig  = TMP_ALLOC(n_size * sizeof(mp_limb_t));
 
     if ((!COEFF_IS_MPZ(* n_in)))
     {
@@ -109,7 +223,13 @@ fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
 
     /************************ STAGE II PRECOMPUTATIONS ***********************/
 
+    /* the FFT continuation is cheaper per baby step, so it uses a larger
+       primorial than the classical stage II */
+    fft = (B2 >= FMPZ_FACTOR_ECM_FFT_B2_CUTOFF);
+
     maxP = n_sqrt(B2);
+    if (fft)
+        maxP = FLINT_MIN(8 * maxP, B1);
 
     /* Selecting primorial */
 
@@ -140,44 +260,53 @@ fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
             ecm_inf->GCD_table[j] = 0;
     }
 
-    /* compute prime table */
+    /* compute prime table, only needed by the classical stage II */
 
-    ecm_inf->prime_table = flint_malloc(mdiff * sizeof(unsigned char*));
-
-    for (i = 0; i < mdiff; i++)
-        ecm_inf->prime_table[i] = flint_malloc((maxj + 1) * sizeof(unsigned char));
-
-    for (i = 0; i < mdiff; i++)
+    if (fft)
     {
-        for (j = 1; j <= maxj; j += 2)
-        {
-            ecm_inf->prime_table[i][j] = 0;
+        ecm_inf->prime_table = NULL;
+    }
+    else
+    {
+        ecm_inf->prime_table = flint_malloc(mdiff * sizeof(unsigned char*));
 
-            /* if (i + mmin)*P + j
-               is prime, mark 1. Can be possibly prime
-               only if gcd(j, P) = 1 */
+        for (i = 0; i < mdiff; i++)
+            ecm_inf->prime_table[i] = flint_malloc((maxj + 1) * sizeof(unsigned char));
 
-            if (ecm_inf->GCD_table[j] == 1)
+        for (i = 0; i < mdiff; i++)
+        {
+            for (j = 1; j <= maxj; j += 2)
             {
-                prod = (i + mmin)*P + j;
-                if (n_is_prime(prod))
-                    ecm_inf->prime_table[i][j] = 1;
-
-                prod = (i + mmin)*P - j;
-                if (n_is_prime(prod))
-                    ecm_inf->prime_table[i][j] = 1;
+                ecm_inf->prime_table[i][j] = 0;
+
+                /* if (i + mmin)*P + j
+                   is prime, mark 1. Can be possibly prime
+                   only if gcd(j, P) = 1 */
+
+                if (ecm_inf->GCD_table[j] == 1)
+                {
+                    prod = (i + mmin)*P + j;
+                    if (n_is_prime(prod))
+                        ecm_inf->prime_table[i][j] = 1;
+
+                    prod = (i + mmin)*P - j;
+                    if (n_is_prime(prod))
+                        ecm_inf->prime_table[i][j] = 1;
+                }
             }
         }
     }
 
+    /**************************** SELECT SIGMAS *****************************/
 
-    /****************************** TRY "CURVES" *****************************/
+    sigs = flint_malloc(curves * n_size * sizeof(mp_limb_t));
 
     for (j = 0; j < curves; j++)
     {
         fmpz_randm(sig, state, nm8);
         fmpz_add_ui(sig, sig, 7);
 
+        mpsig = sigs + j * n_size;
         mpn_zero(mpsig, ecm_inf->n_size);
 
         if ((!COEFF_IS_MPZ(*sig)))
@@ -204,70 +333,65 @@ fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
                 flint_mpn_copyi(mpsig, mptr->_mp_d, mptr->_mp_size);
             }
         }
+    }
 
-        /************************ SELECT CURVE ************************/
-
-        ret = fmpz_factor_ecm_select_curve(fac->_mp_d, mpsig, n, ecm_inf);
-
-        if (ret)
-        {
-            /* Found factor while selecting curve,
-               very very lucky :) */
+    /****************************** TRY "CURVES" *****************************/
 
-            if (ecm_inf->normbits)
-               mpn_rshift(fac->_mp_d, fac->_mp_d, ret, ecm_inf->normbits);
-            MPN_NORM(fac->_mp_d, ret);
+    /* curves are shared out between the threads; the first factor found
+       stops the others */
+
+    arg.n = n;
+    arg.ecm_inf = ecm_inf;
+    arg.sigs = sigs;
+    arg.curves = curves;
+    arg.prime_array = prime_array;
+    arg.num = num;
+    arg.B1 = B1;
+    arg.B2 = B2;
+    arg.P = P;
+    arg.fft = fft;
+    arg.next = 0;
+    arg.stop = 0;
+    arg.ret = 0;
+    arg.fac = fac->_mp_d;
+    arg.fac_size = 0;
+#if FLINT_USES_PTHREAD
+    pthread_mutex_init(&arg.mutex, NULL);
+#endif
 
-            fac->_mp_size = ret;
-            _fmpz_demote_val(f);
-            ret = -1;
-            goto cleanup;
-        }
+    num_workers = FLINT_MIN(flint_get_num_threads(), curves);
+    num_workers = FLINT_MAX(num_workers, 1);
 
-        if (ret != -1)
-        {
+    flint_parallel_do(_ecm_worker, &arg, num_workers, 0, FLINT_PARALLEL_UNIFORM);
 
-            /************************** STAGE I ***************************/
+#if FLINT_USES_PTHREAD
+    pthread_mutex_destroy(&arg.mutex);
+#endif
 
-            ret = fmpz_factor_ecm_stage_I(fac->_mp_d, prime_array, num, B1, n, ecm_inf);
+    ret = arg.ret;
 
-            if (ret)
-            {
-                /* Found factor after stage I */
-                if (ecm_inf->normbits)
-                   mpn_rshift(fac->_mp_d, fac->_mp_d, ret, ecm_inf->normbits);
-                MPN_NORM(fac->_mp_d, ret);
-
-                fac->_mp_size = ret;
-                _fmpz_demote_val(f);
-                ret = 1;
-                goto cleanup;
-            }
-            /************************** STAGE II ***************************/
+    if (ret != 0)
+    {
+        /* ret = -1 if found while selecting the curve, else the stage */
+        mp_size_t size = arg.fac_size;
 
-            ret = fmpz_factor_ecm_stage_II(fac->_mp_d, B1, B2, P, n, ecm_inf);
+        if (ecm_inf->normbits)
+           mpn_rshift(fac->_mp_d, fac->_mp_d, size, ecm_inf->normbits);
+        MPN_NORM(fac->_mp_d, size);
 
-            if (ret)
-            {
-                /* Found factor after stage II */
-                if (ecm_inf->normbits)
-                   mpn_rshift(fac->_mp_d, fac->_mp_d, ret, ecm_inf->normbits);
-                MPN_NORM(fac->_mp_d, ret);
-                fac->_mp_size = ret;
-                _fmpz_demote_val(f);
-                ret = 2;
-                goto cleanup;
-            }
-        }
+        fac->_mp_size = size;
+        _fmpz_demote_val(f);
     }
 
-    cleanup:
-
+    flint_free(sigs);
 
     flint_free(ecm_inf->GCD_table);
-    for (i = 0; i < mdiff; i++)
-        flint_free(ecm_inf->prime_table[i]);
-    flint_free(ecm_inf->prime_table);
+    if (!fft)
+    {
+        for (i = 0; i < mdiff; i++)
+            flint_free(ecm_inf->prime_table[i]);
+        flint_free(ecm_inf->prime_table);
+    }
 
     fmpz_factor_ecm_clear(ecm_inf);
 
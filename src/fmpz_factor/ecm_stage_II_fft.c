@@ -0,0 +1,276 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "mpn_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mod.h"
+#include "fmpz_mod_poly.h"
+#include "fmpz_factor.h"
+
+/* Implementation of the stage II of ECM using the FFT continuation:
+   with x_j the affine x-coordinates of the baby steps j Q0 and y_i those
+   of the giant steps i P Q0, the product of all x_j - y_i is obtained by
+   evaluating F(X) = prod_j (X - x_j) at the y_i with a product tree. */
+
+/* r = x / 2^normbits, where x is a normalised residue */
+static void
+_fmpz_set_mpn_unnorm(fmpz_t r, mp_srcptr x, mp_limb_t sz, mp_limb_t normbits)
+{
+    fmpz_set_ui_array(r, x, sz);
+    fmpz_fdiv_q_2exp(r, r, normbits);
+}
+
+/* store the factor g in normalised form, returning its number of limbs */
+static int
+_ecm_set_factor(mp_ptr f, const fmpz_t g, ecm_t ecm_inf)
+{
+    fmpz_t t;
+    slong sz;
+
+    fmpz_init(t);
+    fmpz_mul_2exp(t, g, ecm_inf->normbits);
+    sz = fmpz_size(t);
+    fmpz_get_ui_array(f, sz, t);
+    fmpz_clear(t);
+
+    return sz;
+}
+
+/* returns 1 if g = gcd(a, n) is a proper factor of n */
+static int
+_ecm_proper_gcd(fmpz_t g, const fmpz_t a, const fmpz_t n)
+{
+    fmpz_gcd(g, a, n);
+    return !fmpz_is_one(g) && !fmpz_equal(g, n);
+}
+
+/*
+    Replace (X[k] : Z[k]) by the affine coordinate X[k] / Z[k] using a
+    single inversion. Returns 1 and sets g if some Z[k] has a proper
+    factor in common with n. Points with Z[k] = 0 mod n are mapped to 0.
+*/
+static int
+_ecm_normalize(fmpz_t g, fmpz * X, fmpz * Z, slong len, const fmpz_t n,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    fmpz * T;
+    fmpz_t inv, u;
+    slong k;
+    int found = 0;
+
+    T = _fmpz_vec_init(len);
+    fmpz_init(inv);
+    fmpz_init(u);
+
+    while (1)
+    {
+        fmpz_set(T + 0, Z + 0);
+        for (k = 1; k < len; k++)
+            fmpz_mod_mul(T + k, T + k - 1, Z + k, ctx);
+
+        if (fmpz_invmod(inv, T + len - 1, n))
+            break;
+
+        if (_ecm_proper_gcd(g, T + len - 1, n))
+        {
+            found = 1;
+            goto cleanup;
+        }
+
+        for (k = 0; k < len; k++)
+        {
+            if (_ecm_proper_gcd(g, Z + k, n))
+            {
+                found = 1;
+                goto cleanup;
+            }
+
+            if (!fmpz_is_one(g))
+            {
+                fmpz_zero(X + k);
+                fmpz_one(Z + k);
+            }
+        }
+    }
+
+    for (k = len - 1; k > 0; k--)
+    {
+        fmpz_mod_mul(u, inv, T + k - 1, ctx);
+        fmpz_mod_mul(inv, inv, Z + k, ctx);
+        fmpz_mod_mul(X + k, X + k, u, ctx);
+    }
+
+    fmpz_mod_mul(X + 0, X + 0, inv, ctx);
+
+cleanup:
+
+    _fmpz_vec_clear(T, len);
+    fmpz_clear(inv);
+    fmpz_clear(u);
+
+    return found;
+}
+
+int
+fmpz_factor_ecm_stage_II_fft(mp_ptr f, mp_limb_t B1, mp_limb_t B2, mp_limb_t P,
+                          mp_ptr n, ecm_t ecm_inf)
+{
+    mp_ptr Qx, Qz, Rx, Rz, Qdx, Qdz, a, b;
+    mp_limb_t mmin, mmax, maxj, mdiff, sz;
+    slong i, j, k, num_baby, len, chunk;
+    int ret;
+    mp_ptr arrx, arrz, Q0x2, Q0z2;
+    fmpz * X, * Z, * ys;
+    fmpz_t nn, g, acc;
+    fmpz_mod_ctx_t ctx;
+    fmpz_mod_poly_t F;
+
+    TMP_INIT;
+
+    mmin = (B1 + (P/2)) / P;
+    mmax = ((B2 - P/2) + P - 1)/P;      /* ceil */
+    maxj = (P + 1)/2;
+    mdiff = mmax - mmin + 1;
+    sz = ecm_inf->n_size;
+
+    TMP_START;
+    Qx   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Qz   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Rx   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Rz   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Qdx  = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Qdz  = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Q0x2 = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Q0z2 = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    a    = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    b    = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    arrx = flint_malloc(((maxj >> 1) + 1) * sz * sizeof(mp_limb_t));
+    arrz = flint_malloc(((maxj >> 1) + 1) * sz * sizeof(mp_limb_t));
+
+    mpn_zero(arrx, ((maxj >> 1) + 1) * sz);
+    mpn_zero(arrz, ((maxj >> 1) + 1) * sz);
+
+    /* baby steps: j Q0 for odd j, stored in arr[j/2], as in stage_II */
+    flint_mpn_copyi(arrx, ecm_inf->x, sz);
+    flint_mpn_copyi(arrz, ecm_inf->z, sz);
+
+    fmpz_factor_ecm_double(Q0x2, Q0z2, arrx, arrz, n, ecm_inf);
+    fmpz_factor_ecm_add(arrx + 1 * sz, arrz + 1 * sz,
+                         Q0x2, Q0z2, arrx, arrz, arrx, arrz, n, ecm_inf);
+
+    for (j = 2; j <= (maxj >> 1); j += 1)
+    {
+        fmpz_factor_ecm_add(arrx + j * sz, arrz + j * sz,
+                             arrx + (j - 1) * sz, arrz + (j - 1) * sz,
+                             Q0x2, Q0z2,
+                             arrx + (j - 2) * sz, arrz + (j - 2) * sz,
+                             n, ecm_inf);
+    }
+
+    num_baby = 0;
+    for (j = 1; j <= maxj; j += 2)
+        num_baby += (ecm_inf->GCD_table[j] == 1);
+
+    len = num_baby + mdiff;
+    X = _fmpz_vec_init(len);
+    Z = _fmpz_vec_init(len);
+
+    for (j = 1, k = 0; j <= maxj; j += 2)
+    {
+        if (ecm_inf->GCD_table[j] == 1)
+        {
+            _fmpz_set_mpn_unnorm(X + k, arrx + (j >> 1) * sz, sz, ecm_inf->normbits);
+            _fmpz_set_mpn_unnorm(Z + k, arrz + (j >> 1) * sz, sz, ecm_inf->normbits);
+            k++;
+        }
+    }
+
+    /* giant steps: i Q for mmin <= i <= mmax, where Q = P Q0 */
+    fmpz_factor_ecm_mul_montgomery_ladder(Qx, Qz, ecm_inf->x, ecm_inf->z,
+                                           P, n, ecm_inf);
+    fmpz_factor_ecm_mul_montgomery_ladder(Rx, Rz, Qx, Qz, mmin, n, ecm_inf);
+    fmpz_factor_ecm_mul_montgomery_ladder(Qdx, Qdz, Qx, Qz, mmin - 1, n, ecm_inf);
+
+    for (i = 0; i < mdiff; i++)
+    {
+        _fmpz_set_mpn_unnorm(X + num_baby + i, Rx, sz, ecm_inf->normbits);
+        _fmpz_set_mpn_unnorm(Z + num_baby + i, Rz, sz, ecm_inf->normbits);
+
+        flint_mpn_copyi(a, Rx, sz);
+        flint_mpn_copyi(b, Rz, sz);
+        fmpz_factor_ecm_add(Rx, Rz, Rx, Rz, Qx, Qz, Qdx, Qdz, n, ecm_inf);
+        flint_mpn_copyi(Qdx, a, sz);
+        flint_mpn_copyi(Qdz, b, sz);
+    }
+
+    fmpz_init(nn);
+    fmpz_init(g);
+    fmpz_init(acc);
+    _fmpz_set_mpn_unnorm(nn, n, sz, ecm_inf->normbits);
+    fmpz_mod_ctx_init(ctx, nn);
+    fmpz_mod_poly_init(F, ctx);
+
+    ret = 0;
+
+    if (_ecm_normalize(g, X, Z, len, nn, ctx))
+    {
+        ret = _ecm_set_factor(f, g, ecm_inf);
+        goto cleanup;
+    }
+
+    /* F(X) = prod (X - x_j), evaluated at the giant steps in blocks of
+       deg(F) points */
+    fmpz_mod_poly_product_roots_fmpz_vec(F, X, num_baby, ctx);
+
+    chunk = FLINT_MAX(num_baby, 1);
+    ys = _fmpz_vec_init(chunk);
+    fmpz_one(acc);
+
+    for (i = 0; i < mdiff; i += chunk)
+    {
+        slong m = FLINT_MIN(chunk, mdiff - i);
+
+        if (ecm_inf->stop != NULL && *ecm_inf->stop)
+        {
+            fmpz_zero(acc);
+            break;
+        }
+
+        fmpz_mod_poly_evaluate_fmpz_vec(ys, F, X + num_baby + i, m, ctx);
+
+        for (k = 0; k < m; k++)
+            fmpz_mod_mul(acc, acc, ys + k, ctx);
+    }
+
+    _fmpz_vec_clear(ys, chunk);
+
+    /* as in stage_II, a zero product gives nothing */
+    if (!fmpz_is_zero(acc) && _ecm_proper_gcd(g, acc, nn))
+        ret = _ecm_set_factor(f, g, ecm_inf);
+
+cleanup:
+
+    fmpz_mod_poly_clear(F, ctx);
+    fmpz_mod_ctx_clear(ctx);
+    fmpz_clear(nn);
+    fmpz_clear(g);
+    fmpz_clear(acc);
+    _fmpz_vec_clear(X, len);
+    _fmpz_vec_clear(Z, len);
+
+    TMP_END;
+
+    flint_free(arrx);
+    flint_free(arrz);
+
+    return ret;
+}
@@ -65,6 +65,52 @@ TEST_FUNCTION_START(fmpz_factor_ecm, state)
         flint_abort();
     }
 
+    /* several threads, FFT stage II */
+    fails = 0;
+
+    for (i = 35; i <= 50; i += 5)
+    {
+        for (j = 0; j < flint_test_multiplier(); j++)
+        {
+            flint_set_num_threads(n_randint(state, 4) + 1);
+
+            fmpz_set_ui(prime1, n_randprime(state, i, 1));
+            fmpz_set_ui(prime2, n_randprime(state, i, 1));
+
+            fmpz_mul(primeprod, prime1, prime2);
+
+            k = fmpz_factor_ecm(fac, i << 2, 500,
+                                FMPZ_FACTOR_ECM_FFT_B2_CUTOFF, state, primeprod);
+
+            if (k == 0)
+                fails += 1;
+            else
+            {
+                fmpz_mod(modval, primeprod, fac);
+                if (fmpz_is_one(fac) || !fmpz_is_zero(modval) ||
+                                            fmpz_equal(fac, primeprod))
+                {
+                    printf("FAIL : Wrong factor calculated (FFT stage II)\n");
+                    printf("n : ");
+                    fmpz_print(primeprod);
+                    printf(" factor calculated : ");
+                    fmpz_print(fac);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+    }
+
+    if (fails > flint_test_multiplier())
+    {
+        printf("FAIL : ECM failed too many times (%d times, FFT stage II)\n", fails);
+        fflush(stdout);
+        flint_abort();
+    }
+
+    flint_set_num_threads(1);
+
     /* Tests for hangs and crashes, don't care about result */
 
 #if FLINT64
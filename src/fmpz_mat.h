@@ -103,6 +103,9 @@ int fmpz_mat_fprint(FILE * file, const fmpz_mat_t mat);
 int fmpz_mat_fprint_pretty(FILE * file, const fmpz_mat_t mat);
 
 int fmpz_mat_fread(FILE* file, fmpz_mat_t mat);
+
+int fmpz_mat_fwrite_bin(FILE * file, const fmpz_mat_t mat);
+int fmpz_mat_fread_bin(FILE * file, fmpz_mat_t mat);
 #endif
 
 int fmpz_mat_print(const fmpz_mat_t mat);
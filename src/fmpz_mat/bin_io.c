@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "bin_io.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+
+int
+fmpz_mat_fwrite_bin(FILE * file, const fmpz_mat_t mat)
+{
+    mp_limb_t w[2];
+    slong i, j;
+
+    w[0] = mat->r;
+    w[1] = mat->c;
+
+    if (!flint_bin_fwrite_header(file, FLINT_BIN_FMPZ_MAT) ||
+        !flint_bin_fwrite_limbs(file, w, 2))
+        return 0;
+
+    for (i = 0; i < mat->r; i++)
+        for (j = 0; j < mat->c; j++)
+            if (!_fmpz_fwrite_bin(file, fmpz_mat_entry(mat, i, j)))
+                return 0;
+
+    return 1;
+}
+
+int
+fmpz_mat_fread_bin(FILE * file, fmpz_mat_t mat)
+{
+    mp_limb_t w[2], hi, lo;
+    slong i, j, r, c;
+    int swap;
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_FMPZ_MAT, &swap) ||
+        !flint_bin_fread_limbs(file, w, 2, swap))
+        return 0;
+
+    r = w[0];
+    c = w[1];
+    umul_ppmm(hi, lo, w[0], w[1]);
+    if (r < 0 || c < 0 || hi != 0 || lo > WORD_MAX ||
+        (c == 0 && r > FLINT_BIN_READ_CHUNK))
+        return 0;
+
+    /* r and c come from the stream: a large matrix is read into a growing
+       vector first and only allocated once all its entries are present */
+    if ((mat->r != r || mat->c != c) && r * c > FLINT_BIN_READ_CHUNK)
+    {
+        fmpz * v;
+        slong alloc = FLINT_BIN_READ_CHUNK;
+
+        v = _fmpz_vec_init(alloc);
+
+        for (i = 0; i < r * c; i++)
+        {
+            if (i == alloc)
+            {
+                slong new_alloc = FLINT_MIN(r * c, 2 * alloc);
+
+                v = flint_realloc(v, new_alloc * sizeof(fmpz));
+                _fmpz_vec_zero(v + alloc, new_alloc - alloc);
+                alloc = new_alloc;
+            }
+
+            if (!_fmpz_fread_bin(file, v + i, swap))
+            {
+                _fmpz_vec_clear(v, alloc);
+                fmpz_mat_zero(mat);
+                return 0;
+            }
+        }
+
+        fmpz_mat_clear(mat);
+        fmpz_mat_init(mat, r, c);
+
+        for (i = 0; i < r; i++)
+            for (j = 0; j < c; j++)
+                fmpz_swap(fmpz_mat_entry(mat, i, j), v + i * c + j);
+
+        _fmpz_vec_clear(v, r * c);
+
+        return 1;
+    }
+
+    if (mat->r != r || mat->c != c)
+    {
+        fmpz_mat_clear(mat);
+        fmpz_mat_init(mat, r, c);
+    }
+
+    for (i = 0; i < r; i++)
+    {
+        for (j = 0; j < c; j++)
+        {
+            if (!_fmpz_fread_bin(file, fmpz_mat_entry(mat, i, j), swap))
+            {
+                fmpz_mat_zero(mat);
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
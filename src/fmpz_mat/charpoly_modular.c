@@ -12,9 +12,11 @@
 #include <math.h>
 
 #include "ulong_extras.h"
+#include "thread_support.h"
 #include "nmod_mat.h"
 #include "nmod_poly.h"
 #include "fmpz.h"
+#include "fmpz_vec.h"
 #include "fmpz_poly.h"
 #include "fmpz_mat.h"
 
@@ -88,6 +90,48 @@ void _fmpz_mat_charpoly_small(fmpz * rop, const fmpz_mat_t op)
     }
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * op;
+    mp_srcptr primes;
+    slong num_primes;
+    fmpz * residues;    /* coefficient j mod primes[i] is residues[j * num_primes + i] */
+    fmpz * rop;
+    const fmpz_multi_CRT_struct * CRT;
+}
+_charpoly_worker_arg_struct;
+
+static void
+_charpoly_mod_worker(slong i, void * varg)
+{
+    _charpoly_worker_arg_struct * arg = (_charpoly_worker_arg_struct *) varg;
+    slong j, n = arg->op->r;
+    nmod_mat_t mat;
+    nmod_poly_t poly;
+
+    nmod_mat_init(mat, n, n, arg->primes[i]);
+    nmod_poly_init(poly, arg->primes[i]);
+
+    fmpz_mat_get_nmod_mat(mat, arg->op);
+    nmod_mat_charpoly(poly, mat);
+
+    for (j = 0; j <= n; j++)
+        fmpz_set_ui(arg->residues + j * arg->num_primes + i,
+                                                 nmod_poly_get_coeff_ui(poly, j));
+
+    nmod_mat_clear(mat);
+    nmod_poly_clear(poly);
+}
+
+static void
+_charpoly_crt_worker(slong j, void * varg)
+{
+    _charpoly_worker_arg_struct * arg = (_charpoly_worker_arg_struct *) varg;
+
+    fmpz_multi_CRT_precomp(arg->rop + j, arg->CRT,
+                                    arg->residues + j * arg->num_primes, 1);
+}
+
 void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
 {
     const slong n = op->r;
@@ -112,8 +156,6 @@ void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
         slong pbits  = FLINT_BITS - 1;
         mp_limb_t p = (UWORD(1) << pbits);
 
-        fmpz_t m;
-
         /* Determine the bound in bits */
         {
             slong i, j;
@@ -140,30 +182,52 @@ void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
             bound = ceil( (n / 2.0) * (_log2(n) + 2.0 * t + 1.6669) );
         }
 
-        fmpz_init_set_ui(m, 1);
-
-        for ( ; fmpz_bits(m) < bound; )
+        /*
+            Primes exceed 2^pbits, so num_primes primes give a product of
+            more than num_primes * pbits bits. The charpoly is computed
+            modulo all primes in parallel and the coefficients are
+            reconstructed, also in parallel, using a CRT tree.
+        */
         {
-            nmod_mat_t mat;
-            nmod_poly_t poly;
+            slong i, num_primes;
+            mp_ptr primes;
+            fmpz * moduli;
+            fmpz_multi_CRT_t CRT;
+            _charpoly_worker_arg_struct arg;
 
-            p = n_nextprime(p, 0);
+            num_primes = FLINT_MAX(1, (bound - 1 + pbits - 1) / pbits);
 
-            nmod_mat_init(mat, n, n, p);
-            nmod_poly_init(poly, p);
+            primes = flint_malloc(num_primes * sizeof(mp_limb_t));
+            moduli = _fmpz_vec_init(num_primes);
 
-            fmpz_mat_get_nmod_mat(mat, op);
-            nmod_mat_charpoly(poly, mat);
+            for (i = 0; i < num_primes; i++)
+            {
+                p = n_nextprime(p, 0);
+                primes[i] = p;
+                fmpz_set_ui(moduli + i, p);
+            }
 
-            _fmpz_poly_CRT_ui(rop, rop, n + 1, m, poly->coeffs, n + 1, poly->mod.n, poly->mod.ninv, 1);
+            arg.op = op;
+            arg.primes = primes;
+            arg.num_primes = num_primes;
+            arg.residues = _fmpz_vec_init((n + 1) * num_primes);
+            arg.rop = rop;
+            arg.CRT = CRT;
 
-            fmpz_mul_ui(m, m, p);
+            flint_parallel_do(_charpoly_mod_worker, &arg, num_primes, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
 
-            nmod_mat_clear(mat);
-            nmod_poly_clear(poly);
-        }
+            fmpz_multi_CRT_init(CRT);
+            fmpz_multi_CRT_precompute(CRT, moduli, num_primes);
 
-        fmpz_clear(m);
+            flint_parallel_do(_charpoly_crt_worker, &arg, n + 1, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
+
+            fmpz_multi_CRT_clear(CRT);
+            _fmpz_vec_clear(arg.residues, (n + 1) * num_primes);
+            _fmpz_vec_clear(moduli, num_primes);
+            flint_free(primes);
+        }
     }
 }
 
@@ -10,8 +10,10 @@
 */
 
 #include "ulong_extras.h"
+#include "thread_support.h"
 #include "nmod_mat.h"
 #include "fmpz.h"
+#include "fmpz_vec.h"
 #include "fmpz_mat.h"
 
 /* Enable to exercise corner cases */
@@ -32,14 +34,49 @@ next_good_prime(const fmpz_t d, mp_limb_t p)
     return p;
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    const fmpz * d;
+    const fmpz * primes;
+    fmpz * residues;
+}
+_det_worker_arg_struct;
+
+/* residues[i] = det(A) / d mod primes[i] */
+static void
+_det_worker(slong i, void * varg)
+{
+    _det_worker_arg_struct * arg = (_det_worker_arg_struct *) varg;
+    mp_limb_t p, xmod;
+    nmod_mat_t Amod;
+
+    p = fmpz_get_ui(arg->primes + i);
+
+    nmod_mat_init(Amod, arg->A->r, arg->A->c, p);
+    fmpz_mat_get_nmod_mat(Amod, arg->A);
+
+    xmod = _nmod_mat_det(Amod);
+    xmod = n_mulmod2_preinv(xmod,
+        n_invmod(fmpz_fdiv_ui(arg->d, p), p), Amod->mod.n, Amod->mod.ninv);
+
+    fmpz_set_ui(arg->residues + i, xmod);
+
+    nmod_mat_clear(Amod);
+}
 
 void
 fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     const fmpz_t d, int proved)
 {
-    fmpz_t bound, prod, stable_prod, x, xnew;
-    mp_limb_t p, xmod;
-    nmod_mat_t Amod;
+    fmpz_t bound, prod, stable_prod, x, xnew, bprod, bx;
+    fmpz * primes, * residues;
+    mp_ptr plist;
+    fmpz_multi_CRT_t CRT;
+    _det_worker_arg_struct arg;
+    mp_limb_t p;
+    slong i, len, alloc, num_threads;
+    int stable;
     slong n = A->r;
 
     if (n == 0)
@@ -59,15 +96,21 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     fmpz_init(stable_prod);
     fmpz_init(x);
     fmpz_init(xnew);
+    fmpz_init(bprod);
+    fmpz_init(bx);
 
     /* Bound x = det(A) / d */
     fmpz_mat_det_bound(bound, A);
     fmpz_mul_ui(bound, bound, UWORD(2));  /* accommodate sign */
     fmpz_cdiv_q(bound, bound, d);
 
-    nmod_mat_init(Amod, n, n, 2);
     fmpz_zero(x);
     fmpz_one(prod);
+    fmpz_one(stable_prod);
+
+    num_threads = flint_get_num_threads();
+    alloc = 0;
+    plist = NULL;
 
 #if DEBUG_USE_SMALL_PRIMES
     p = UWORD(1);
@@ -75,42 +118,106 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
 #endif
 
-    /* Compute x = det(A) / d */
+    /*
+        Compute x = det(A) / d. The primes are processed in batches: the
+        determinants modulo the primes in a batch are computed in parallel
+        and combined using a CRT tree, and the result is then combined with
+        the previous batches. In the proved case, the first batch contains
+        enough primes to reach the bound. Otherwise, a batch contains one
+        prime per thread, so that we can stop early if x stabilises.
+    */
     while (fmpz_cmp(prod, bound) <= 0)
     {
-        p = next_good_prime(d, p);
-        nmod_mat_set_mod(Amod, p);
-        fmpz_mat_get_nmod_mat(Amod, A);
+        if (proved)
+        {
+            slong need = fmpz_bits(bound) - fmpz_bits(prod) + 1;
+
+            for (len = 0; need > 0; len++)
+            {
+                if (len >= alloc)
+                {
+                    alloc = FLINT_MAX(2 * alloc, len + 1);
+                    plist = flint_realloc(plist, alloc * sizeof(mp_limb_t));
+                }
+
+                p = next_good_prime(d, p);
+                plist[len] = p;
+                need -= FLINT_BIT_COUNT(p) - 1;
+            }
+        }
+        else
+        {
+            len = num_threads;
+
+            if (len > alloc)
+            {
+                alloc = len;
+                plist = flint_realloc(plist, alloc * sizeof(mp_limb_t));
+            }
+
+            for (i = 0; i < len; i++)
+            {
+                p = next_good_prime(d, p);
+                plist[i] = p;
+            }
+        }
+
+        primes = _fmpz_vec_init(len);
+        residues = _fmpz_vec_init(len);
 
-        /* Compute x = det(A) / d mod p */
-        xmod = _nmod_mat_det(Amod);
-        xmod = n_mulmod2_preinv(xmod,
-            n_invmod(fmpz_fdiv_ui(d, p), p), Amod->mod.n, Amod->mod.ninv);
+        for (i = 0; i < len; i++)
+            fmpz_set_ui(primes + i, plist[i]);
 
-        fmpz_CRT_ui(xnew, x, prod, xmod, p, 1);
+        arg.A = A;
+        arg.d = d;
+        arg.primes = primes;
+        arg.residues = residues;
 
-        if (fmpz_equal(xnew, x))
+        flint_parallel_do(_det_worker, &arg, len, 0, FLINT_PARALLEL_UNIFORM);
+
+        if (len == 1)
         {
-            fmpz_mul_ui(stable_prod, stable_prod, p);
-            if (!proved && fmpz_bits(stable_prod) > 100)
-                break;
+            fmpz_set(bx, residues + 0);
+            fmpz_set(bprod, primes + 0);
         }
         else
         {
-            fmpz_set_ui(stable_prod, p);
+            fmpz_multi_CRT_init(CRT);
+            fmpz_multi_CRT_precompute(CRT, primes, len);
+            fmpz_multi_CRT_precomp(bx, CRT, residues, 0);
+            fmpz_multi_CRT_clear(CRT);
+
+            _fmpz_vec_prod(bprod, primes, len);
         }
 
-        fmpz_mul_ui(prod, prod, p);
+        fmpz_CRT(xnew, x, prod, bx, bprod, 1);
+
+        stable = fmpz_equal(xnew, x);
+
+        if (stable)
+            fmpz_mul(stable_prod, stable_prod, bprod);
+        else
+            fmpz_set(stable_prod, bprod);
+
+        fmpz_mul(prod, prod, bprod);
         fmpz_set(x, xnew);
+
+        _fmpz_vec_clear(primes, len);
+        _fmpz_vec_clear(residues, len);
+
+        if (stable && !proved && fmpz_bits(stable_prod) > 100)
+            break;
     }
 
     /* det(A) = x * d */
     fmpz_mul(det, x, d);
 
-    nmod_mat_clear(Amod);
+    flint_free(plist);
     fmpz_clear(bound);
     fmpz_clear(prod);
     fmpz_clear(stable_prod);
     fmpz_clear(x);
     fmpz_clear(xnew);
+    fmpz_clear(bprod);
+    fmpz_clear(bx);
 }
@@ -13,6 +13,7 @@
 #include <math.h>
 
 #include "ulong_extras.h"
+#include "thread_support.h"
 #include "nmod_mat.h"
 #include "nmod_poly.h"
 #include "fmpz.h"
@@ -109,6 +110,34 @@ void _fmpz_mat_bound_ovals_of_cassini(fmpz_t b, const fmpz_mat_t op)
    fmpz_clear(q);
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * op;
+    mp_srcptr primes;
+    nmod_poly_struct * polys;
+    ulong * gens;
+}
+_minpoly_worker_arg_struct;
+
+static void
+_minpoly_worker(slong i, void * varg)
+{
+    _minpoly_worker_arg_struct * arg = (_minpoly_worker_arg_struct *) varg;
+    slong j, n = arg->op->r;
+    ulong * P = arg->gens + i * n;
+    nmod_mat_t mat;
+
+    nmod_mat_init(mat, n, n, arg->primes[i]);
+
+    for (j = 0; j < n; j++)
+       P[j] = 0;
+
+    fmpz_mat_get_nmod_mat(mat, arg->op);
+    nmod_mat_minpoly_with_gens(arg->polys + i, mat, P);
+
+    nmod_mat_clear(mat);
+}
+
 slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
 {
     const slong n = op->r;
@@ -133,13 +162,17 @@ slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
         slong bound;
         double b1, b2, b3, bb;
 
-        slong pbits  = FLINT_BITS - 1, i, j;
+        slong pbits  = FLINT_BITS - 1, i, j, num_threads;
         mp_limb_t p = (UWORD(1) << pbits);
+        mp_ptr primes;
+        nmod_poly_struct * polys;
         ulong * P, * Q;
+        slong * good;
+        _minpoly_worker_arg_struct arg;
 
         fmpz_mat_t v1, v2, v3;
-        fmpz * rold;
-        fmpz_t m;
+        fmpz * rold, * moduli, * values;
+        fmpz_t m, M, c;
 
         if (fmpz_mat_is_zero(op))
         {
@@ -171,65 +204,124 @@ slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
             fmpz_clear(b);
         }
 
-        P = (ulong *) flint_calloc(n, sizeof(ulong));
+        /*
+            The primes are processed in batches of one prime per thread.
+            The minimal polynomials modulo the primes in a batch are computed
+            in parallel. The primes giving the largest degree so far are
+            combined using a CRT tree, and the result is merged with the
+            previous batches before checking for stabilisation.
+        */
+        num_threads = flint_get_num_threads();
+
+        primes = (mp_ptr) flint_malloc(num_threads * sizeof(mp_limb_t));
+        polys = (nmod_poly_struct *) flint_malloc(
+                                      num_threads * sizeof(nmod_poly_struct));
+        P = (ulong *) flint_calloc(num_threads * n, sizeof(ulong));
         Q = (ulong *) flint_calloc(n, sizeof(ulong));
+        good = (slong *) flint_malloc(num_threads * sizeof(slong));
+        moduli = _fmpz_vec_init(num_threads);
+        values = _fmpz_vec_init(num_threads);
         rold = (fmpz *) _fmpz_vec_init(n + 1);
         fmpz_mat_init(v1, n, 1);
         fmpz_mat_init(v2, n, 1);
         fmpz_mat_init(v3, n, 1);
 
         fmpz_init_set_ui(m, 1);
+        fmpz_init(M);
+        fmpz_init(c);
 
         oldlen = 0;
         len = 0;
 
+        _fmpz_vec_zero(rop, n + 1);
+
+        arg.op = op;
+        arg.primes = primes;
+        arg.polys = polys;
+        arg.gens = P;
+
         for ( ; fmpz_bits(m) <= bound; )
         {
-            nmod_mat_t mat;
-            nmod_poly_t poly;
+            slong k, num_good;
+
+            for (k = 0; k < num_threads; k++)
+            {
+                p = n_nextprime(p, 0);
+                primes[k] = p;
+                nmod_poly_init(polys + k, p);
+            }
 
-            p = n_nextprime(p, 0);
+            flint_parallel_do(_minpoly_worker, &arg, num_threads, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
 
-            nmod_mat_init(mat, n, n, p);
-            nmod_poly_init(poly, p);
+            num_good = 0;
 
-            for (i = 0; i < n; i++)
-               P[i] = 0;
+            for (k = 0; k < num_threads; k++)
+            {
+                len = polys[k].length;
 
-            fmpz_mat_get_nmod_mat(mat, op);
-            nmod_mat_minpoly_with_gens(poly, mat, P);
+                if (oldlen != 0 && len > oldlen)
+                {
+                   /* all previous primes were bad, discard */
 
-            len = poly->length;
+                   fmpz_one(m);
 
-            if (oldlen != 0 && len > oldlen)
-            {
-               /* all previous primes were bad, discard */
+                   for (i = 0; i < n + 1; i++)
+                      fmpz_zero(rop + i);
 
-               fmpz_one(m);
-               oldlen = len;
+                   for (i = 0; i < n; i++)
+                      Q[i] = 0;
 
-               for (i = 0; i < n + 1; i++)
-                  fmpz_zero(rop + i);
+                   num_good = 0;
+                }
+                else if (len < oldlen)
+                {
+                   /* this prime was bad, skip */
+                   continue;
+                }
 
-               for (i = 0; i < n; i++)
-                  Q[i] = 0;
-            } else if (len < oldlen)
-            {
-               /* this prime was bad, skip */
+                oldlen = len;
 
-               nmod_mat_clear(mat);
-               nmod_poly_clear(poly);
+                for (i = 0; i < n; i++)
+                   Q[i] |= P[k * n + i];
 
-               continue;
+                good[num_good] = k;
+                num_good++;
             }
 
-            for (i = 0; i < n; i++)
-               Q[i] |= P[i];
+            len = oldlen;
+
+            if (num_good > 0)
+            {
+                fmpz_multi_CRT_t CRT;
+
+                for (k = 0; k < num_good; k++)
+                    fmpz_set_ui(moduli + k, primes[good[k]]);
+
+                fmpz_multi_CRT_init(CRT);
+                fmpz_multi_CRT_precompute(CRT, moduli, num_good);
+                _fmpz_vec_prod(M, moduli, num_good);
 
-            _fmpz_poly_CRT_ui(rop, rop, n + 1, m, poly->coeffs,
-                              poly->length, poly->mod.n, poly->mod.ninv, 1);
+                for (j = 0; j < len; j++)
+                {
+                    for (k = 0; k < num_good; k++)
+                        fmpz_set_ui(values + k,
+                                   nmod_poly_get_coeff_ui(polys + good[k], j));
 
-            fmpz_mul_ui(m, m, p);
+                    fmpz_multi_CRT_precomp(c, CRT, values, 0);
+                    fmpz_CRT(rop + j, rop + j, m, c, M, 1);
+                }
+
+                fmpz_multi_CRT_clear(CRT);
+
+                fmpz_mul(m, m, M);
+            }
+
+            for (k = 0; k < num_threads; k++)
+                nmod_poly_clear(polys + k);
+
+            if (num_good == 0)
+                continue;
 
             /* check if stabilised */
             for (i = 0; i < len; i++)
@@ -278,24 +370,24 @@ slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
 
                /* if f(A)v = 0 for all generators v, we are done */
                if (i == n)
-               {
-                  nmod_mat_clear(mat);
-                  nmod_poly_clear(poly);
                   break;
-               }
             }
-
-            nmod_mat_clear(mat);
-            nmod_poly_clear(poly);
         }
 
+        flint_free(primes);
+        flint_free(polys);
         flint_free(P);
         flint_free(Q);
+        flint_free(good);
+        _fmpz_vec_clear(moduli, num_threads);
+        _fmpz_vec_clear(values, num_threads);
         fmpz_mat_clear(v2);
         fmpz_mat_clear(v1);
         fmpz_mat_clear(v3);
         fmpz_clear(m);
-        _fmpz_vec_clear(rold, n);
+        fmpz_clear(M);
+        fmpz_clear(c);
+        _fmpz_vec_clear(rold, n + 1);
     }
 
     return len;
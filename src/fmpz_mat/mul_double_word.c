@@ -23,7 +23,7 @@
 #define FMPZ_MAT_MUL_4_BRANCHLESS_CUTOFF 16
 
 /* 2x2 -> 4 signed addmul */
-static void _do_row_22_4_signed_branchy(
+FLINT_FORCE_INLINE void _do_row_22_4_signed_branchy(
     fmpz * CR,
     const mp_limb_t * AR,
     const mp_limb_t * B,
@@ -80,7 +80,7 @@ static void _do_row_22_4_signed_branchy(
 }
 
 /* 2x2 -> 4 signed addmul */
-static void _do_row_22_4_signed(
+FLINT_FORCE_INLINE void _do_row_22_4_signed(
     fmpz * CR,
     const mp_limb_t * AR,
     const mp_limb_t * B,
@@ -137,7 +137,7 @@ static void _do_row_22_4_signed(
 
 
 /* 2x2 -> 5 signed addmul */
-static void _do_row_22_5_signed(
+FLINT_FORCE_INLINE void _do_row_22_5_signed(
     fmpz * CR,
     const mp_limb_t * AR,
     const mp_limb_t * B,
@@ -196,7 +196,7 @@ static void _do_row_22_5_signed(
 }
 
 /* 2x2 -> 4 unsigned addmul */
-static void _do_row_22_4_unsigned(
+FLINT_FORCE_INLINE void _do_row_22_4_unsigned(
     fmpz * CR,
     const mp_limb_t * AR,
     const mp_limb_t * B,
@@ -248,7 +248,7 @@ static void _do_row_22_4_unsigned(
 }
 
 /* 2x2 -> 5 unsigned addmul */
-static void _do_row_22_5_unsigned(
+FLINT_FORCE_INLINE void _do_row_22_5_unsigned(
     fmpz * CR,
     const mp_limb_t * AR,
     const mp_limb_t * B,
@@ -347,9 +347,8 @@ static void _red_worker(void * varg)
     }
 }
 
-static void _mul_worker(void * varg)
+FLINT_FORCE_INLINE void _mul_worker_inline(_worker_arg * arg)
 {
-    _worker_arg * arg = (_worker_arg *) varg;
     slong Astartrow = arg->Astartrow;
     slong Astoprow = arg->Astoprow;
     slong ac = arg->br;
@@ -403,6 +402,35 @@ static void _mul_worker(void * varg)
     TMP_END;
 }
 
+#if FLINT_HAVE_CPU_DISPATCH
+
+static FLINT_TARGET_AVX2 void _mul_worker_avx2(_worker_arg * arg)
+{
+    _mul_worker_inline(arg);
+}
+
+static FLINT_TARGET_AVX512 void _mul_worker_avx512(_worker_arg * arg)
+{
+    _mul_worker_inline(arg);
+}
+
+#endif
+
+static void _mul_worker(void * varg)
+{
+    _worker_arg * arg = (_worker_arg *) varg;
+#if FLINT_HAVE_CPU_DISPATCH
+    ulong cpu = flint_get_cpu_features();
+
+    if (cpu & FLINT_CPU_AVX512)
+        _mul_worker_avx512(arg);
+    else if (cpu & FLINT_CPU_AVX2)
+        _mul_worker_avx2(arg);
+    else
+#endif
+        _mul_worker_inline(arg);
+}
+
 
 /*
     sign = 1:   max|A|, max|B| < 2^(2*FLINT_BITS - 1)
@@ -426,7 +454,7 @@ void _fmpz_mat_mul_double_word_internal(
     slong br = fmpz_mat_nrows(B);
     slong bc = fmpz_mat_ncols(B);
     _worker_arg mainarg;
-    thread_pool_handle * handles;
+    flint_task_struct * tasks;
     slong num_workers;
     _worker_arg * args;
     slong limit;
@@ -469,14 +497,17 @@ use_one_thread:
         return;
     }
 
-    num_workers = flint_request_threads(&handles, limit);
+    /* inside a task this shares the threads of the enclosing region */
+    num_workers = flint_task_begin(limit);
+    num_workers = FLINT_MIN(num_workers, limit) - 1;
     if (num_workers < 1)
     {
-        flint_give_back_threads(handles, num_workers);
+        flint_task_end();
         goto use_one_thread;
     }
 
     args = FLINT_ARRAY_ALLOC(num_workers, _worker_arg);
+    tasks = FLINT_ARRAY_ALLOC(num_workers, flint_task_struct);
 
     for (i = 0; i < num_workers; i++)
     {
@@ -501,18 +532,25 @@ use_one_thread:
     mainarg.Bstopcol = (i + 1)*bc/(num_workers + 1);
 
     for (i = 0; i < num_workers; i++)
-        thread_pool_wake(global_thread_pool, handles[i], 0, _red_worker, &args[i]);
+    {
+        flint_task_init(tasks + i, _red_worker, &args[i]);
+        flint_task_spawn(tasks + i);
+    }
     _red_worker(&mainarg);
-    for (i = 0; i < num_workers; i++)
-        thread_pool_wait(global_thread_pool, handles[i]);
+    for (i = num_workers - 1; i >= 0; i--)
+        flint_task_join(tasks + i);
 
     for (i = 0; i < num_workers; i++)
-        thread_pool_wake(global_thread_pool, handles[i], 0, _mul_worker, &args[i]);
+    {
+        flint_task_init(tasks + i, _mul_worker, &args[i]);
+        flint_task_spawn(tasks + i);
+    }
     _mul_worker(&mainarg);
-    for (i = 0; i < num_workers; i++)
-        thread_pool_wait(global_thread_pool, handles[i]);
+    for (i = num_workers - 1; i >= 0; i--)
+        flint_task_join(tasks + i);
 
-    flint_give_back_threads(handles, num_workers);
+    flint_task_end();
+    flint_free(tasks);
     flint_free(args);
 
     TMP_END;
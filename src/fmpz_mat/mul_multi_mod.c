@@ -298,7 +298,7 @@ void _fmpz_mat_mul_multi_mod(
     _worker_arg * args;
     fmpz_comb_t comb;
     slong num_workers;
-    thread_pool_handle * handles;
+    flint_task_struct * tasks;
     slong limit;
     ulong first_prime; /* not prime */
 
@@ -383,14 +383,17 @@ mod_single:
     }
     else
     {
-        num_workers = flint_request_threads(&handles, limit);
+        /* inside a task this shares the threads of the enclosing region */
+        num_workers = flint_task_begin(limit);
+        num_workers = FLINT_MIN(num_workers, limit) - 1;
         if (num_workers < 1)
         {
-            flint_give_back_threads(handles, num_workers);
+            flint_task_end();
             goto mod_single;
         }
 
         args = FLINT_ARRAY_ALLOC(num_workers, _worker_arg);
+        tasks = FLINT_ARRAY_ALLOC(num_workers, flint_task_struct);
         for (start = 0, i = 0; i < num_workers; start = stop, i++)
         {
             args[i] = mainarg;
@@ -405,12 +408,16 @@ mod_single:
                                      &mainarg.Bstartrow, &mainarg.Bstoprow, k);
 
         for (i = 0; i < num_workers; i++)
-            thread_pool_wake(global_thread_pool, handles[i], 0, _mod_worker, &args[i]);
+        {
+            flint_task_init(tasks + i, _mod_worker, &args[i]);
+            flint_task_spawn(tasks + i);
+        }
         _mod_worker(&mainarg);
-        for (i = 0; i < num_workers; i++)
-            thread_pool_wait(global_thread_pool, handles[i]);
+        for (i = num_workers - 1; i >= 0; i--)
+            flint_task_join(tasks + i);
 
-        flint_give_back_threads(handles, num_workers);
+        flint_task_end();
+        flint_free(tasks);
         flint_free(args);
     }
 
@@ -433,14 +440,17 @@ crt_single:
     }
     else
     {
-        num_workers = flint_request_threads(&handles, limit);
+        /* inside a task this shares the threads of the enclosing region */
+        num_workers = flint_task_begin(limit);
+        num_workers = FLINT_MIN(num_workers, limit) - 1;
         if (num_workers < 1)
         {
-            flint_give_back_threads(handles, num_workers);
+            flint_task_end();
             goto crt_single;
         }
 
         args = FLINT_ARRAY_ALLOC(num_workers, _worker_arg);
+        tasks = FLINT_ARRAY_ALLOC(num_workers, flint_task_struct);
         for (start = 0, i = 0; i < num_workers; start = stop, i++)
         {
             args[i] = mainarg;
@@ -453,12 +463,16 @@ crt_single:
         mainarg.Cstoprow = m;
 
         for (i = 0; i < num_workers; i++)
-            thread_pool_wake(global_thread_pool, handles[i], 0, _crt_worker, &args[i]);
+        {
+            flint_task_init(tasks + i, _crt_worker, &args[i]);
+            flint_task_spawn(tasks + i);
+        }
         _crt_worker(&mainarg);
-        for (i = 0; i < num_workers; i++)
-            thread_pool_wait(global_thread_pool, handles[i]);
+        for (i = num_workers - 1; i >= 0; i--)
+            flint_task_join(tasks + i);
 
-        flint_give_back_threads(handles, num_workers);
+        flint_task_end();
+        flint_free(tasks);
         flint_free(args);
     }
 
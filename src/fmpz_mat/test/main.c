@@ -39,6 +39,7 @@
 #include "t-entry.c"
 #include "t-equal.c"
 #include "t-fmpz_vec_mul.c"
+#include "t-fwrite_fread_bin.c"
 #include "t-get_d_mat.c"
 #include "t-get_d_mat_transpose.c"
 #include "t-get_nmod_mat.c"
@@ -138,6 +139,7 @@ test_struct tests[] =
     TEST_FUNCTION(fmpz_mat_entry),
     TEST_FUNCTION(fmpz_mat_equal),
     TEST_FUNCTION(fmpz_mat_fmpz_vec_mul),
+    TEST_FUNCTION(fmpz_mat_fwrite_fread_bin),
     TEST_FUNCTION(fmpz_mat_get_d_mat),
     TEST_FUNCTION(fmpz_mat_get_d_mat_transpose),
     TEST_FUNCTION(fmpz_mat_get_nmod_mat),
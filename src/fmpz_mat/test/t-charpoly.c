@@ -107,5 +107,39 @@ TEST_FUNCTION_START(fmpz_mat_charpoly, state)
         fmpz_poly_clear(g);
     }
 
+    /* larger matrices go through the multimodular algorithm */
+    for (rep = 0; rep < 100 * flint_test_multiplier(); rep++)
+    {
+        fmpz_mat_t A;
+        fmpz_poly_t f, g;
+
+        m = n_randint(state, 16);
+
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        fmpz_mat_init(A, m, m);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+
+        fmpz_mat_randtest(A, state, 1 + n_randint(state, 100));
+
+        fmpz_mat_charpoly_modular(f, A);
+        fmpz_mat_charpoly_berkowitz(g, A);
+
+        if (!fmpz_poly_equal(f, g))
+        {
+            flint_printf("FAIL: charpoly_modular(A) != charpoly_berkowitz(A).\n");
+            flint_printf("Matrix A:\n"), fmpz_mat_print(A), flint_printf("\n");
+            flint_printf("cp_modular(A) = "), fmpz_poly_print_pretty(f, "X"), flint_printf("\n");
+            flint_printf("cp_berkowitz(A) = "), fmpz_poly_print_pretty(g, "X"), flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+    }
+
     TEST_FUNCTION_END(state);
 }
@@ -26,6 +26,8 @@ TEST_FUNCTION_START(fmpz_mat_det_modular, state)
         int proved = n_randlimb(state) % 2;
         m = n_randint(state, 10);
 
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
         fmpz_mat_init(A, m, m);
 
         fmpz_init(det1);
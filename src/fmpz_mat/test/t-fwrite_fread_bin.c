@@ -0,0 +1,134 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "test_helpers.h"
+#include "bin_io.h"
+#include "fmpz_mat.h"
+
+TEST_FUNCTION_START(fmpz_mat_fwrite_fread_bin, state)
+{
+    slong iter;
+
+/* assume tmpfile() is broken on windows */
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, B;
+        FILE * tmp;
+        char * buf;
+        long size;
+
+        fmpz_mat_init(A, n_randint(state, 20), n_randint(state, 20));
+        fmpz_mat_init(B, n_randint(state, 20), n_randint(state, 20));
+        fmpz_mat_randtest(A, state, 1 + n_randint(state, 300));
+
+        tmp = tmpfile();
+        if (tmp == NULL)
+        {
+            flint_printf("FAIL (creating temporary file)\n");
+            flint_abort();
+        }
+
+        if (!fmpz_mat_fwrite_bin(tmp, A))
+        {
+            flint_printf("FAIL (write)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+
+        if (!fmpz_mat_fread_bin(tmp, B) || !fmpz_mat_equal(A, B))
+        {
+            flint_printf("FAIL (roundtrip)\n");
+            fmpz_mat_print_pretty(A);
+            fmpz_mat_print_pretty(B);
+            flint_abort();
+        }
+
+        /* the same file written on a machine of the opposite endianness */
+        size = ftell(tmp);
+        buf = flint_malloc(size);
+        rewind(tmp);
+        if (fread(buf, 1, size, tmp) != (size_t) size)
+        {
+            flint_printf("FAIL (reading back)\n");
+            flint_abort();
+        }
+
+        buf[6] = (buf[6] == 'L') ? 'B' : 'L';
+        flint_bin_swap_limbs((mp_ptr) (buf + FLINT_BIN_HEADER_SIZE),
+            (size - FLINT_BIN_HEADER_SIZE) / sizeof(mp_limb_t));
+
+        rewind(tmp);
+        fwrite(buf, 1, size, tmp);
+        rewind(tmp);
+        fmpz_mat_zero(B);
+
+        if (!fmpz_mat_fread_bin(tmp, B) || !fmpz_mat_equal(A, B))
+        {
+            flint_printf("FAIL (byte swapped)\n");
+            flint_abort();
+        }
+
+        /* truncated */
+        if (size > FLINT_BIN_HEADER_SIZE + 2 * sizeof(mp_limb_t))
+        {
+            fclose(tmp);
+            tmp = tmpfile();
+            fwrite(buf, 1, size - 1, tmp);
+            rewind(tmp);
+
+            if (fmpz_mat_fread_bin(tmp, B))
+            {
+                flint_printf("FAIL (truncated)\n");
+                flint_abort();
+            }
+        }
+
+        fclose(tmp);
+        flint_free(buf);
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+    }
+
+    /* sizes in a corrupt header must not be trusted */
+    {
+        mp_limb_t w[3] = { UWORD(1) << 31, UWORD(1) << 31, 0 };
+        FILE * tmp = tmpfile();
+        fmpz_mat_t B;
+
+        if (tmp == NULL || !flint_bin_fwrite_header(tmp, FLINT_BIN_FMPZ_MAT) ||
+            !flint_bin_fwrite_limbs(tmp, w, 3))
+        {
+            flint_printf("FAIL (writing corrupt header)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+        fmpz_mat_init(B, 0, 0);
+
+        if (fmpz_mat_fread_bin(tmp, B))
+        {
+            flint_printf("FAIL (corrupt header)\n");
+            flint_abort();
+        }
+
+        fmpz_mat_clear(B);
+        fclose(tmp);
+    }
+
+#endif
+
+    TEST_FUNCTION_END(state);
+}
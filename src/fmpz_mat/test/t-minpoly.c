@@ -28,6 +28,8 @@ TEST_FUNCTION_START(fmpz_mat_minpoly, state)
         m = n_randint(state, 4);
         n = m;
 
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
         fmpz_init(c);
         fmpz_mat_init(A, m, n);
         fmpz_poly_init(f);
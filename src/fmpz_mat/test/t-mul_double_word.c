@@ -86,6 +86,7 @@ TEST_FUNCTION_START(fmpz_mat_mul_double_word, state)
 
         fmpz_mat_randtest(C, state, n_randint(state, 200) + 1);
 
+        flint_set_cpu_features(n_randlimb(state));
         _fmpz_mat_mul_double_word(C, A, B);
         fmpz_mat_mul_classical_inline(D, A, B);
 
@@ -106,5 +107,7 @@ TEST_FUNCTION_START(fmpz_mat_mul_double_word, state)
         fmpz_mat_clear(D);
     }
 
+    flint_set_cpu_features(UWORD_MAX);
+
     TEST_FUNCTION_END(state);
 }
@@ -31,6 +31,7 @@
 #define FMPZ_MOD_MAT_LU_RECURSIVE_CUTOFF 4
 #define FMPZ_MOD_MAT_SOLVE_TRI_ROWS_CUTOFF 64
 #define FMPZ_MOD_MAT_SOLVE_TRI_COLS_CUTOFF 64
+#define FMPZ_MOD_MAT_RREF_CUTOFF 8
 
 /* Element access  ********************************************************/
 
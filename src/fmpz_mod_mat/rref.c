@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2019 Tommy Hofmann
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -9,9 +10,96 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "perm.h"
+#include "fmpz.h"
 #include "fmpz_mod_mat.h"
 
-slong fmpz_mod_mat_rref(slong * perm, fmpz_mod_mat_t mat)
+slong fmpz_mod_mat_rref(slong * perm, fmpz_mod_mat_t A)
 {
-    return fmpz_mat_rref_mod(perm, mat->mat, mat->mod);
+    slong i, j, k, m, n, rank;
+    slong * P, * pivots, * nonpivots;
+    fmpz_mod_mat_t U, V;
+
+    m = A->mat->r;
+    n = A->mat->c;
+
+    if (m < FMPZ_MOD_MAT_RREF_CUTOFF || n < FMPZ_MOD_MAT_RREF_CUTOFF)
+        return fmpz_mat_rref_mod(perm, A->mat, A->mod);
+
+    /* The elimination is done by the block recursive LU decomposition,
+       followed by a triangular solve for the part right of the pivots. */
+    P = _perm_init(m);
+    rank = fmpz_mod_mat_lu(P, A, 0);
+
+    if (perm != NULL)
+    {
+        slong * t = _perm_init(m);
+
+        for (i = 0; i < m; i++)
+            t[i] = perm[P[i]];
+        _perm_set(perm, t, m);
+        _perm_clear(t);
+    }
+
+    _perm_clear(P);
+
+    if (rank == 0)
+        return 0;
+
+    /* Clear L */
+    for (i = 0; i < m; i++)
+        for (j = 0; j < FLINT_MIN(i, rank); j++)
+            fmpz_zero(fmpz_mod_mat_entry(A, i, j));
+
+    /* Reorder U to upper triangular form U | V with U of full rank, set
+       V = U^(-1) V and put the columns back in their original order. */
+    fmpz_mod_mat_init(U, rank, rank, A->mod);
+    fmpz_mod_mat_init(V, rank, n - rank, A->mod);
+
+    pivots = flint_malloc(sizeof(slong) * n);
+    nonpivots = pivots + rank;
+
+    for (i = j = k = 0; i < rank; i++)
+    {
+        while (fmpz_is_zero(fmpz_mod_mat_entry(A, i, j)))
+        {
+            nonpivots[k] = j;
+            k++;
+            j++;
+        }
+        pivots[i] = j;
+        j++;
+    }
+    while (k < n - rank)
+    {
+        nonpivots[k] = j;
+        k++;
+        j++;
+    }
+
+    for (i = 0; i < rank; i++)
+        for (j = 0; j <= i; j++)
+            fmpz_swap(fmpz_mod_mat_entry(U, j, i),
+                      fmpz_mod_mat_entry(A, j, pivots[i]));
+
+    for (i = 0; i < n - rank; i++)
+        for (j = 0; j < rank; j++)
+            fmpz_swap(fmpz_mod_mat_entry(V, j, i),
+                      fmpz_mod_mat_entry(A, j, nonpivots[i]));
+
+    fmpz_mod_mat_solve_triu(V, U, V, 0);
+
+    for (i = 0; i < rank; i++)
+        fmpz_one(fmpz_mod_mat_entry(A, i, pivots[i]));
+
+    for (i = 0; i < n - rank; i++)
+        for (j = 0; j < rank; j++)
+            fmpz_swap(fmpz_mod_mat_entry(A, j, nonpivots[i]),
+                      fmpz_mod_mat_entry(V, j, i));
+
+    flint_free(pivots);
+    fmpz_mod_mat_clear(U);
+    fmpz_mod_mat_clear(V);
+
+    return rank;
 }
@@ -18,10 +18,13 @@ void fmpz_mod_mat_submul(fmpz_mod_mat_t D,
                          const fmpz_mod_mat_t A,
                          const fmpz_mod_mat_t B)
 {
-    fmpz_mod_mat_t tmp;
-    fmpz_mod_mat_init(tmp, A->mat->r, B->mat->c, A->mod);
-    fmpz_mod_mat_mul(tmp, A, B);
-    fmpz_mod_mat_sub(D, C, tmp);
-    fmpz_mod_mat_clear(tmp);
+    fmpz_mat_t tmp;
+
+    /* reduce only once, after the subtraction */
+    fmpz_mat_init(tmp, A->mat->r, B->mat->c);
+    fmpz_mat_mul(tmp, A->mat, B->mat);
+    fmpz_mat_sub(D->mat, C->mat, tmp);
+    fmpz_mat_clear(tmp);
+    _fmpz_mod_mat_reduce(D);
 }
 
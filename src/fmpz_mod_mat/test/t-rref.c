@@ -135,5 +135,46 @@ TEST_FUNCTION_START(fmpz_mod_mat_rref, state)
         flint_free(perm);
     }
 
+    /* Compare with classical Gauss-Jordan elimination */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_mat_t C;
+
+        m = n_randint(state, 40);
+        n = n_randint(state, 40);
+        perm = flint_malloc(FLINT_MAX(1, m) * sizeof(slong));
+
+        fmpz_init(p);
+        fmpz_randprime(p, state, 2 + n_randint(state, 300), 0);
+
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+        d = n_randint(state, 2 * m * n + 1);
+
+        fmpz_mod_mat_init(A, m, n, p);
+        fmpz_mat_init(C, m, n);
+
+        fmpz_mod_mat_randrank(A, state, r);
+        fmpz_mat_randops(A->mat, state, d);
+        _fmpz_mod_mat_reduce(A);
+        fmpz_mat_set(C, A->mat);
+
+        rank = fmpz_mod_mat_rref(perm, A);
+
+        if (rank != fmpz_mat_rref_mod(NULL, C, p) || !fmpz_mat_equal(A->mat, C))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("mismatch with fmpz_mat_rref_mod\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        check_rref(A);
+
+        fmpz_mod_mat_clear(A);
+        fmpz_mat_clear(C);
+        fmpz_clear(p);
+        flint_free(perm);
+    }
+
     TEST_FUNCTION_END(state);
 }
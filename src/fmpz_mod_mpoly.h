@@ -665,6 +665,22 @@ int _fmpz_mod_mpoly_mul_dense_maxfields(fmpz_mod_mpoly_t P,
                                 const fmpz_mod_mpoly_t B, fmpz * maxBfields,
                                                const fmpz_mod_mpoly_ctx_t ctx);
 
+void _fmpz_mod_mpoly_mul_johnson(fmpz_mod_mpoly_t A,
+                 const fmpz * Bcoeffs, const ulong * Bexps, slong Blen,
+                 const fmpz * Ccoeffs, const ulong * Cexps, slong Clen,
+                 flint_bitcnt_t bits, slong N, const ulong * cmpmask,
+                                                    const fmpz_mod_ctx_t ctx);
+
+void fmpz_mod_mpoly_mul_heap_threaded(fmpz_mod_mpoly_t A,
+                          const fmpz_mod_mpoly_t B, const fmpz_mod_mpoly_t C,
+                                               const fmpz_mod_mpoly_ctx_t ctx);
+
+void _fmpz_mod_mpoly_mul_heap_threaded_pool_maxfields(fmpz_mod_mpoly_t A,
+                                const fmpz_mod_mpoly_t B, fmpz * maxBfields,
+                                const fmpz_mod_mpoly_t C, fmpz * maxCfields,
+                                                const fmpz_mod_mpoly_ctx_t ctx,
+                        const thread_pool_handle * handles, slong num_handles);
+
 /* Powering ******************************************************************/
 
 int fmpz_mod_mpoly_pow_fmpz(fmpz_mod_mpoly_t A,
@@ -723,6 +739,15 @@ int fmpz_mod_mpoly_divides_monagan_pearce(fmpz_mod_mpoly_t Q,
                         const fmpz_mod_mpoly_t A, const fmpz_mod_mpoly_t B,
                                                const fmpz_mod_mpoly_ctx_t ctx);
 
+int fmpz_mod_mpoly_divides_heap_threaded(fmpz_mod_mpoly_t Q,
+                        const fmpz_mod_mpoly_t A, const fmpz_mod_mpoly_t B,
+                                               const fmpz_mod_mpoly_ctx_t ctx);
+
+int _fmpz_mod_mpoly_divides_heap_threaded_pool(fmpz_mod_mpoly_t Q,
+                        const fmpz_mod_mpoly_t A, const fmpz_mod_mpoly_t B,
+                                                const fmpz_mod_mpoly_ctx_t ctx,
+                        const thread_pool_handle * handles, slong num_handles);
+
 void fmpz_mod_mpoly_div_monagan_pearce(fmpz_mod_mpoly_t Q,
                           const fmpz_mod_mpoly_t A, const fmpz_mod_mpoly_t B,
                                                const fmpz_mod_mpoly_ctx_t ctx);
@@ -812,6 +837,26 @@ void fmpz_mod_mpoly_inflate(fmpz_mod_mpoly_t A,
             const fmpz_mod_mpoly_t B, const fmpz * shift, const fmpz * stride,
                                                const fmpz_mod_mpoly_ctx_t ctx);
 
+/* data is passed to the threaded mul/div functions via a stripe struct */
+
+typedef struct _fmpz_mod_mpoly_stripe_struct
+{
+    char * big_mem;
+    slong big_mem_alloc;
+    const fmpz_mod_mpoly_ctx_struct * ctx;
+    slong N;
+    flint_bitcnt_t bits;
+    fmpz_t lc_minus_inv;
+    const ulong * cmpmask;
+    slong * startidx;
+    slong * endidx;
+    ulong * emin;
+    ulong * emax;
+    int upperclosed;
+} fmpz_mod_mpoly_stripe_struct;
+
+typedef fmpz_mod_mpoly_stripe_struct fmpz_mod_mpoly_stripe_t[1];
+
 /* Univariates ***************************************************************/
 
 void fmpz_mod_mpoly_univar_init(fmpz_mod_mpoly_univar_t A,
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "fmpz_mod_mpoly.h"
 #include "ulong_extras.h"
 
@@ -62,6 +63,9 @@ int fmpz_mod_mpoly_divides(
     int success;
     slong i;
     fmpz * maxAfields, * maxBfields;
+    thread_pool_handle * handles;
+    slong num_handles;
+    slong thread_limit;
     TMP_INIT;
 
     if (fmpz_mod_mpoly_is_zero(B, ctx))
@@ -119,8 +123,25 @@ int fmpz_mod_mpoly_divides(
 
 do_heap:
 
-    success = _fmpz_mod_mpoly_divides_monagan_pearce_maxfields(Q,
+    /* the threaded division needs an invertible leading coefficient */
+    thread_limit = fmpz_mod_is_invertible(B->coeffs + 0, ctx->ffinfo) ?
+                                                           A->length/1024 : 0;
+
+    num_handles = flint_request_threads(&handles, thread_limit);
+
+    if (num_handles > 0)
+    {
+        success = _fmpz_mod_mpoly_divides_heap_threaded_pool(Q, A, B, ctx,
+                                                         handles, num_handles);
+    }
+    else
+    {
+        success = _fmpz_mod_mpoly_divides_monagan_pearce_maxfields(Q,
                                             A, maxAfields, B, maxBfields, ctx);
+    }
+
+    flint_give_back_threads(handles, num_handles);
+
 cleanup:
 
     for (i = 0; i < 2*ctx->minfo->nfields; i++)
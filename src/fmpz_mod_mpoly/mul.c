@@ -9,6 +9,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "fmpz_mod_mpoly.h"
 #include "ulong_extras.h"
 #include "long_extras.h"
@@ -81,6 +82,9 @@ void fmpz_mod_mpoly_mul(
     slong i;
     fmpz * maxBfields, * maxCfields;
     slong min_length, max_length;
+    thread_pool_handle * handles;
+    slong num_handles;
+    slong thread_limit;
     TMP_INIT;
 
     if (B->length < 1 || C->length < 1)
@@ -102,6 +106,8 @@ void fmpz_mod_mpoly_mul(
     min_length = FLINT_MIN(B->length, C->length);
     max_length = FLINT_MAX(B->length, C->length);
 
+    thread_limit = min_length/512;
+
     if (min_length < 20 || max_length < 50 ||
         B->bits > FLINT_BITS || C->bits > FLINT_BITS)
     {
@@ -116,7 +122,19 @@ void fmpz_mod_mpoly_mul(
 
 do_heap:
 
-    _fmpz_mod_mpoly_mul_johnson_maxfields(A, B, maxBfields, C, maxCfields, ctx);
+    num_handles = flint_request_threads(&handles, thread_limit);
+
+    if (num_handles > 0)
+    {
+        _fmpz_mod_mpoly_mul_heap_threaded_pool_maxfields(A,
+                      B, maxBfields, C, maxCfields, ctx, handles, num_handles);
+    }
+    else
+    {
+        _fmpz_mod_mpoly_mul_johnson_maxfields(A, B, maxBfields, C, maxCfields, ctx);
+    }
+
+    flint_give_back_threads(handles, num_handles);
 
 cleanup:
 
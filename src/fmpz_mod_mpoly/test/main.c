@@ -23,6 +23,7 @@
 #include "t-derivative.c"
 #include "t-divides.c"
 #include "t-divides_dense.c"
+#include "t-divides_heap_threaded.c"
 #include "t-divides_monagan_pearce.c"
 #include "t-div_monagan_pearce.c"
 #include "t-divrem.c"
@@ -49,6 +50,7 @@
 #include "t-get_term_monomial.c"
 #include "t-mul.c"
 #include "t-mul_dense.c"
+#include "t-mul_heap_threaded.c"
 #include "t-mul_johnson.c"
 #include "t-push_term_fmpz_fmpz.c"
 #include "t-push_term_fmpz_ui.c"
@@ -74,6 +76,7 @@ test_struct tests[] =
     TEST_FUNCTION(fmpz_mod_mpoly_derivative),
     TEST_FUNCTION(fmpz_mod_mpoly_divides),
     TEST_FUNCTION(fmpz_mod_mpoly_divides_dense),
+    TEST_FUNCTION(fmpz_mod_mpoly_divides_heap_threaded),
     TEST_FUNCTION(fmpz_mod_mpoly_divides_monagan_pearce),
     TEST_FUNCTION(fmpz_mod_mpoly_div_monagan_pearce),
     TEST_FUNCTION(fmpz_mod_mpoly_divrem),
@@ -100,6 +103,7 @@ test_struct tests[] =
     TEST_FUNCTION(fmpz_mod_mpoly_get_term_monomial),
     TEST_FUNCTION(fmpz_mod_mpoly_mul),
     TEST_FUNCTION(fmpz_mod_mpoly_mul_dense),
+    TEST_FUNCTION(fmpz_mod_mpoly_mul_heap_threaded),
     TEST_FUNCTION(fmpz_mod_mpoly_mul_johnson),
     TEST_FUNCTION(fmpz_mod_mpoly_push_term_fmpz_fmpz),
     TEST_FUNCTION(fmpz_mod_mpoly_push_term_fmpz_ui),
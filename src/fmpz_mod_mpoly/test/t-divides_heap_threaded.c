@@ -0,0 +1,190 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "fmpz_mod_mpoly.h"
+
+TEST_FUNCTION_START(fmpz_mod_mpoly_divides_heap_threaded, state)
+{
+    slong i, j, result, result2, max_threads = 5, tmul = 20;
+#ifdef _WIN32
+    tmul = 1;
+#endif
+
+    {
+        fmpz_t p;
+        fmpz_mod_mpoly_ctx_t ctx;
+        fmpz_mod_mpoly_t q, f, g, h, h2;
+        const char * vars[] = {"x","y","z","t","u"};
+
+        fmpz_init(p);
+        fmpz_set_str(p, "73786976294838206473", 10);
+        fmpz_mod_mpoly_ctx_init(ctx, 5, ORD_DEGLEX, p);
+        fmpz_mod_mpoly_init(f, ctx);
+        fmpz_mod_mpoly_init(g, ctx);
+        fmpz_mod_mpoly_init(q, ctx);
+        fmpz_mod_mpoly_init(h, ctx);
+        fmpz_mod_mpoly_init(h2, ctx);
+        fmpz_mod_mpoly_set_str_pretty(g, "(1+x+y+2*z^2+3*t^3+5*u^5)^6", vars, ctx);
+        fmpz_mod_mpoly_set_str_pretty(f, "(1+u+t+2*z^2+3*y^3+5*x^5)^6", vars, ctx);
+
+        fmpz_mod_mpoly_mul(q, f, g, ctx);
+        result = fmpz_mod_mpoly_divides_monagan_pearce(h, q, f, ctx);
+        fmpz_mod_mpoly_assert_canonical(h, ctx);
+        flint_set_num_threads(2);
+        result2 = fmpz_mod_mpoly_divides_heap_threaded(h2, q, f, ctx);
+        fmpz_mod_mpoly_assert_canonical(h2, ctx);
+
+        if (!result || !result2
+                    || !fmpz_mod_mpoly_equal(h, g, ctx)
+                    || !fmpz_mod_mpoly_equal(h2, g, ctx))
+        {
+            flint_printf("FAIL: Check simple example\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mod_mpoly_clear(f, ctx);
+        fmpz_mod_mpoly_clear(g, ctx);
+        fmpz_mod_mpoly_clear(q, ctx);
+        fmpz_mod_mpoly_clear(h, ctx);
+        fmpz_mod_mpoly_clear(h2, ctx);
+        fmpz_mod_mpoly_ctx_clear(ctx);
+        fmpz_clear(p);
+    }
+
+    /* Check f*g/g = f */
+    for (i = 0; i < tmul * flint_test_multiplier(); i++)
+    {
+        fmpz_mod_mpoly_ctx_t ctx;
+        fmpz_mod_mpoly_t f, g, h, k;
+        slong len1, len2;
+        flint_bitcnt_t exp_bits1, exp_bits2;
+
+        fmpz_mod_mpoly_ctx_init_rand_bits_prime(ctx, state, 10, 200);
+
+        fmpz_mod_mpoly_init(f, ctx);
+        fmpz_mod_mpoly_init(g, ctx);
+        fmpz_mod_mpoly_init(h, ctx);
+        fmpz_mod_mpoly_init(k, ctx);
+
+        len1 = n_randint(state, 50);
+        len2 = n_randint(state, 50) + 1;
+
+        exp_bits1 = n_randint(state, 200) + 2;
+        exp_bits2 = n_randint(state, 200) + 2;
+
+        for (j = 0; j < 4; j++)
+        {
+            fmpz_mod_mpoly_randtest_bits(f, state, len1, exp_bits1, ctx);
+            fmpz_mod_mpoly_randtest_bits(g, state, len2, exp_bits2, ctx);
+            if (fmpz_mod_mpoly_is_zero(g, ctx))
+                fmpz_mod_mpoly_one(g, ctx);
+            fmpz_mod_mpoly_randtest_bits(k, state, len1, exp_bits1, ctx);
+
+            flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+            fmpz_mod_mpoly_mul_johnson(h, f, g, ctx);
+            fmpz_mod_mpoly_assert_canonical(h, ctx);
+
+            switch (j)
+            {
+                case 1:
+                    result = fmpz_mod_mpoly_divides_heap_threaded(h, h, g, ctx);
+                    fmpz_mod_mpoly_swap(k, h, ctx);
+                    break;
+                case 2:
+                    fmpz_mod_mpoly_set(k, g, ctx);
+                    result = fmpz_mod_mpoly_divides_heap_threaded(k, h, k, ctx);
+                    break;
+                default:
+                    result = fmpz_mod_mpoly_divides_heap_threaded(k, h, g, ctx);
+                    break;
+            }
+
+            fmpz_mod_mpoly_assert_canonical(k, ctx);
+
+            if (!result || !fmpz_mod_mpoly_equal(f, k, ctx))
+            {
+                flint_printf("FAIL: Check f*g/g = f\n");
+                flint_printf("i = %wd, j = %wd\n", i ,j);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        fmpz_mod_mpoly_clear(f, ctx);
+        fmpz_mod_mpoly_clear(g, ctx);
+        fmpz_mod_mpoly_clear(h, ctx);
+        fmpz_mod_mpoly_clear(k, ctx);
+        fmpz_mod_mpoly_ctx_clear(ctx);
+    }
+
+    /* Check random polys don't divide */
+    for (i = 0; i < tmul * flint_test_multiplier(); i++)
+    {
+        fmpz_mod_mpoly_ctx_t ctx;
+        fmpz_mod_mpoly_t f, g, p, h1, h2;
+        slong len1, len2, len3;
+        flint_bitcnt_t exp_bits1, exp_bits2, exp_bound3;
+
+        fmpz_mod_mpoly_ctx_init_rand_bits_prime(ctx, state, 10, 200);
+
+        fmpz_mod_mpoly_init(f, ctx);
+        fmpz_mod_mpoly_init(g, ctx);
+        fmpz_mod_mpoly_init(p, ctx);
+        fmpz_mod_mpoly_init(h1, ctx);
+        fmpz_mod_mpoly_init(h2, ctx);
+
+        len1 = n_randint(state, 50);
+        len2 = n_randint(state, 50) + 1;
+        len3 = n_randint(state, 10);
+
+        exp_bits1 = n_randint(state, 100) + 2;
+        exp_bits2 = n_randint(state, 100) + 2;
+        exp_bound3 = n_randint(state, 20) + 1;
+
+        for (j = 0; j < 4; j++)
+        {
+            fmpz_mod_mpoly_randtest_bits(f, state, len1, exp_bits1, ctx);
+            fmpz_mod_mpoly_randtest_bits(g, state, len2, exp_bits2, ctx);
+            if (fmpz_mod_mpoly_is_zero(g, ctx))
+                fmpz_mod_mpoly_one(g, ctx);
+            fmpz_mod_mpoly_randtest_bound(p, state, len3, exp_bound3, ctx);
+
+            flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+            fmpz_mod_mpoly_mul(f, f, g, ctx);
+            fmpz_mod_mpoly_add(f, f, p, ctx);
+            result = fmpz_mod_mpoly_divides_monagan_pearce(h1, f, g, ctx);
+            fmpz_mod_mpoly_assert_canonical(h1, ctx);
+            result2 = fmpz_mod_mpoly_divides_heap_threaded(h2, f, g, ctx);
+            fmpz_mod_mpoly_assert_canonical(h2, ctx);
+
+            if (result != result2 || !fmpz_mod_mpoly_equal(h1, h2, ctx))
+            {
+                flint_printf("FAIL: Check random polys don't divide\n");
+                flint_printf("i = %wd, j = %wd\n", i ,j);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        fmpz_mod_mpoly_clear(f, ctx);
+        fmpz_mod_mpoly_clear(g, ctx);
+        fmpz_mod_mpoly_clear(p, ctx);
+        fmpz_mod_mpoly_clear(h1, ctx);
+        fmpz_mod_mpoly_clear(h2, ctx);
+        fmpz_mod_mpoly_ctx_clear(ctx);
+    }
+
+    TEST_FUNCTION_END(state);
+}
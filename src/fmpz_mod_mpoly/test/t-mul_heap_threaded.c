@@ -0,0 +1,176 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "fmpz_mod_mpoly.h"
+
+TEST_FUNCTION_START(fmpz_mod_mpoly_mul_heap_threaded, state)
+{
+    slong i, j, max_threads = 5;
+    slong tmul = 10;
+#ifdef _WIN32
+    tmul = 2;
+#endif
+
+    {
+        fmpz_t p;
+        fmpz_mod_mpoly_ctx_t ctx;
+        fmpz_mod_mpoly_t f, g, h1, h2;
+        const char * vars[] = {"x","y","z","t","u"};
+
+        fmpz_init(p);
+        fmpz_set_str(p, "73786976294838206473", 10);
+        fmpz_mod_mpoly_ctx_init(ctx, 5, ORD_LEX, p);
+        fmpz_mod_mpoly_init(f, ctx);
+        fmpz_mod_mpoly_init(g, ctx);
+        fmpz_mod_mpoly_init(h1, ctx);
+        fmpz_mod_mpoly_init(h2, ctx);
+
+        fmpz_mod_mpoly_set_str_pretty(f, "(1+x+y+2*z^2+3*t^3+5*u^5)^6", vars, ctx);
+        fmpz_mod_mpoly_set_str_pretty(g, "(1+u+t+2*z^2+3*y^3+5*x^5)^6", vars, ctx);
+
+        fmpz_mod_mpoly_mul_johnson(h1, f, g, ctx);
+        flint_set_num_threads(2);
+        fmpz_mod_mpoly_mul_heap_threaded(h2, f, g, ctx);
+        fmpz_mod_mpoly_assert_canonical(h2, ctx);
+
+        if (!fmpz_mod_mpoly_equal(h1, h2, ctx))
+        {
+            flint_printf("FAIL: Check simple example\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mod_mpoly_clear(f, ctx);
+        fmpz_mod_mpoly_clear(g, ctx);
+        fmpz_mod_mpoly_clear(h1, ctx);
+        fmpz_mod_mpoly_clear(h2, ctx);
+        fmpz_mod_mpoly_ctx_clear(ctx);
+        fmpz_clear(p);
+    }
+
+    /* Check mul_heap_threaded matches mul_johnson */
+    for (i = 0; i < tmul * flint_test_multiplier(); i++)
+    {
+        fmpz_mod_mpoly_ctx_t ctx;
+        fmpz_mod_mpoly_t f, g, h, k;
+        slong len, len1, len2;
+        flint_bitcnt_t exp_bits, exp_bits1, exp_bits2;
+
+        fmpz_mod_mpoly_ctx_init_rand_bits(ctx, state, 10, 200);
+
+        fmpz_mod_mpoly_init(f, ctx);
+        fmpz_mod_mpoly_init(g, ctx);
+        fmpz_mod_mpoly_init(h, ctx);
+        fmpz_mod_mpoly_init(k, ctx);
+
+        len = n_randint(state, 100);
+        len1 = n_randint(state, 100);
+        len2 = n_randint(state, 100);
+
+        exp_bits = n_randint(state, 200) + 2;
+        exp_bits1 = n_randint(state, 200) + 2;
+        exp_bits2 = n_randint(state, 200) + 2;
+
+        for (j = 0; j < 4; j++)
+        {
+            fmpz_mod_mpoly_randtest_bits(f, state, len1, exp_bits1, ctx);
+            fmpz_mod_mpoly_randtest_bits(g, state, len2, exp_bits2, ctx);
+            fmpz_mod_mpoly_randtest_bits(h, state, len, exp_bits, ctx);
+            fmpz_mod_mpoly_randtest_bits(k, state, len, exp_bits, ctx);
+
+            flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+            fmpz_mod_mpoly_mul_johnson(h, f, g, ctx);
+            fmpz_mod_mpoly_assert_canonical(h, ctx);
+            fmpz_mod_mpoly_mul_heap_threaded(k, f, g, ctx);
+            fmpz_mod_mpoly_assert_canonical(k, ctx);
+
+            if (!fmpz_mod_mpoly_equal(h, k, ctx))
+            {
+                flint_printf("FAIL: Check mul_heap_threaded matches mul_johnson\n");
+                flint_printf("i = %wd, j = %wd\n", i ,j);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        fmpz_mod_mpoly_clear(f, ctx);
+        fmpz_mod_mpoly_clear(g, ctx);
+        fmpz_mod_mpoly_clear(h, ctx);
+        fmpz_mod_mpoly_clear(k, ctx);
+        fmpz_mod_mpoly_ctx_clear(ctx);
+    }
+
+    /* Check aliasing */
+    for (i = 0; i < tmul * flint_test_multiplier(); i++)
+    {
+        fmpz_mod_mpoly_ctx_t ctx;
+        fmpz_mod_mpoly_t f, g, h;
+        slong len1, len2;
+        flint_bitcnt_t exp_bits1, exp_bits2;
+
+        fmpz_mod_mpoly_ctx_init_rand_bits(ctx, state, 10, 200);
+
+        fmpz_mod_mpoly_init(f, ctx);
+        fmpz_mod_mpoly_init(g, ctx);
+        fmpz_mod_mpoly_init(h, ctx);
+
+        len1 = n_randint(state, 100);
+        len2 = n_randint(state, 100);
+
+        exp_bits1 = n_randint(state, 200) + 2;
+        exp_bits2 = n_randint(state, 200) + 2;
+
+        for (j = 0; j < 4; j++)
+        {
+            fmpz_mod_mpoly_randtest_bits(f, state, len1, exp_bits1, ctx);
+            fmpz_mod_mpoly_randtest_bits(g, state, len2, exp_bits2, ctx);
+
+            flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+            fmpz_mod_mpoly_mul_johnson(h, f, g, ctx);
+            fmpz_mod_mpoly_assert_canonical(h, ctx);
+
+            if (j & 1)
+            {
+                fmpz_mod_mpoly_mul_heap_threaded(g, f, g, ctx);
+                fmpz_mod_mpoly_assert_canonical(g, ctx);
+                if (!fmpz_mod_mpoly_equal(h, g, ctx))
+                {
+                    flint_printf("FAIL: Check aliasing second argument\n");
+                    flint_printf("i = %wd, j = %wd\n", i ,j);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+            else
+            {
+                fmpz_mod_mpoly_mul_heap_threaded(f, f, g, ctx);
+                fmpz_mod_mpoly_assert_canonical(f, ctx);
+                if (!fmpz_mod_mpoly_equal(h, f, ctx))
+                {
+                    flint_printf("FAIL: Check aliasing first argument\n");
+                    flint_printf("i = %wd, j = %wd\n", i ,j);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        fmpz_mod_mpoly_clear(f, ctx);
+        fmpz_mod_mpoly_clear(g, ctx);
+        fmpz_mod_mpoly_clear(h, ctx);
+        fmpz_mod_mpoly_ctx_clear(ctx);
+    }
+
+    TEST_FUNCTION_END(state);
+}
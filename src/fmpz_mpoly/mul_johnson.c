@@ -35,7 +35,7 @@ slong _fmpz_mpoly_mul_johnson1(fmpz ** poly1, ulong ** exp1, slong * alloc,
    slong * hind;
    ulong exp, cy;
    ulong c[3], p[2]; /* for accumulating coefficients */
-   int first, small;
+   int first, small, quad;
    TMP_INIT;
 
    TMP_START;
@@ -45,7 +45,11 @@ slong _fmpz_mpoly_mul_johnson1(fmpz ** poly1, ulong ** exp1, slong * alloc,
                                            _fmpz_mpoly_fits_small(poly3, len3);
 
    next_loc = len2 + 4;   /* something bigger than heap can ever be */
-   heap = (mpoly_heap1_s *) TMP_ALLOC((len2 + 1)*sizeof(mpoly_heap1_s));
+   /* large heaps are 4-ary, aligned so that siblings share a cache line */
+   quad = len2 > MPOLY_HEAP4_CUTOFF;
+   heap = (mpoly_heap1_s *) TMP_ALLOC((len2 + 1 + MPOLY_HEAP4_PAD)*
+                                                sizeof(mpoly_heap1_s));
+   heap = MPOLY_HEAP4_ALIGN(heap);
    /* alloc array of heap nodes which can be chained together */
    chain = (mpoly_heap_t *) TMP_ALLOC(len2*sizeof(mpoly_heap_t));
    /* space for temporary storage of pointers to heap nodes */
@@ -88,7 +92,8 @@ slong _fmpz_mpoly_mul_johnson1(fmpz ** poly1, ulong ** exp1, slong * alloc,
       while (heap_len > 1 && heap[1].exp == exp)
       {
          /* pop chain from heap */
-         x = _mpoly_heap_pop1(heap, &heap_len, maskhi);
+         x = quad ? _mpoly_heap4_pop1(heap, &heap_len, maskhi)
+                  : _mpoly_heap_pop1(heap, &heap_len, maskhi);
 
          /* take node out of heap and put into store */
          hind[x->i] |= WORD(1);
@@ -172,7 +177,11 @@ slong _fmpz_mpoly_mul_johnson1(fmpz ** poly1, ulong ** exp1, slong * alloc,
             x->next = NULL;
 
             hind[x->i] = 2*(x->j+1) + 0;
-            _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j], x,
+            if (quad)
+               _mpoly_heap4_insert1(heap, exp2[x->i] + exp3[x->j], x,
+                                                 &next_loc, &heap_len, maskhi);
+            else
+               _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j], x,
                                                  &next_loc, &heap_len, maskhi);
          }
 
@@ -191,7 +200,11 @@ slong _fmpz_mpoly_mul_johnson1(fmpz ** poly1, ulong ** exp1, slong * alloc,
             x->next = NULL;
 
             hind[x->i] = 2*(x->j+1) + 0;
-            _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j], x,
+            if (quad)
+               _mpoly_heap4_insert1(heap, exp2[x->i] + exp3[x->j], x,
+                                                 &next_loc, &heap_len, maskhi);
+            else
+               _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j], x,
                                                  &next_loc, &heap_len, maskhi);
          }
       }
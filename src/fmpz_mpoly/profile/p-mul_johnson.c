@@ -0,0 +1,193 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+/* usage:
+likwid-setFrequencies -g performance
+make profile MOD=fmpz_mpoly && ./build/fmpz_mpoly/profile/p-mul_johnson 12 12
+
+p-mul_johnson m n:
+    A = (1+x+y+2*z^2+3*t^3+5*u^5)^m, B = (1+u+t+2*z^2+3*y^3+5*x^5)^n
+    with single word exponents. First merge the len(A) sorted rows
+    A[i]*B with the binary heap and with the 4-ary heap used by the
+    Johnson multiplication, then time fmpz_mpoly_mul_johnson and
+    nmod_mpoly_mul_johnson on A*B.
+*/
+
+#include <stdlib.h>
+#include "profiler.h"
+#include "mpoly.h"
+#include "nmod_mpoly.h"
+#include "fmpz_mpoly.h"
+
+/* merge the rows exp2[i] + exp3[j] using one heap node per row */
+static slong merge_rows(int quad, const ulong * exp2, slong len2,
+                         const ulong * exp3, slong len3, ulong maskhi)
+{
+    slong i, heap_len = 1, next_loc = len2 + 4, count = 0;
+    mpoly_heap1_s * heap, * heap_alloc;
+    mpoly_heap_t * chain, * x, * y;
+    ulong exp;
+
+    heap_alloc = (mpoly_heap1_s *) flint_malloc((len2 + 1 + MPOLY_HEAP4_PAD)*
+                                                      sizeof(mpoly_heap1_s));
+    heap = quad ? MPOLY_HEAP4_ALIGN(heap_alloc) : heap_alloc;
+    chain = (mpoly_heap_t *) flint_malloc(len2*sizeof(mpoly_heap_t));
+
+    for (i = 0; i < len2; i++)
+    {
+        x = chain + i;
+        x->i = i;
+        x->j = 0;
+        x->next = NULL;
+        if (quad)
+            _mpoly_heap4_insert1(heap, exp2[i] + exp3[0], x,
+                                             &next_loc, &heap_len, maskhi);
+        else
+            _mpoly_heap_insert1(heap, exp2[i] + exp3[0], x,
+                                             &next_loc, &heap_len, maskhi);
+    }
+
+    while (heap_len > 1)
+    {
+        exp = heap[1].exp;
+        count++;
+
+        while (heap_len > 1 && heap[1].exp == exp)
+        {
+            x = quad ? _mpoly_heap4_pop1(heap, &heap_len, maskhi)
+                     : _mpoly_heap_pop1(heap, &heap_len, maskhi);
+
+            do {
+                y = x->next;
+                if (++x->j < len3)
+                {
+                    x->next = NULL;
+                    if (quad)
+                        _mpoly_heap4_insert1(heap, exp2[x->i] + exp3[x->j],
+                                          x, &next_loc, &heap_len, maskhi);
+                    else
+                        _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j],
+                                          x, &next_loc, &heap_len, maskhi);
+                }
+            } while ((x = y) != NULL);
+        }
+    }
+
+    flint_free(heap_alloc);
+    flint_free(chain);
+
+    return count;
+}
+
+int main(int argc, char *argv[])
+{
+    slong m, n, count2, count4;
+    ulong maskhi;
+    timeit_t timer;
+    fmpz_mpoly_ctx_t ctx;
+    fmpz_mpoly_t a, b, A, B, C;
+    nmod_mpoly_ctx_t nctx;
+    nmod_mpoly_t nA, nB, nC;
+    const char * vars[] = {"x", "y", "z", "t", "u"};
+
+    if (argc == 3)
+    {
+        m = atoi(argv[1]);
+        n = atoi(argv[2]);
+    }
+    else
+    {
+        printf("  usage: p-mul_johnson m n\n");
+        printf("running: p-mul_johnson 12 12\n");
+        m = 12;
+        n = 12;
+    }
+
+    m = FLINT_MIN(m, WORD(30));
+    m = FLINT_MAX(m, WORD(1));
+    n = FLINT_MIN(n, WORD(30));
+    n = FLINT_MAX(n, WORD(1));
+
+    fmpz_mpoly_ctx_init(ctx, 5, ORD_LEX);
+    fmpz_mpoly_init(a, ctx);
+    fmpz_mpoly_init(b, ctx);
+    fmpz_mpoly_init(A, ctx);
+    fmpz_mpoly_init(B, ctx);
+    fmpz_mpoly_init(C, ctx);
+
+    fmpz_mpoly_set_str_pretty(a, "1 + x + y + 2*z^2 + 3*t^3 + 5*u^5", vars, ctx);
+    fmpz_mpoly_set_str_pretty(b, "1 + u + t + 2*z^2 + 3*y^3 + 5*x^5", vars, ctx);
+    fmpz_mpoly_pow_ui(A, a, m, ctx);
+    fmpz_mpoly_pow_ui(B, b, n, ctx);
+    fmpz_mpoly_repack_bits(B, B, A->bits, ctx);
+
+    if (mpoly_words_per_exp(A->bits, ctx->minfo) != 1)
+    {
+        flint_printf("exponents do not fit one word\n");
+        flint_abort();
+    }
+
+    mpoly_get_cmpmask(&maskhi, 1, A->bits, ctx->minfo);
+
+    flint_printf("lengths %wd, %wd\n", A->length, B->length);
+
+    timeit_start(timer);
+    count2 = merge_rows(0, A->exps, A->length, B->exps, B->length, maskhi);
+    timeit_stop(timer);
+    flint_printf("binary heap merge: %wd ms\n", timer->wall);
+
+    timeit_start(timer);
+    count4 = merge_rows(1, A->exps, A->length, B->exps, B->length, maskhi);
+    timeit_stop(timer);
+    flint_printf(" 4-ary heap merge: %wd ms\n", timer->wall);
+
+    if (count2 != count4)
+    {
+        flint_printf("merge counts differ: %wd, %wd\n", count2, count4);
+        flint_abort();
+    }
+
+    timeit_start(timer);
+    fmpz_mpoly_mul_johnson(C, A, B, ctx);
+    timeit_stop(timer);
+    flint_printf("fmpz_mpoly_mul_johnson: %wd ms, length %wd\n",
+                                                       timer->wall, C->length);
+
+    nmod_mpoly_ctx_init(nctx, 5, ORD_LEX, UWORD(4611686018427388039));
+    nmod_mpoly_init(nA, nctx);
+    nmod_mpoly_init(nB, nctx);
+    nmod_mpoly_init(nC, nctx);
+    nmod_mpoly_set_str_pretty(nA, "1 + x + y + 2*z^2 + 3*t^3 + 5*u^5", vars, nctx);
+    nmod_mpoly_set_str_pretty(nB, "1 + u + t + 2*z^2 + 3*y^3 + 5*x^5", vars, nctx);
+    nmod_mpoly_pow_ui(nA, nA, m, nctx);
+    nmod_mpoly_pow_ui(nB, nB, n, nctx);
+
+    timeit_start(timer);
+    nmod_mpoly_mul_johnson(nC, nA, nB, nctx);
+    timeit_stop(timer);
+    flint_printf("nmod_mpoly_mul_johnson: %wd ms, length %wd\n",
+                                                       timer->wall, nC->length);
+
+    nmod_mpoly_clear(nA, nctx);
+    nmod_mpoly_clear(nB, nctx);
+    nmod_mpoly_clear(nC, nctx);
+    nmod_mpoly_ctx_clear(nctx);
+
+    fmpz_mpoly_clear(a, ctx);
+    fmpz_mpoly_clear(b, ctx);
+    fmpz_mpoly_clear(A, ctx);
+    fmpz_mpoly_clear(B, ctx);
+    fmpz_mpoly_clear(C, ctx);
+    fmpz_mpoly_ctx_clear(ctx);
+
+    flint_cleanup_master();
+    return 0;
+}
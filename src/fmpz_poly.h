@@ -31,6 +31,7 @@ extern "C" {
 #define FMPZ_POLY_INV_NEWTON_CUTOFF 32
 #define FMPZ_POLY_SQRT_DIVCONQUER_CUTOFF 16
 #define FMPZ_POLY_SQRTREM_DIVCONQUER_CUTOFF 16
+#define FMPZ_POLY_HENSEL_TREE_THREAD_CUTOFF 16
 
 /*  Type definitions *********************************************************/
 
@@ -1058,6 +1059,9 @@ int fmpz_poly_fprint_pretty(FILE * file, const fmpz_poly_t poly, const char * x)
 int fmpz_poly_fread(FILE * file, fmpz_poly_t poly);
 
 int fmpz_poly_fread_pretty(FILE *file, fmpz_poly_t poly, char **x);
+
+int fmpz_poly_fwrite_bin(FILE * file, const fmpz_poly_t poly);
+int fmpz_poly_fread_bin(FILE * file, fmpz_poly_t poly);
 #endif
 
 int _fmpz_poly_print_pretty(const fmpz * poly, slong len, const char * x);
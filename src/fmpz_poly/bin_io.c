@@ -0,0 +1,67 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "bin_io.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+
+int
+fmpz_poly_fwrite_bin(FILE * file, const fmpz_poly_t poly)
+{
+    mp_limb_t w = poly->length;
+    slong i;
+
+    if (!flint_bin_fwrite_header(file, FLINT_BIN_FMPZ_POLY) ||
+        !flint_bin_fwrite_limbs(file, &w, 1))
+        return 0;
+
+    for (i = 0; i < poly->length; i++)
+        if (!_fmpz_fwrite_bin(file, poly->coeffs + i))
+            return 0;
+
+    return 1;
+}
+
+int
+fmpz_poly_fread_bin(FILE * file, fmpz_poly_t poly)
+{
+    mp_limb_t w;
+    slong i, len;
+    int swap;
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_FMPZ_POLY, &swap) ||
+        !flint_bin_fread_limbs(file, &w, 1, swap) || (slong) w < 0)
+        return 0;
+
+    len = w;
+    _fmpz_poly_set_length(poly, 0);
+
+    /* len comes from the stream, so only grow poly as the data arrives */
+    for (i = 0; i < len; i++)
+    {
+        if (i >= poly->alloc)
+            fmpz_poly_fit_length(poly,
+                FLINT_MIN(len, FLINT_MAX(2 * i, FLINT_BIN_READ_CHUNK)));
+
+        _fmpz_poly_set_length(poly, i + 1);
+
+        if (!_fmpz_fread_bin(file, poly->coeffs + i, swap))
+        {
+            fmpz_poly_zero(poly);
+            return 0;
+        }
+    }
+
+    _fmpz_poly_normalise(poly);
+
+    return 1;
+}
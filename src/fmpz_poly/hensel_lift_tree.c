@@ -12,6 +12,7 @@
 
 #include "fmpz.h"
 #include "fmpz_poly.h"
+#include "thread_support.h"
 
 void fmpz_poly_hensel_lift_tree(slong *link, fmpz_poly_t *v, fmpz_poly_t *w,
     fmpz_poly_t f, slong r, const fmpz_t p, slong e0, slong e1, slong inv)
@@ -24,7 +25,14 @@ void fmpz_poly_hensel_lift_tree(slong *link, fmpz_poly_t *v, fmpz_poly_t *w,
     fmpz_pow_ui(p0, p, e0);
     fmpz_pow_ui(p1, p, e1 - e0);
 
-    fmpz_poly_hensel_lift_tree_recursive(link, v, w, f, 2*r - 4, inv, p0, p1);
+    if (flint_get_num_threads() > 1)
+    {
+        flint_task_begin(0);
+        fmpz_poly_hensel_lift_tree_recursive(link, v, w, f, 2*r - 4, inv, p0, p1);
+        flint_task_end();
+    }
+    else
+        fmpz_poly_hensel_lift_tree_recursive(link, v, w, f, 2*r - 4, inv, p0, p1);
 
     fmpz_clear(p0);
     fmpz_clear(p1);
@@ -11,6 +11,35 @@
 */
 
 #include "fmpz_poly.h"
+#include "thread_support.h"
+
+/*
+    The two subtrees below node j only read v[j] and v[j + 1] respectively
+    and otherwise touch disjoint entries of v and w, so once node j has
+    been lifted they can be lifted in parallel.
+*/
+
+typedef struct
+{
+    slong * link;
+    fmpz_poly_t * v;
+    fmpz_poly_t * w;
+    fmpz_poly_struct * f;
+    slong j;
+    slong inv;
+    const fmpz * p0;
+    const fmpz * p1;
+}
+_hensel_tree_arg_struct;
+
+static void
+_hensel_tree_worker(void * varg)
+{
+    _hensel_tree_arg_struct * arg = (_hensel_tree_arg_struct *) varg;
+
+    fmpz_poly_hensel_lift_tree_recursive(arg->link, arg->v, arg->w, arg->f,
+        arg->j, arg->inv, arg->p0, arg->p1);
+}
 
 void fmpz_poly_hensel_lift_tree_recursive(slong *link,
     fmpz_poly_t *v, fmpz_poly_t *w, fmpz_poly_t f, slong j, slong inv,
@@ -30,10 +59,37 @@ void fmpz_poly_hensel_lift_tree_recursive(slong *link,
                                                   v[j], v[j+1], w[j], w[j+1],
                                                   p0, p1);
 
-        fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j],
-            inv, p0, p1);
-        fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], link[j+1],
-            inv, p0, p1);
+        if (link[j] >= 0 && link[j + 1] >= 0 &&
+            FLINT_MIN(v[j]->length, v[j + 1]->length)
+                                    >= FMPZ_POLY_HENSEL_TREE_THREAD_CUTOFF &&
+            flint_get_num_threads() > 1)
+        {
+            _hensel_tree_arg_struct arg;
+            flint_task_t task;
+
+            arg.link = link;
+            arg.v = v;
+            arg.w = w;
+            arg.f = v[j];
+            arg.j = link[j];
+            arg.inv = inv;
+            arg.p0 = p0;
+            arg.p1 = p1;
+
+            flint_task_init(task, _hensel_tree_worker, &arg);
+            flint_task_spawn(task);
+
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], link[j+1],
+                inv, p0, p1);
+
+            flint_task_join(task);
+        }
+        else
+        {
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j],
+                inv, p0, p1);
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], link[j+1],
+                inv, p0, p1);
+        }
     }
 }
-
@@ -119,7 +119,7 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
     bits2 = FLINT_ABS(bits2);
 
 #ifdef FLINT_HAVE_FFT_SMALL
-    if (len2 >= 80 && (bits1 + bits2 <= 40 || bits1 + bits2 >= 128 || len2 >= 100))
+    if (len2 >= 80 && (bits1 + bits2 <= 40 || bits1 + bits2 >= 128 || len2 >= 100) && FFT_SMALL_AVAILABLE)
         if (_fmpz_poly_mul_mid_default_mpn_ctx(res, 0, len1 + len2 - 1, poly1, len1, poly2, len2))
             return;
 #endif
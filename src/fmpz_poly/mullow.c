@@ -133,7 +133,7 @@ _fmpz_poly_mullow(fmpz * res, const fmpz * poly1, slong len1,
     bits2 = FLINT_ABS(bits2);
 
 #ifdef FLINT_HAVE_FFT_SMALL
-    if (len2 >= 100 && (bits1 + bits2 <= 40 || bits1 + bits2 >= 128 || len2 >= 200))
+    if (len2 >= 100 && (bits1 + bits2 <= 40 || bits1 + bits2 >= 128 || len2 >= 200) && FFT_SMALL_AVAILABLE)
         if (_fmpz_poly_mul_mid_default_mpn_ctx(res, 0, n, poly1, len1, poly2, len2))
             return;
 #endif
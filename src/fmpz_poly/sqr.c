@@ -115,7 +115,7 @@ void _fmpz_poly_sqr(fmpz * res, const fmpz * poly, slong len)
     bits = FLINT_ABS(bits);
 
 #ifdef FLINT_HAVE_FFT_SMALL
-    if (len >= 80 && (bits + bits <= 40 || bits + bits >= 128 || len >= 160))
+    if (len >= 80 && (bits + bits <= 40 || bits + bits >= 128 || len >= 160) && FFT_SMALL_AVAILABLE)
         if (_fmpz_poly_mul_mid_default_mpn_ctx(res, 0, len + len - 1, poly, len, poly, len))
             return;
 #endif
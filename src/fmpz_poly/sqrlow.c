@@ -122,7 +122,7 @@ void _fmpz_poly_sqrlow(fmpz * res, const fmpz * poly, slong len, slong n)
     bits = FLINT_ABS(bits);
 
 #ifdef FLINT_HAVE_FFT_SMALL
-    if (len >= 100 && (bits + bits <= 40 || bits + bits >= 128 || len >= 240))
+    if (len >= 100 && (bits + bits <= 40 || bits + bits >= 128 || len >= 240) && FFT_SMALL_AVAILABLE)
         if (_fmpz_poly_mul_mid_default_mpn_ctx(res, 0, n, poly, len, poly, len))
             return;
 #endif
@@ -72,6 +72,7 @@
 #include "t-evaluate_horner_fmpz.c"
 #include "t-evaluate_mod.c"
 #include "t-fibonacci.c"
+#include "t-fwrite_fread_bin.c"
 #include "t-gcd.c"
 #include "t-gcd_heuristic.c"
 #include "t-gcd_modular.c"
@@ -249,6 +250,7 @@ test_struct tests[] =
     TEST_FUNCTION(fmpz_poly_evaluate_horner_fmpz),
     TEST_FUNCTION(fmpz_poly_evaluate_mod),
     TEST_FUNCTION(fmpz_poly_fibonacci),
+    TEST_FUNCTION(fmpz_poly_fwrite_fread_bin),
     TEST_FUNCTION(fmpz_poly_gcd),
     TEST_FUNCTION(fmpz_poly_gcd_heuristic),
     TEST_FUNCTION(fmpz_poly_gcd_modular),
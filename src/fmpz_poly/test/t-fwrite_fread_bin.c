@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "test_helpers.h"
+#include "bin_io.h"
+#include "fmpz_poly.h"
+
+TEST_FUNCTION_START(fmpz_poly_fwrite_fread_bin, state)
+{
+    slong iter;
+
+/* assume tmpfile() is broken on windows */
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_poly_t a, b;
+        FILE * tmp;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_randtest(a, state, n_randint(state, 50), 1 + n_randint(state, 300));
+        fmpz_poly_randtest(b, state, n_randint(state, 50), 1 + n_randint(state, 300));
+
+        tmp = tmpfile();
+        if (tmp == NULL)
+        {
+            flint_printf("FAIL (creating temporary file)\n");
+            flint_abort();
+        }
+
+        if (!fmpz_poly_fwrite_bin(tmp, a))
+        {
+            flint_printf("FAIL (write)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+
+        if (!fmpz_poly_fread_bin(tmp, b) || !fmpz_poly_equal(a, b))
+        {
+            flint_printf("FAIL (roundtrip)\n");
+            flint_printf("a = "); fmpz_poly_print(a); flint_printf("\n");
+            flint_printf("b = "); fmpz_poly_print(b); flint_printf("\n");
+            flint_abort();
+        }
+
+        fclose(tmp);
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+    }
+
+    /* sizes in a corrupt header must not be trusted */
+    {
+        mp_limb_t w[2] = { WORD_MAX, 0 };
+        FILE * tmp = tmpfile();
+        fmpz_poly_t b;
+
+        if (tmp == NULL || !flint_bin_fwrite_header(tmp, FLINT_BIN_FMPZ_POLY) ||
+            !flint_bin_fwrite_limbs(tmp, w, 2))
+        {
+            flint_printf("FAIL (writing corrupt header)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+        fmpz_poly_init(b);
+
+        if (fmpz_poly_fread_bin(tmp, b) || b->length != 0)
+        {
+            flint_printf("FAIL (corrupt header)\n");
+            flint_abort();
+        }
+
+        fmpz_poly_clear(b);
+        fclose(tmp);
+    }
+
+#endif
+
+    TEST_FUNCTION_END(state);
+}
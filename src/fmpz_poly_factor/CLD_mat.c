@@ -13,6 +13,7 @@
 #include "fmpz.h"
 #include "fmpz_poly.h"
 #include "fmpz_poly_factor.h"
+#include "thread_support.h"
 
 #ifdef __GNUC__
 # define sqrt __builtin_sqrt
@@ -20,6 +21,75 @@
 # include <math.h>
 #endif
 
+/*
+   The rows belonging to different lifted factors are independent, so they
+   are computed in parallel.
+*/
+
+typedef struct
+{
+   fmpz_mat_struct * res;
+   const fmpz_poly_struct * f;
+   const fmpz_poly_struct * trunc_f;
+   const fmpz_poly_struct * fac;
+   const fmpz * P;
+   slong lo_n;
+   slong hi_n;
+}
+_CLD_row_arg_t;
+
+static void
+_CLD_row_worker(slong i, void * varg)
+{
+   _CLD_row_arg_t * arg = (_CLD_row_arg_t *) varg;
+   const fmpz_poly_struct * g = arg->fac + i;
+   slong lo_n = arg->lo_n, hi_n = arg->hi_n;
+   fmpz * row = arg->res->rows[i];
+   fmpz_poly_t gd, gcld, temp;
+   fmpz_poly_t trunc_fac; /* don't initialise trunc_fac */
+
+   fmpz_poly_init(gd);
+   fmpz_poly_init(gcld);
+
+   if (lo_n > 0)
+   {
+      slong zeroes = 0;
+
+      while (fmpz_is_zero(g->coeffs + zeroes))
+         zeroes++;
+
+      fmpz_poly_attach_truncate(trunc_fac, g, lo_n + zeroes + 1);
+      fmpz_poly_derivative(gd, trunc_fac);
+      fmpz_poly_mullow(gcld, arg->f, gd, lo_n + zeroes);
+      fmpz_poly_divlow_smodp(row, gcld, trunc_fac, arg->P, lo_n);
+   }
+
+   if (hi_n > 0)
+   {
+      slong len = g->length - hi_n - 1;
+
+      if (len < 0)
+      {
+         fmpz_poly_init(temp);
+         fmpz_poly_shift_left(temp, g, -len);
+         fmpz_poly_derivative(gd, temp);
+         fmpz_poly_mulhigh_n(gcld, arg->trunc_f, gd, hi_n);
+         fmpz_poly_divhigh_smodp(row + lo_n, gcld, temp, arg->P, hi_n);
+         fmpz_poly_clear(temp);
+      } else
+      {
+         fmpz_poly_attach_shift(trunc_fac, g, len);
+         fmpz_poly_derivative(gd, trunc_fac);
+         fmpz_poly_mulhigh_n(gcld, arg->trunc_f, gd, hi_n);
+         fmpz_poly_divhigh_smodp(row + lo_n, gcld, trunc_fac, arg->P, hi_n);
+      }
+   }
+
+   /* do not clear trunc_fac */
+   fmpz_poly_clear(gd);
+   fmpz_poly_clear(gcld);
+}
+
 slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
                               fmpz_poly_factor_t lifted_fac, fmpz_t P, ulong k)
 {
@@ -31,10 +101,9 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
       initialised to be of size (r + 1, 2k).
    */
 
-   slong i, zeroes, bound, lo_n, hi_n, r = lifted_fac->num;
+   slong i, bound, lo_n, hi_n, r = lifted_fac->num;
    slong bit_r = FLINT_MAX(r, 20);
-   fmpz_poly_t gd, gcld, temp;
-   fmpz_poly_t trunc_f, trunc_fac; /* don't initialise trunc_f, trunc_fac */
+   fmpz_poly_t trunc_f; /* don't initialise trunc_f */
    fmpz_t t;
 
    /* insert CLD bounds in last row of matrix */
@@ -73,52 +142,22 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
 
    /* now insert data into matrix */
 
-   fmpz_poly_init(gd);
-   fmpz_poly_init(gcld);
-   /* do not initialise trunc_f */
-   /* do not initialise trunc_fac */
-
-   if (lo_n > 0)
+   if (lo_n + hi_n > 0)
    {
-      for (i = 0; i < r; i++)
-      {
-         zeroes = 0;
-         while (fmpz_is_zero(lifted_fac->p[i].coeffs + zeroes))
-            zeroes++;
+      _CLD_row_arg_t arg;
 
-         fmpz_poly_attach_truncate(trunc_fac, lifted_fac->p + i, lo_n + zeroes + 1);
-         fmpz_poly_derivative(gd, trunc_fac);
-         fmpz_poly_mullow(gcld, f, gd, lo_n + zeroes);
-         fmpz_poly_divlow_smodp(res->rows[i], gcld, trunc_fac, P, lo_n);
-      }
-   }
-
-   if (hi_n > 0)
-   {
-      fmpz_poly_init(temp);
+      if (hi_n > 0)
+         fmpz_poly_attach_shift(trunc_f, f, f->length - hi_n);
 
-      fmpz_poly_attach_shift(trunc_f, f, f->length - hi_n);
+      arg.res = res;
+      arg.f = f;
+      arg.trunc_f = trunc_f;
+      arg.fac = lifted_fac->p;
+      arg.P = P;
+      arg.lo_n = lo_n;
+      arg.hi_n = hi_n;
 
-      for (i = 0; i < r; i++)
-      {
-         slong len = lifted_fac->p[i].length - hi_n - 1;
-
-         if (len < 0)
-         {
-            fmpz_poly_shift_left(temp, lifted_fac->p + i, -len);
-            fmpz_poly_derivative(gd, temp);
-            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
-            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, temp, P, hi_n);
-         } else
-         {
-            fmpz_poly_attach_shift(trunc_fac, lifted_fac->p + i, len);
-            fmpz_poly_derivative(gd, trunc_fac);
-            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
-            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, trunc_fac, P, hi_n);
-         }
-      }
-
-      fmpz_poly_clear(temp);
+      flint_parallel_do(_CLD_row_worker, &arg, r, 0, FLINT_PARALLEL_DYNAMIC);
    }
 
    if (hi_n > 0)
@@ -128,10 +167,7 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
          fmpz_set(res->rows[r] + lo_n + i, res->rows[r] + 2*k - hi_n + i);
    }
 
-   /* do not clear trunc_fac */
    /* do not clear trunc_f */
-   fmpz_poly_clear(gd);
-   fmpz_poly_clear(gcld);
 
    return lo_n + hi_n;
 }
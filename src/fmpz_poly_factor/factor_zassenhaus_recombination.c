@@ -12,8 +12,10 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include <string.h>
 #include "fmpz_poly.h"
 #include "fmpz_poly_factor.h"
+#include "thread_support.h"
 
 static void _fmpz_poly_product(
     fmpz_poly_t res,
@@ -78,152 +80,168 @@ static void _fmpz_poly_product(
 }
 
 
-void fmpz_poly_factor_zassenhaus_recombination(
-    fmpz_poly_factor_t final_fac,
-	const fmpz_poly_factor_t lifted_fac,
-    const fmpz_poly_t F,
-    const fmpz_t P,
-    slong exp)
-{
-    const slong r = lifted_fac->num;
-    slong * subset;
-    slong k, len;
-    fmpz_poly_t Fcopy, Q, tryme;
-    fmpz_poly_struct * tmp;
-    fmpz_poly_struct ** stack;
-    fmpz_poly_struct * f;
-
-    subset = (slong *) flint_malloc(r*sizeof(slong));
-    for (k = 0; k < r; k++)
-        subset[k] = k;
-
-    stack = (fmpz_poly_struct **) flint_malloc(r*sizeof(fmpz_poly_struct *));
-
-    tmp = (fmpz_poly_struct *) flint_malloc(r*sizeof(fmpz_poly_struct));
-    for (k = 0; k < r; k++)
-        fmpz_poly_init(tmp + k);
-
-    fmpz_poly_init(Q);
-    fmpz_poly_init(tryme);
-    fmpz_poly_init(Fcopy);
+/*
+    Candidate subsets are tried in batches. The trial divisions of a batch
+    are spread over the threads, each thread using its own workspace for
+    the products. The results are then scanned in enumeration order and
+    the first factor found is accepted, exactly as in the sequential loop;
+    the candidates following it in the batch are discarded since f has
+    changed. The factors found therefore do not depend on the number of
+    threads.
+*/
 
-    f = (fmpz_poly_struct *) F;
+typedef struct
+{
+    const fmpz_poly_struct * lifted_fac;
+    const fmpz_poly_struct * f;
+    const fmpz * P;
+    const slong * subsets;
+    fmpz_poly_struct * tryme;
+    fmpz_poly_struct * Q;
+    int * found;
+    fmpz_poly_struct *** stack;
+    fmpz_poly_struct ** tmp;
+    slong len;
+    slong r;
+    slong num;
+    slong num_workers;
+}
+_recombination_arg_t;
 
-    len = r;
-    for (k = 1; k <= len/2; k++)
-    {
-        zassenhaus_subset_first(subset, len, k);
-        while (1)
-        {
-            _fmpz_poly_product(tryme, lifted_fac->p, subset, len, P,
-                                                fmpz_poly_lead(f), stack, tmp);
-            fmpz_poly_primitive_part(tryme, tryme);
-            if (fmpz_poly_divides(Q, f, tryme))
-            {
-                fmpz_poly_factor_insert(final_fac, tryme, exp);
-                f = Fcopy;  /* make sure f is writeable */
-                fmpz_poly_swap(f, Q);
-                len -= k;
-                if (!zassenhaus_subset_next_disjoint(subset, len + k))
-                    break;
-            }
-            else
-            {
-                if (!zassenhaus_subset_next(subset, len))
-                    break;
-            }
-        }
-    }
+static void
+_recombination_worker(slong i, void * varg)
+{
+    _recombination_arg_t * arg = (_recombination_arg_t *) varg;
+    slong b;
 
-    if (fmpz_poly_degree(f) > 0)
-    {
-        fmpz_poly_factor_insert(final_fac, f, exp);
-    }
-    else
+    for (b = i; b < arg->num; b += arg->num_workers)
     {
-        FLINT_ASSERT(fmpz_poly_is_one(f));
+        _fmpz_poly_product(arg->tryme + b, arg->lifted_fac,
+                           arg->subsets + b*arg->r, arg->len, arg->P,
+                           fmpz_poly_lead(arg->f), arg->stack[i], arg->tmp[i]);
+        fmpz_poly_primitive_part(arg->tryme + b, arg->tryme + b);
+        arg->found[b] = fmpz_poly_divides(arg->Q + b, arg->f, arg->tryme + b);
     }
-
-    fmpz_poly_clear(Fcopy);
-    fmpz_poly_clear(tryme);
-    fmpz_poly_clear(Q);
-
-    flint_free(stack);
-
-    for (k = 0; k < r; k++)
-        fmpz_poly_clear(tmp + k);
-    flint_free(tmp);
-
-    flint_free(subset);
 }
 
-
-void fmpz_poly_factor_zassenhaus_recombination_with_prune(
+static void _fmpz_poly_factor_zassenhaus_recombination(
     fmpz_poly_factor_t final_fac,
     const fmpz_poly_factor_t lifted_fac,
     const fmpz_poly_t F,
     const fmpz_t P,
     slong exp,
-    const zassenhaus_prune_t Z)
+    const zassenhaus_prune_struct * Z)
 {
     const slong r = lifted_fac->num;
-    slong * subset;
-    slong i, k, len, total;
-    fmpz_poly_t Fcopy, Q, tryme;
-    fmpz_poly_struct * tmp;
-    fmpz_poly_struct ** stack;
+    slong * subset, * subsets;
+    slong b, i, k, len, total, num, num_workers, batch;
+    int more, * found;
+    fmpz_poly_t Fcopy;
+    fmpz_poly_struct * tryme, * Q;
+    fmpz_poly_struct ** tmp;
+    fmpz_poly_struct *** stack;
     fmpz_poly_struct * f;
+    _recombination_arg_t arg;
+
+    num_workers = flint_get_num_threads();
+    batch = (num_workers > 1) ? 4*num_workers : 1;
 
     subset = (slong *) flint_malloc(r*sizeof(slong));
     for (k = 0; k < r; k++)
         subset[k] = k;
 
-    stack = (fmpz_poly_struct **) flint_malloc(r*sizeof(fmpz_poly_struct *));
+    subsets = (slong *) flint_malloc(batch*r*sizeof(slong));
+    found = (int *) flint_malloc(batch*sizeof(int));
 
-    tmp = (fmpz_poly_struct *) flint_malloc(r*sizeof(fmpz_poly_struct));
-    for (k = 0; k < r; k++)
-        fmpz_poly_init(tmp + k);
+    tryme = (fmpz_poly_struct *) flint_malloc(batch*sizeof(fmpz_poly_struct));
+    Q = (fmpz_poly_struct *) flint_malloc(batch*sizeof(fmpz_poly_struct));
+    for (b = 0; b < batch; b++)
+    {
+        fmpz_poly_init(tryme + b);
+        fmpz_poly_init(Q + b);
+    }
+
+    stack = (fmpz_poly_struct ***) flint_malloc(
+                                num_workers*sizeof(fmpz_poly_struct **));
+    tmp = (fmpz_poly_struct **) flint_malloc(
+                                num_workers*sizeof(fmpz_poly_struct *));
+    for (i = 0; i < num_workers; i++)
+    {
+        stack[i] = (fmpz_poly_struct **) flint_malloc(
+                                        r*sizeof(fmpz_poly_struct *));
+        tmp[i] = (fmpz_poly_struct *) flint_malloc(
+                                        r*sizeof(fmpz_poly_struct));
+        for (k = 0; k < r; k++)
+            fmpz_poly_init(tmp[i] + k);
+    }
 
-    fmpz_poly_init(Q);
-    fmpz_poly_init(tryme);
     fmpz_poly_init(Fcopy);
 
     f = (fmpz_poly_struct *) F;
 
+    arg.lifted_fac = lifted_fac->p;
+    arg.P = P;
+    arg.subsets = subsets;
+    arg.tryme = tryme;
+    arg.Q = Q;
+    arg.found = found;
+    arg.stack = stack;
+    arg.tmp = tmp;
+    arg.r = r;
+
     len = r;
     for (k = 1; k <= len/2; k++)
     {
         zassenhaus_subset_first(subset, len, k);
-        while (1)
+        more = 1;
+        while (more)
         {
-            total = 0;
-            for (i = 0; i < len; i++)
-                if (subset[i] >= 0)
-                    total += fmpz_poly_degree(lifted_fac->p + subset[i]);
-
-            if (!zassenhaus_prune_degree_is_possible(Z, total))
+            /* collect the next batch of candidates */
+            num = 0;
+            while (num < batch && more)
             {
-                if (!zassenhaus_subset_next(subset, len))
-                    break;
-                continue;
+                if (Z != NULL)
+                {
+                    total = 0;
+                    for (i = 0; i < len; i++)
+                        if (subset[i] >= 0)
+                            total += fmpz_poly_degree(lifted_fac->p + subset[i]);
+
+                    if (!zassenhaus_prune_degree_is_possible(Z, total))
+                    {
+                        more = zassenhaus_subset_next(subset, len);
+                        continue;
+                    }
+                }
+
+                memcpy(subsets + num*r, subset, len*sizeof(slong));
+                num++;
+                more = zassenhaus_subset_next(subset, len);
             }
 
-            _fmpz_poly_product(tryme, lifted_fac->p, subset, len, P,
-                                                fmpz_poly_lead(f), stack, tmp);
-            fmpz_poly_primitive_part(tryme, tryme);
-            if (fmpz_poly_divides(Q, f, tryme))
-            {
-                fmpz_poly_factor_insert(final_fac, tryme, exp);
-                f = Fcopy;  /* make sure f is writeable */
-                fmpz_poly_swap(f, Q);
-                len -= k;
-                if (!zassenhaus_subset_next_disjoint(subset, len + k))
-                    break;
-            }
-            else
+            if (num == 0)
+                break;
+
+            arg.f = f;
+            arg.len = len;
+            arg.num = num;
+            arg.num_workers = FLINT_MIN(num_workers, num);
+
+            flint_parallel_do(_recombination_worker, &arg, arg.num_workers,
+                                    arg.num_workers, FLINT_PARALLEL_UNIFORM);
+
+            for (b = 0; b < num; b++)
             {
-                if (!zassenhaus_subset_next(subset, len))
+                if (found[b])
+                {
+                    fmpz_poly_factor_insert(final_fac, tryme + b, exp);
+                    f = Fcopy;  /* make sure f is writeable */
+                    fmpz_poly_swap(f, Q + b);
+                    memcpy(subset, subsets + b*r, len*sizeof(slong));
+                    len -= k;
+                    more = zassenhaus_subset_next_disjoint(subset, len + k);
                     break;
+                }
             }
         }
     }
@@ -238,15 +256,49 @@ void fmpz_poly_factor_zassenhaus_recombination_with_prune(
     }
 
     fmpz_poly_clear(Fcopy);
-    fmpz_poly_clear(tryme);
-    fmpz_poly_clear(Q);
 
+    for (i = 0; i < num_workers; i++)
+    {
+        for (k = 0; k < r; k++)
+            fmpz_poly_clear(tmp[i] + k);
+        flint_free(tmp[i]);
+        flint_free(stack[i]);
+    }
+    flint_free(tmp);
     flint_free(stack);
 
-    for (k = 0; k < r; k++)
-        fmpz_poly_clear(tmp + k);
-    flint_free(tmp);
+    for (b = 0; b < batch; b++)
+    {
+        fmpz_poly_clear(tryme + b);
+        fmpz_poly_clear(Q + b);
+    }
+    flint_free(Q);
+    flint_free(tryme);
 
+    flint_free(found);
+    flint_free(subsets);
     flint_free(subset);
 }
 
+void fmpz_poly_factor_zassenhaus_recombination(
+    fmpz_poly_factor_t final_fac,
+	const fmpz_poly_factor_t lifted_fac,
+    const fmpz_poly_t F,
+    const fmpz_t P,
+    slong exp)
+{
+    _fmpz_poly_factor_zassenhaus_recombination(final_fac, lifted_fac,
+                                                        F, P, exp, NULL);
+}
+
+void fmpz_poly_factor_zassenhaus_recombination_with_prune(
+    fmpz_poly_factor_t final_fac,
+    const fmpz_poly_factor_t lifted_fac,
+    const fmpz_poly_t F,
+    const fmpz_t P,
+    slong exp,
+    const zassenhaus_prune_t Z)
+{
+    _fmpz_poly_factor_zassenhaus_recombination(final_fac, lifted_fac,
+                                                        F, P, exp, Z);
+}
@@ -17,6 +17,7 @@
 #include "t-factor.c"
 #include "t-factor_cubic.c"
 #include "t-factor_squarefree.c"
+#include "t-factor_threaded.c"
 #include "t-factor_zassenhaus.c"
 #include "t-zassenhaus_subset.c"
 
@@ -27,6 +28,7 @@ test_struct tests[] =
     TEST_FUNCTION(fmpz_poly_factor),
     TEST_FUNCTION(fmpz_poly_factor_cubic),
     TEST_FUNCTION(fmpz_poly_factor_squarefree),
+    TEST_FUNCTION(fmpz_poly_factor_threaded),
     TEST_FUNCTION(fmpz_poly_factor_zassenhaus),
     TEST_FUNCTION(fmpz_poly_factor_zassenhaus_subset)
 };
@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "test_helpers.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpz_poly_factor.h"
+
+static int
+_factors_equal(const fmpz_poly_factor_t a, const fmpz_poly_factor_t b)
+{
+    slong i;
+
+    if (a->num != b->num || !fmpz_equal(&a->c, &b->c))
+        return 0;
+
+    for (i = 0; i < a->num; i++)
+        if (a->exp[i] != b->exp[i] || !fmpz_poly_equal(a->p + i, b->p + i))
+            return 0;
+
+    return 1;
+}
+
+TEST_FUNCTION_START(fmpz_poly_factor_threaded, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 30 * flint_test_multiplier(); iter++)
+    {
+        fmpz_poly_t f, g, h;
+        fmpz_poly_factor_t fac1, fac2;
+        slong j, n, deg;
+        int zassenhaus;
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(h);
+        fmpz_poly_factor_init(fac1);
+        fmpz_poly_factor_init(fac2);
+
+        /* polynomials of the form g(x^k) tend to have many local factors,
+           which gives deep Hensel trees and nontrivial recombination */
+        n = 1 + n_randint(state, 4);
+        fmpz_poly_one(f);
+        for (j = 0; j < n; j++)
+        {
+            deg = 1 + n_randint(state, 6);
+
+            do {
+                fmpz_poly_randtest(g, state, deg + 1, 1 + n_randint(state, 20));
+            } while (fmpz_poly_degree(g) < 1);
+
+            fmpz_poly_zero(h);
+            fmpz_poly_set_coeff_ui(h, 1 + n_randint(state, 8), 1);
+            fmpz_poly_compose(g, g, h);
+            fmpz_poly_mul(f, f, g);
+        }
+
+        zassenhaus = n_randint(state, 2);
+
+        flint_set_num_threads(1);
+        if (zassenhaus)
+            fmpz_poly_factor_zassenhaus(fac1, f);
+        else
+            fmpz_poly_factor(fac1, f);
+
+        flint_set_num_threads(2 + n_randint(state, 4));
+        if (zassenhaus)
+            fmpz_poly_factor_zassenhaus(fac2, f);
+        else
+            fmpz_poly_factor(fac2, f);
+
+        if (!_factors_equal(fac1, fac2))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("threads = %d, zassenhaus = %d\n",
+                                        flint_get_num_threads(), zassenhaus);
+            flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n\n");
+            flint_printf("fac1 = "), fmpz_poly_factor_print(fac1), flint_printf("\n\n");
+            flint_printf("fac2 = "), fmpz_poly_factor_print(fac2), flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(h);
+        fmpz_poly_factor_clear(fac1);
+        fmpz_poly_factor_clear(fac2);
+    }
+
+    flint_set_num_threads(1);
+
+    TEST_FUNCTION_END(state);
+}
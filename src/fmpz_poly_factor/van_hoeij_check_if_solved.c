@@ -16,6 +16,52 @@
 #include "fmpz_mat.h"
 #include "fmpz_poly.h"
 #include "fmpz_poly_factor.h"
+#include "thread_support.h"
+
+/*
+   The potential factors are products of disjoint sets of local factors, so
+   once they are primitive any two of them are coprime. Hence they all
+   divide f as soon as each of them divides f, and these trial divisions
+   can be done independently of each other.
+*/
+
+typedef struct
+{
+   const fmpz_poly_struct * f;
+   const nmod_poly_struct * f2;
+   const fmpz_poly_struct * g;
+   volatile int * failed;
+}
+_trial_div_arg_t;
+
+static void
+_trial_div_worker(slong i, void * varg)
+{
+   _trial_div_arg_t * arg = (_trial_div_arg_t *) varg;
+   nmod_poly_t g2, rem;
+   fmpz_poly_t q;
+   int ok;
+
+   if (*arg->failed)
+      return;
+
+   nmod_poly_init(g2, 2);
+   nmod_poly_init(rem, 2);
+   fmpz_poly_init(q);
+
+   /* check if the polynomial divides mod 2 */
+   fmpz_poly_get_nmod_poly(g2, arg->g + i);
+   nmod_poly_rem(rem, arg->f2, g2);
+
+   ok = nmod_poly_is_zero(rem) && fmpz_poly_divides(q, arg->f, arg->g + i);
+
+   if (!ok)
+      *arg->failed = 1;
+
+   fmpz_poly_clear(q);
+   nmod_poly_clear(g2);
+   nmod_poly_clear(rem);
+}
 
 int _compare_poly_lengths(const void * a, const void * b)
 {
@@ -100,20 +146,47 @@ int fmpz_poly_factor_van_hoeij_check_if_solved(fmpz_mat_t M,
 
    fmpz_poly_set(f_copy, f);
 
-   for (i = 0; i < trial_factors->num && num_facs > 1; i++)
+   if (num_facs > 2 && trial_factors->num == num_facs &&
+       flint_get_num_threads() > 1)
    {
-      /* check if the polynomial divides mod 2 */
-      fmpz_poly_get_nmod_poly(f2, f_copy);
-      fmpz_poly_get_nmod_poly(g2, trial_factors->p + i);
+      _trial_div_arg_t arg;
+      volatile int failed = 0;
 
-      nmod_poly_rem(rem, f2, g2);
+      fmpz_poly_get_nmod_poly(f2, f);
 
-      if (nmod_poly_is_zero(rem) && fmpz_poly_divides(q, f_copy, trial_factors->p + i))
-      {
-         fmpz_poly_swap(q, f_copy);
-         num_facs--;
-      } else
+      arg.f = f;
+      arg.f2 = f2;
+      arg.g = trial_factors->p;
+      arg.failed = &failed;
+
+      flint_parallel_do(_trial_div_worker, &arg, num_facs - 1, 0,
+                                                FLINT_PARALLEL_DYNAMIC);
+
+      if (failed)
          goto cleanup;
+
+      for (i = 0; i < num_facs - 1; i++)
+         fmpz_poly_div(f_copy, f_copy, trial_factors->p + i);
+
+      num_facs = 1;
+   }
+   else
+   {
+      for (i = 0; i < trial_factors->num && num_facs > 1; i++)
+      {
+         /* check if the polynomial divides mod 2 */
+         fmpz_poly_get_nmod_poly(f2, f_copy);
+         fmpz_poly_get_nmod_poly(g2, trial_factors->p + i);
+
+         nmod_poly_rem(rem, f2, g2);
+
+         if (nmod_poly_is_zero(rem) && fmpz_poly_divides(q, f_copy, trial_factors->p + i))
+         {
+            fmpz_poly_swap(q, f_copy);
+            num_facs--;
+         } else
+            goto cleanup;
+      }
    }
 
    /* if we found all the factors, insert them */
@@ -102,6 +102,9 @@ slong _fmpz_vec_height_index(const fmpz * vec, slong len);
 int _fmpz_vec_fprint(FILE * file, const fmpz * vec, slong len);
 
 int _fmpz_vec_fread(FILE * file, fmpz ** vec, slong * len);
+
+int _fmpz_vec_fwrite_bin(FILE * file, const fmpz * vec, slong len);
+int _fmpz_vec_fread_bin(FILE * file, fmpz ** vec, slong * len);
 #endif
 
 int _fmpz_vec_print(const fmpz * vec, slong len);
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "bin_io.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+int
+_fmpz_vec_fwrite_bin(FILE * file, const fmpz * vec, slong len)
+{
+    mp_limb_t w = len;
+    slong i;
+
+    if (!flint_bin_fwrite_header(file, FLINT_BIN_FMPZ_VEC) ||
+        !flint_bin_fwrite_limbs(file, &w, 1))
+        return 0;
+
+    for (i = 0; i < len; i++)
+        if (!_fmpz_fwrite_bin(file, vec + i))
+            return 0;
+
+    return 1;
+}
+
+int
+_fmpz_vec_fread_bin(FILE * file, fmpz ** vec, slong * len)
+{
+    mp_limb_t w;
+    slong i, n, alloc_len;
+    int alloc, swap;
+
+    alloc = (*vec == NULL);
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_FMPZ_VEC, &swap) ||
+        !flint_bin_fread_limbs(file, &w, 1, swap) || (slong) w < 0)
+    {
+        if (alloc)
+            *len = 0;
+        return 0;
+    }
+
+    n = w;
+    alloc_len = n;
+
+    if (alloc)
+    {
+        /* n comes from the stream, so only grow the vector as the data
+           arrives */
+        alloc_len = FLINT_MIN(n, FLINT_BIN_READ_CHUNK);
+        *vec = _fmpz_vec_init(alloc_len);
+    }
+    else if (*len != n)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        if (i == alloc_len)
+        {
+            slong new_len = FLINT_MIN(n, 2 * alloc_len);
+
+            *vec = flint_realloc(*vec, new_len * sizeof(fmpz));
+            _fmpz_vec_zero((*vec) + alloc_len, new_len - alloc_len);
+            alloc_len = new_len;
+        }
+
+        if (!_fmpz_fread_bin(file, (*vec) + i, swap))
+        {
+            if (alloc)
+            {
+                _fmpz_vec_clear(*vec, alloc_len);
+                *vec = NULL;
+                *len = 0;
+            }
+            return 0;
+        }
+    }
+
+    if (alloc)
+        *len = n;
+
+    return 1;
+}
@@ -0,0 +1,101 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "test_helpers.h"
+#include "bin_io.h"
+#include "fmpz_vec.h"
+
+TEST_FUNCTION_START(fmpz_vec_fwrite_fread_bin, state)
+{
+    slong iter;
+
+/* assume tmpfile() is broken on windows */
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz * a, * b, * c;
+        slong len, blen, clen;
+        FILE * tmp;
+
+        len = n_randint(state, 50);
+        a = _fmpz_vec_init(len);
+        _fmpz_vec_randtest(a, state, len, 1 + n_randint(state, 300));
+
+        tmp = tmpfile();
+        if (tmp == NULL)
+        {
+            flint_printf("FAIL (creating temporary file)\n");
+            flint_abort();
+        }
+
+        if (!_fmpz_vec_fwrite_bin(tmp, a, len) || !_fmpz_vec_fwrite_bin(tmp, a, len))
+        {
+            flint_printf("FAIL (write)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+
+        /* allocated by the reader */
+        b = NULL;
+        if (!_fmpz_vec_fread_bin(tmp, &b, &blen) || blen != len || !_fmpz_vec_equal(a, b, len))
+        {
+            flint_printf("FAIL (roundtrip, allocating)\n");
+            flint_abort();
+        }
+
+        /* into an existing vector of the right length */
+        clen = len;
+        c = _fmpz_vec_init(clen);
+        if (!_fmpz_vec_fread_bin(tmp, &c, &clen) || !_fmpz_vec_equal(a, c, len))
+        {
+            flint_printf("FAIL (roundtrip)\n");
+            flint_abort();
+        }
+
+        fclose(tmp);
+
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(b, blen);
+        _fmpz_vec_clear(c, clen);
+    }
+
+    /* sizes in a corrupt header must not be trusted */
+    {
+        mp_limb_t w[2] = { WORD_MAX, 0 };
+        FILE * tmp = tmpfile();
+        fmpz * b = NULL;
+        slong blen;
+
+        if (tmp == NULL || !flint_bin_fwrite_header(tmp, FLINT_BIN_FMPZ_VEC) ||
+            !flint_bin_fwrite_limbs(tmp, w, 2))
+        {
+            flint_printf("FAIL (writing corrupt header)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+
+        if (_fmpz_vec_fread_bin(tmp, &b, &blen) || b != NULL || blen != 0)
+        {
+            flint_printf("FAIL (corrupt header)\n");
+            flint_abort();
+        }
+
+        fclose(tmp);
+    }
+
+#endif
+
+    TEST_FUNCTION_END(state);
+}
@@ -29,8 +29,19 @@
 /* Cutoff between classical and recursive LU decomposition */
 #define FQ_NMOD_MAT_LU_RECURSIVE_CUTOFF 4
 
+/* Dimension above which fq_nmod_mat_mul uses fq_nmod_mat_mul_slices */
+#define FQ_NMOD_MAT_MUL_SLICES_CUTOFF 10
+
 int FQ_NMOD_MAT_MUL_KS_CUTOFF(slong r, slong c, const fq_nmod_ctx_t ctx);
 
+/* Multiplication via products of coefficient slices over Z/pZ */
+mp_limb_t _fq_nmod_mat_mul_slices_modulus(slong k, const fq_nmod_ctx_t ctx);
+void _fq_nmod_mat_mul_slices(nmod_mat_t X, const nmod_mat_t SA,
+                             const nmod_mat_t SB, slong ar, slong br, slong bc,
+                             const fq_nmod_ctx_t ctx);
+void fq_nmod_mat_mul_slices(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                            const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx);
+
 #define T fq_nmod
 #define CAP_T FQ_NMOD
 #include "fq_mat_templates.h"
@@ -0,0 +1,305 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "fq_nmod.h"
+#include "fq_nmod_mat.h"
+
+/*
+    Write A = sum_i A_i x^i and B = sum_j B_j x^j with A_i, B_j matrices over
+    Z/pZ, and work modulo a word-size prime P. The slices are evaluated at
+    the points 0, 1, ..., 2d - 2 (a product of two nmod_mats with a
+    Vandermonde matrix), multiplied pointwise with nmod_mat_mul, and the
+    coefficients C_k of C = sum_k C_k x^k are recovered by a product with
+    the inverse Vandermonde matrix. Reduction modulo the defining polynomial
+    is linear in the C_k, so it is done once at the end as a product with
+    the d x (2d - 1) matrix of the x^t mod f.
+
+    If p >= 2d - 1 we can take P = p, and interpolation and reduction
+    collapse into one matrix. Otherwise the C_k are computed exactly over Z,
+    which needs P > d k (p - 1)^2 where k is the inner dimension.
+    Returns 0 if no such P fits in a word.
+*/
+
+mp_limb_t
+_fq_nmod_mat_mul_slices_modulus(slong k, const fq_nmod_ctx_t ctx)
+{
+    slong d = fq_nmod_ctx_degree(ctx);
+    mp_limb_t p = ctx->mod.n, hi, lo;
+
+    if (p >= 2 * (mp_limb_t) d - 1)
+        return p;
+
+    umul_ppmm(hi, lo, p - 1, p - 1);
+    if (hi != 0)
+        return 0;
+    umul_ppmm(hi, lo, lo, (mp_limb_t) d * (mp_limb_t) k);
+    if (hi != 0 || lo >= (UWORD(1) << (FLINT_BITS - 2)))
+        return 0;
+
+    return n_nextprime(FLINT_MAX(lo, 2 * (mp_limb_t) d), 1);
+}
+
+/* Makes M an r x c matrix whose rows are consecutive in the buffer data */
+static void
+_nmod_mat_view_init(nmod_mat_t M, mp_ptr data, slong r, slong c, nmod_t mod)
+{
+    slong i;
+
+    M->entries = data;
+    M->r = r;
+    M->c = c;
+    M->rows = flint_malloc(FLINT_MAX(r, 1) * sizeof(mp_ptr));
+    for (i = 0; i < r; i++)
+        M->rows[i] = data + i * c;
+    M->mod = mod;
+}
+
+static void
+_nmod_mat_view_clear(nmod_mat_t M)
+{
+    flint_free(M->rows);
+}
+
+/*
+    Sets W to the inverse of the Vandermonde matrix of the points
+    0, 1, ..., m - 1, that is, column j of W holds the coefficients of the
+    Lagrange basis polynomial L_j(x) = prod_{l != j} (x - l) / (j - l).
+*/
+static void
+_nmod_mat_vandermonde_inv(nmod_mat_t W, nmod_t mod)
+{
+    slong i, j, t, m = W->r;
+    mp_ptr M, q;
+    mp_limb_t w;
+
+    M = _nmod_vec_init(m + 1);
+    q = _nmod_vec_init(m);
+
+    /* M = prod_j (x - j) */
+    M[0] = 1;
+    for (j = 0; j < m; j++)
+    {
+        M[j + 1] = M[j];
+        for (i = j; i > 0; i--)
+            M[i] = nmod_sub(M[i - 1], nmod_mul(M[i], j, mod), mod);
+        M[0] = nmod_neg(nmod_mul(M[0], j, mod), mod);
+    }
+
+    for (j = 0; j < m; j++)
+    {
+        /* q = M / (x - j) and w = q(j) */
+        q[m - 1] = M[m];
+        w = q[m - 1];
+        for (t = m - 1; t > 0; t--)
+        {
+            q[t - 1] = nmod_add(M[t], nmod_mul(q[t], j, mod), mod);
+            w = nmod_add(q[t - 1], nmod_mul(w, j, mod), mod);
+        }
+
+        w = nmod_inv(w, mod);
+        for (t = 0; t < m; t++)
+            nmod_mat_entry(W, t, j) = nmod_mul(q[t], w, mod);
+    }
+
+    _nmod_vec_clear(M);
+    _nmod_vec_clear(q);
+}
+
+/* Sets W to the d x m matrix whose column t is x^t modulo the defining
+   polynomial */
+static void
+_fq_nmod_reduction_matrix(nmod_mat_t W, const fq_nmod_ctx_t ctx)
+{
+    slong d = W->r, m = W->c;
+    slong i, k, t;
+    mp_limb_t h;
+
+    for (t = 0; t < FLINT_MIN(d, m); t++)
+        nmod_mat_entry(W, t, t) = 1;
+
+    for (t = d; t < m; t++)
+    {
+        h = nmod_mat_entry(W, d - 1, t - 1);
+
+        for (i = d - 1; i > 0; i--)
+            nmod_mat_entry(W, i, t) = nmod_mat_entry(W, i - 1, t - 1);
+        nmod_mat_entry(W, 0, t) = 0;
+
+        for (k = 0; k < ctx->len - 1; k++)
+            nmod_mat_entry(W, ctx->j[k], t) = nmod_sub(nmod_mat_entry(W,
+                ctx->j[k], t), nmod_mul(h, ctx->a[k], ctx->mod), ctx->mod);
+    }
+}
+
+void
+_fq_nmod_mat_mul_slices(nmod_mat_t X, const nmod_mat_t SA,
+                        const nmod_mat_t SB, slong ar, slong br, slong bc,
+                        const fq_nmod_ctx_t ctx)
+{
+    slong d = SA->r;
+    slong m = 2 * d - 1;
+    slong j, t;
+    mp_limb_t x;
+    nmod_t mod = SA->mod;
+    nmod_mat_t V, W, Vinv, EA, EB, PC, Aj, Bj, Cj;
+
+    /* Vandermonde matrix at 0, 1, ..., m - 1 */
+    nmod_mat_init(V, m, d, mod.n);
+    for (j = 0; j < m; j++)
+    {
+        x = 1;
+        for (t = 0; t < d; t++)
+        {
+            nmod_mat_entry(V, j, t) = x;
+            x = nmod_mul(x, j, mod);
+        }
+    }
+
+    /* evaluate */
+    nmod_mat_init(EA, m, ar * br, mod.n);
+    nmod_mat_init(EB, m, br * bc, mod.n);
+    nmod_mat_mul(EA, V, SA);
+    nmod_mat_mul(EB, V, SB);
+    nmod_mat_clear(V);
+
+    /* pointwise products */
+    nmod_mat_init(PC, m, ar * bc, mod.n);
+    for (j = 0; j < m; j++)
+    {
+        _nmod_mat_view_init(Aj, nmod_mat_entry_ptr(EA, j, 0), ar, br, mod);
+        _nmod_mat_view_init(Bj, nmod_mat_entry_ptr(EB, j, 0), br, bc, mod);
+        _nmod_mat_view_init(Cj, nmod_mat_entry_ptr(PC, j, 0), ar, bc, mod);
+        nmod_mat_mul(Cj, Aj, Bj);
+        _nmod_mat_view_clear(Aj);
+        _nmod_mat_view_clear(Bj);
+        _nmod_mat_view_clear(Cj);
+    }
+    nmod_mat_clear(EA);
+    nmod_mat_clear(EB);
+
+    nmod_mat_init(Vinv, m, m, mod.n);
+    _nmod_mat_vandermonde_inv(Vinv, mod);
+    nmod_mat_init(W, d, m, ctx->mod.n);
+    _fq_nmod_reduction_matrix(W, ctx);
+
+    if (mod.n == ctx->mod.n)
+    {
+        /* interpolation and reduction as a single d x m matrix */
+        nmod_mat_t M;
+        nmod_mat_init(M, d, m, mod.n);
+        nmod_mat_mul(M, W, Vinv);
+        nmod_mat_mul(X, M, PC);
+        nmod_mat_clear(M);
+    }
+    else
+    {
+        /* the interpolated coefficients are exact over Z */
+        nmod_mat_t CK;
+        nmod_mat_init(CK, m, ar * bc, mod.n);
+        nmod_mat_mul(CK, Vinv, PC);
+        _nmod_vec_reduce(CK->entries, CK->entries, m * ar * bc, ctx->mod);
+        CK->mod = ctx->mod;
+        nmod_mat_mul(X, W, CK);
+        nmod_mat_clear(CK);
+    }
+
+    nmod_mat_clear(Vinv);
+    nmod_mat_clear(W);
+    nmod_mat_clear(PC);
+}
+
+void
+fq_nmod_mat_mul_slices(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                       const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    slong ar = A->r, br = B->r, bc = B->c;
+    slong d = fq_nmod_ctx_degree(ctx);
+    slong i, j, t;
+    mp_limb_t P;
+    nmod_mat_t SA, SB, X;
+
+    if (C == A || C == B)
+    {
+        fq_nmod_mat_t T;
+        fq_nmod_mat_init(T, ar, bc, ctx);
+        fq_nmod_mat_mul_slices(T, A, B, ctx);
+        fq_nmod_mat_swap_entrywise(T, C, ctx);
+        fq_nmod_mat_clear(T, ctx);
+        return;
+    }
+
+    if (ar == 0 || bc == 0)
+        return;
+
+    if (br == 0)
+    {
+        fq_nmod_mat_zero(C, ctx);
+        return;
+    }
+
+    P = _fq_nmod_mat_mul_slices_modulus(br, ctx);
+
+    if (P == 0)
+    {
+        fq_nmod_mat_mul_KS(C, A, B, ctx);
+        return;
+    }
+
+    /* row t of SA holds the coefficients of x^t of the entries of A */
+    nmod_mat_init(SA, d, ar * br, P);
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < br; j++)
+        {
+            const fq_nmod_struct * a = fq_nmod_mat_entry(A, i, j);
+
+            for (t = 0; t < a->length; t++)
+                nmod_mat_entry(SA, t, i * br + j) = a->coeffs[t];
+        }
+    }
+
+    nmod_mat_init(SB, d, br * bc, P);
+    for (i = 0; i < br; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            const fq_nmod_struct * b = fq_nmod_mat_entry(B, i, j);
+
+            for (t = 0; t < b->length; t++)
+                nmod_mat_entry(SB, t, i * bc + j) = b->coeffs[t];
+        }
+    }
+
+    nmod_mat_init(X, d, ar * bc, ctx->mod.n);
+    _fq_nmod_mat_mul_slices(X, SA, SB, ar, br, bc, ctx);
+    nmod_mat_clear(SA);
+    nmod_mat_clear(SB);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            fq_nmod_struct * c = fq_nmod_mat_entry(C, i, j);
+
+            nmod_poly_fit_length(c, d);
+            for (t = 0; t < d; t++)
+                c->coeffs[t] = nmod_mat_entry(X, t, i * bc + j);
+            _nmod_poly_set_length(c, d);
+            _nmod_poly_normalise(c);
+        }
+    }
+
+    nmod_mat_clear(X);
+}
@@ -28,6 +28,7 @@
 #include "t-minpoly.c"
 #include "t-mul.c"
 #include "t-mul_KS.c"
+#include "t-mul_slices.c"
 #include "t-mul_vec.c"
 #include "t-nullspace.c"
 #include "t-one.c"
@@ -65,6 +66,7 @@ test_struct tests[] =
     TEST_FUNCTION(fq_nmod_mat_minpoly),
     TEST_FUNCTION(fq_nmod_mat_mul),
     TEST_FUNCTION(fq_nmod_mat_mul_KS),
+    TEST_FUNCTION(fq_nmod_mat_mul_slices),
     TEST_FUNCTION(fq_nmod_mat_mul_vec),
     TEST_FUNCTION(fq_nmod_mat_nullspace),
     TEST_FUNCTION(fq_nmod_mat_one),
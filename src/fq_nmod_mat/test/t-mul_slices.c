@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fq_nmod.h"
+#include "fq_nmod_mat.h"
+
+TEST_FUNCTION_START(fq_nmod_mat_mul_slices, state)
+{
+    slong i;
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_mat_t A, B, C, D;
+        slong m, k, n;
+
+        /* cover both p >= 2d - 1 and small p with large degree */
+        if (n_randint(state, 2))
+        {
+            fq_nmod_ctx_randtest(ctx, state);
+        }
+        else
+        {
+            fmpz_t p;
+            fmpz_init(p);
+            fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, FLINT_BITS - 1), 1));
+            fq_nmod_ctx_init(ctx, p, 1 + n_randint(state, 30), "a");
+            fmpz_clear(p);
+        }
+
+        m = n_randint(state, 30);
+        k = n_randint(state, 30);
+        n = n_randint(state, 30);
+
+        fq_nmod_mat_init(A, m, k, ctx);
+        fq_nmod_mat_init(B, k, n, ctx);
+        fq_nmod_mat_init(C, m, n, ctx);
+        fq_nmod_mat_init(D, m, n, ctx);
+
+        fq_nmod_mat_randtest(A, state, ctx);
+        fq_nmod_mat_randtest(B, state, ctx);
+        fq_nmod_mat_randtest(C, state, ctx);  /* noise in output */
+
+        fq_nmod_mat_mul_slices(C, A, B, ctx);
+        fq_nmod_mat_mul_classical(D, A, B, ctx);
+
+        if (!fq_nmod_mat_equal(C, D, ctx))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("A:\n"), fq_nmod_mat_print(A, ctx);
+            flint_printf("B:\n"), fq_nmod_mat_print(B, ctx);
+            flint_printf("C:\n"), fq_nmod_mat_print(C, ctx);
+            flint_printf("D:\n"), fq_nmod_mat_print(D, ctx);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* aliasing */
+        if (k == n)
+        {
+            fq_nmod_mat_mul_slices(A, A, B, ctx);
+
+            if (!fq_nmod_mat_equal(A, D, ctx))
+            {
+                flint_printf("FAIL (aliasing):\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        fq_nmod_mat_clear(A, ctx);
+        fq_nmod_mat_clear(B, ctx);
+        fq_nmod_mat_clear(C, ctx);
+        fq_nmod_mat_clear(D, ctx);
+
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    TEST_FUNCTION_END(state);
+}
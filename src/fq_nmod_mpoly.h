@@ -765,6 +765,16 @@ void _fq_nmod_mpoly_mul_johnson(
     const ulong * cmpmask,
     const fq_nmod_ctx_t ctx);
 
+void fq_nmod_mpoly_mul_heap_threaded(fq_nmod_mpoly_t A,
+                            const fq_nmod_mpoly_t B, const fq_nmod_mpoly_t C,
+                                                const fq_nmod_mpoly_ctx_t ctx);
+
+void _fq_nmod_mpoly_mul_heap_threaded_pool_maxfields(fq_nmod_mpoly_t A,
+                                const fq_nmod_mpoly_t B, fmpz * maxBfields,
+                                const fq_nmod_mpoly_t C, fmpz * maxCfields,
+                                                 const fq_nmod_mpoly_ctx_t ctx,
+                        const thread_pool_handle * handles, slong num_handles);
+
 
 /* Powering ******************************************************************/
 
@@ -809,6 +819,15 @@ int fq_nmod_mpoly_divides_monagan_pearce(fq_nmod_mpoly_t poly1,
                   const fq_nmod_mpoly_t poly2, const fq_nmod_mpoly_t poly3,
                                                 const fq_nmod_mpoly_ctx_t ctx);
 
+int fq_nmod_mpoly_divides_heap_threaded(fq_nmod_mpoly_t Q,
+                            const fq_nmod_mpoly_t A, const fq_nmod_mpoly_t B,
+                                                const fq_nmod_mpoly_ctx_t ctx);
+
+int _fq_nmod_mpoly_divides_heap_threaded_pool(fq_nmod_mpoly_t Q,
+                            const fq_nmod_mpoly_t A, const fq_nmod_mpoly_t B,
+                                                 const fq_nmod_mpoly_ctx_t ctx,
+                        const thread_pool_handle * handles, slong num_handles);
+
 void fq_nmod_mpoly_div_monagan_pearce(fq_nmod_mpoly_t q,
                       const fq_nmod_mpoly_t poly2, const fq_nmod_mpoly_t poly3,
                                                 const fq_nmod_mpoly_ctx_t ctx);
@@ -982,6 +1001,25 @@ int fq_nmod_mpoly_repack_bits_inplace(fq_nmod_mpoly_t A,
 void fq_nmod_mpoly_ctx_change_modulus(fq_nmod_mpoly_ctx_t ctx,
                                                                     slong deg);
 
+/* data is passed to the threaded mul/div functions via a stripe struct */
+
+typedef struct _fq_nmod_mpoly_stripe_struct
+{
+    char * big_mem;
+    slong big_mem_alloc;
+    const fq_nmod_mpoly_ctx_struct * ctx;
+    slong N;
+    flint_bitcnt_t bits;
+    mp_limb_t * lc_minus_inv;
+    const ulong * cmpmask;
+    slong * startidx;
+    slong * endidx;
+    ulong * emin;
+    ulong * emax;
+    int upperclosed;
+} fq_nmod_mpoly_stripe_struct;
+
+typedef fq_nmod_mpoly_stripe_struct fq_nmod_mpoly_stripe_t[1];
 
 /* Univariates ***************************************************************/
 
@@ -9,12 +9,34 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "fq_nmod_mpoly.h"
 
 int fq_nmod_mpoly_divides(fq_nmod_mpoly_t Q,
                         const fq_nmod_mpoly_t A, const fq_nmod_mpoly_t B,
                                                  const fq_nmod_mpoly_ctx_t ctx)
 {
-    /* nothing fancy here */
-    return fq_nmod_mpoly_divides_monagan_pearce(Q, A, B, ctx);
+    thread_pool_handle * handles;
+    slong num_handles;
+    slong thread_limit = A->length/1024;
+    int divides;
+
+    if (B->length < 2 || A->length <= 50)
+        return fq_nmod_mpoly_divides_monagan_pearce(Q, A, B, ctx);
+
+    num_handles = flint_request_threads(&handles, thread_limit);
+
+    if (num_handles > 0)
+    {
+        divides = _fq_nmod_mpoly_divides_heap_threaded_pool(Q, A, B, ctx,
+                                                         handles, num_handles);
+    }
+    else
+    {
+        divides = fq_nmod_mpoly_divides_monagan_pearce(Q, A, B, ctx);
+    }
+
+    flint_give_back_threads(handles, num_handles);
+
+    return divides;
 }
@@ -9,11 +9,51 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "thread_support.h"
 #include "fq_nmod_mpoly.h"
 
 void fq_nmod_mpoly_mul(fq_nmod_mpoly_t A, const fq_nmod_mpoly_t B,
                         const fq_nmod_mpoly_t C, const fq_nmod_mpoly_ctx_t ctx)
 {
-    /* nothing fancy for now */
-    fq_nmod_mpoly_mul_johnson(A, B, C, ctx);
+    slong i;
+    fmpz * maxBfields, * maxCfields;
+    thread_pool_handle * handles;
+    slong num_handles;
+    slong thread_limit = FLINT_MIN(B->length, C->length)/512;
+    TMP_INIT;
+
+    if (B->length < 1 || C->length < 1)
+    {
+        fq_nmod_mpoly_zero(A, ctx);
+        return;
+    }
+
+    num_handles = flint_request_threads(&handles, thread_limit);
+
+    if (num_handles < 1)
+    {
+        flint_give_back_threads(handles, num_handles);
+        fq_nmod_mpoly_mul_johnson(A, B, C, ctx);
+        return;
+    }
+
+    TMP_START;
+
+    maxBfields = TMP_ARRAY_ALLOC(2*ctx->minfo->nfields, fmpz);
+    maxCfields = maxBfields + ctx->minfo->nfields;
+    for (i = 0; i < 2*ctx->minfo->nfields; i++)
+        fmpz_init(maxBfields + i);
+
+    mpoly_max_fields_fmpz(maxBfields, B->exps, B->length, B->bits, ctx->minfo);
+    mpoly_max_fields_fmpz(maxCfields, C->exps, C->length, C->bits, ctx->minfo);
+
+    _fq_nmod_mpoly_mul_heap_threaded_pool_maxfields(A, B, maxBfields,
+                                    C, maxCfields, ctx, handles, num_handles);
+
+    flint_give_back_threads(handles, num_handles);
+
+    for (i = 0; i < 2*ctx->minfo->nfields; i++)
+        fmpz_clear(maxBfields + i);
+
+    TMP_END;
 }
@@ -22,6 +22,7 @@
 #include "t-degree.c"
 #include "t-derivative.c"
 #include "t-div_monagan_pearce.c"
+#include "t-divides_heap_threaded.c"
 #include "t-divrem_ideal_monagan_pearce.c"
 #include "t-divrem_monagan_pearce.c"
 #include "t-evaluate.c"
@@ -44,6 +45,7 @@
 #include "t-get_term.c"
 #include "t-get_term_monomial.c"
 #include "t-mpolyuu_divides.c"
+#include "t-mul_heap_threaded.c"
 #include "t-mul_johnson.c"
 #include "t-push_term_fq_nmod_fmpz.c"
 #include "t-push_term_fq_nmod_ui.c"
@@ -73,6 +75,7 @@ test_struct tests[] =
     TEST_FUNCTION(fq_nmod_mpoly_degree),
     TEST_FUNCTION(fq_nmod_mpoly_derivative),
     TEST_FUNCTION(fq_nmod_mpoly_div_monagan_pearce),
+    TEST_FUNCTION(fq_nmod_mpoly_divides_heap_threaded),
     TEST_FUNCTION(fq_nmod_mpoly_divrem_ideal_monagan_pearce),
     TEST_FUNCTION(fq_nmod_mpoly_divrem_monagan_pearce),
     TEST_FUNCTION(fq_nmod_mpoly_evaluate),
@@ -95,6 +98,7 @@ test_struct tests[] =
     TEST_FUNCTION(fq_nmod_mpoly_get_term),
     TEST_FUNCTION(fq_nmod_mpoly_get_term_monomial),
     TEST_FUNCTION(fq_nmod_mpoly_mpolyuu_divides),
+    TEST_FUNCTION(fq_nmod_mpoly_mul_heap_threaded),
     TEST_FUNCTION(fq_nmod_mpoly_mul_johnson),
     TEST_FUNCTION(fq_nmod_mpoly_push_term_fq_nmod_fmpz),
     TEST_FUNCTION(fq_nmod_mpoly_push_term_fq_nmod_ui),
@@ -49,7 +49,6 @@
 #include "fq_mat_templates/mat_swap_cols.c"
 #include "fq_mat_templates/mat_swap_entrywise.c"
 #include "fq_mat_templates/minpoly.c"
-#include "fq_mat_templates/mul.c"
 #include "fq_mat_templates/mul_classical.c"
 #include "fq_mat_templates/mul_KS.c"
 #include "fq_mat_templates/mul_vec.c"
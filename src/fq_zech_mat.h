@@ -29,8 +29,15 @@
 /* Cutoff between classical and recursive LU decomposition */
 #define FQ_ZECH_MAT_LU_RECURSIVE_CUTOFF 4
 
+/* Dimension above which fq_zech_mat_mul uses fq_zech_mat_mul_slices */
+#define FQ_ZECH_MAT_MUL_SLICES_CUTOFF 32
+
 int FQ_ZECH_MAT_MUL_KS_CUTOFF(slong r, slong c, const fq_zech_ctx_t ctx);
 
+/* Multiplication via products of coefficient slices over Z/pZ */
+void fq_zech_mat_mul_slices(fq_zech_mat_t C, const fq_zech_mat_t A,
+                            const fq_zech_mat_t B, const fq_zech_ctx_t ctx);
+
 #define T fq_zech
 #define CAP_T FQ_ZECH
 #include "fq_mat_templates.h"
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fq_zech.h"
+#include "fq_zech_mat.h"
+
+void
+fq_zech_mat_mul(fq_zech_mat_t C, const fq_zech_mat_t A,
+                const fq_zech_mat_t B, const fq_zech_ctx_t ctx)
+{
+    slong d = fq_zech_ctx_degree(ctx);
+
+    FLINT_ASSERT(C->r == A->r);
+    FLINT_ASSERT(C->c == B->c);
+    FLINT_ASSERT(A->c == B->r);
+
+    if (C == A || C == B)
+    {
+        fq_zech_mat_t T;
+        fq_zech_mat_init(T, A->r, B->c, ctx);
+        fq_zech_mat_mul(T, A, B, ctx);
+        fq_zech_mat_swap_entrywise(T, C, ctx);
+        fq_zech_mat_clear(T, ctx);
+        return;
+    }
+
+    /* slices are only used when they can be multiplied modulo p itself */
+    if (ctx->p >= 2 * (mp_limb_t) d - 1 &&
+        FLINT_MIN(FLINT_MIN(A->r, A->c), B->c) >= FQ_ZECH_MAT_MUL_SLICES_CUTOFF)
+        fq_zech_mat_mul_slices(C, A, B, ctx);
+    else if (FQ_ZECH_MAT_MUL_KS_CUTOFF(A->r, B->c, ctx))
+        fq_zech_mat_mul_KS(C, A, B, ctx);
+    else
+        fq_zech_mat_mul_classical(C, A, B, ctx);
+}
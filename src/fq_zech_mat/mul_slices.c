@@ -0,0 +1,100 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "fq_nmod.h"
+#include "fq_nmod_mat.h"
+#include "fq_zech.h"
+#include "fq_zech_mat.h"
+
+/* Row t of S gets the coefficients of x^t of the entries of A, which are
+   the base p digits of their images under the evaluation table */
+static void
+_fq_zech_mat_get_slices(nmod_mat_t S, const fq_zech_mat_t A,
+                        const fq_zech_ctx_t ctx)
+{
+    slong i, j, t, c = A->c;
+    mp_limb_t q;
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < c; j++)
+        {
+            q = ctx->eval_table[fq_zech_mat_entry(A, i, j)->value];
+
+            for (t = 0; q >= ctx->p; t++)
+                nmod_mat_entry(S, t, i * c + j) =
+                    n_divrem2_precomp(&q, q, ctx->p, ctx->ppre);
+            nmod_mat_entry(S, t, i * c + j) = q;
+        }
+    }
+}
+
+void
+fq_zech_mat_mul_slices(fq_zech_mat_t C, const fq_zech_mat_t A,
+                       const fq_zech_mat_t B, const fq_zech_ctx_t ctx)
+{
+    slong ar = A->r, br = B->r, bc = B->c;
+    slong d = fq_zech_ctx_degree(ctx);
+    slong i, j, t;
+    mp_limb_t P;
+    nmod_mat_t SA, SB, X;
+    fq_zech_t g, u;
+
+    if (ar == 0 || bc == 0)
+        return;
+
+    if (br == 0)
+    {
+        fq_zech_mat_zero(C, ctx);
+        return;
+    }
+
+    P = _fq_nmod_mat_mul_slices_modulus(br, ctx->fq_nmod_ctx);
+
+    if (P == 0)
+    {
+        fq_zech_mat_mul_KS(C, A, B, ctx);
+        return;
+    }
+
+    nmod_mat_init(SA, d, ar * br, P);
+    nmod_mat_init(SB, d, br * bc, P);
+    _fq_zech_mat_get_slices(SA, A, ctx);
+    _fq_zech_mat_get_slices(SB, B, ctx);
+
+    /* the slices are copies, so C may alias A or B from here on */
+    nmod_mat_init(X, d, ar * bc, ctx->p);
+    _fq_nmod_mat_mul_slices(X, SA, SB, ar, br, bc, ctx->fq_nmod_ctx);
+    nmod_mat_clear(SA);
+    nmod_mat_clear(SB);
+
+    /* Horner evaluation at the generator */
+    fq_zech_gen(g, ctx);
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            fq_zech_struct * c = fq_zech_mat_entry(C, i, j);
+
+            fq_zech_set_ui(c, nmod_mat_entry(X, d - 1, i * bc + j), ctx);
+            for (t = d - 2; t >= 0; t--)
+            {
+                fq_zech_mul(c, c, g, ctx);
+                fq_zech_set_ui(u, nmod_mat_entry(X, t, i * bc + j), ctx);
+                fq_zech_add(c, c, u, ctx);
+            }
+        }
+    }
+
+    nmod_mat_clear(X);
+}
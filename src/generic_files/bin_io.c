@@ -0,0 +1,212 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "bin_io.h"
+
+#if (defined(__WIN32) && !defined(__CYGWIN__)) || defined(_MSC_VER)
+#define FLINT_BIN_NO_MMAP
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static char
+flint_bin_endianness(void)
+{
+    const mp_limb_t one = 1;
+    return (*((const unsigned char *) &one) == 1) ? 'L' : 'B';
+}
+
+void
+flint_bin_header(unsigned char * header, int tag)
+{
+    header[0] = 'F';
+    header[1] = 'L';
+    header[2] = 'B';
+    header[3] = FLINT_BIN_VERSION;
+    header[4] = tag;
+    header[5] = sizeof(mp_limb_t);
+    header[6] = flint_bin_endianness();
+    header[7] = 0;
+}
+
+int
+flint_bin_check_header(const unsigned char * header, int tag, int * swap)
+{
+    if (header[0] != 'F' || header[1] != 'L' || header[2] != 'B' ||
+        header[3] != FLINT_BIN_VERSION || header[4] != tag ||
+        header[5] != sizeof(mp_limb_t) ||
+        (header[6] != 'L' && header[6] != 'B'))
+        return 0;
+
+    *swap = (header[6] != flint_bin_endianness());
+    return 1;
+}
+
+void
+flint_bin_swap_limbs(mp_ptr x, slong n)
+{
+    slong i;
+    unsigned char * b, t;
+    size_t j;
+
+    for (i = 0; i < n; i++)
+    {
+        b = (unsigned char *) (x + i);
+
+        for (j = 0; j < sizeof(mp_limb_t) / 2; j++)
+        {
+            t = b[j];
+            b[j] = b[sizeof(mp_limb_t) - 1 - j];
+            b[sizeof(mp_limb_t) - 1 - j] = t;
+        }
+    }
+}
+
+int
+flint_bin_fwrite_header(FILE * file, int tag)
+{
+    unsigned char header[FLINT_BIN_HEADER_SIZE];
+
+    flint_bin_header(header, tag);
+    return fwrite(header, 1, FLINT_BIN_HEADER_SIZE, file) == FLINT_BIN_HEADER_SIZE;
+}
+
+int
+flint_bin_fread_header(FILE * file, int tag, int * swap)
+{
+    unsigned char header[FLINT_BIN_HEADER_SIZE];
+
+    if (fread(header, 1, FLINT_BIN_HEADER_SIZE, file) != FLINT_BIN_HEADER_SIZE)
+        return 0;
+
+    return flint_bin_check_header(header, tag, swap);
+}
+
+int
+flint_bin_fwrite_limbs(FILE * file, mp_srcptr x, slong n)
+{
+    return n <= 0 || fwrite(x, sizeof(mp_limb_t), n, file) == (size_t) n;
+}
+
+int
+flint_bin_fread_limbs(FILE * file, mp_ptr x, slong n, int swap)
+{
+    if (n <= 0)
+        return 1;
+
+    if (fread(x, sizeof(mp_limb_t), n, file) != (size_t) n)
+        return 0;
+
+    if (swap)
+        flint_bin_swap_limbs(x, n);
+
+    return 1;
+}
+
+int
+flint_bin_map_init(flint_bin_map_t map, const char * filename)
+{
+    map->data = NULL;
+    map->size = 0;
+    map->mapped = 0;
+
+#ifndef FLINT_BIN_NO_MMAP
+    {
+        struct stat st;
+        int fd;
+        void * p;
+
+        fd = open(filename, O_RDONLY);
+        if (fd < 0)
+            return 0;
+
+        if (fstat(fd, &st) != 0)
+        {
+            close(fd);
+            return 0;
+        }
+
+        if (st.st_size > 0)
+        {
+            p = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            close(fd);
+
+            if (p == MAP_FAILED)
+                return 0;
+
+            map->data = p;
+            map->size = st.st_size;
+            map->mapped = 1;
+        }
+        else
+        {
+            close(fd);
+        }
+
+        return 1;
+    }
+#else
+    {
+        /* read the file into memory instead */
+        FILE * file;
+        long size;
+
+        file = fopen(filename, "rb");
+        if (file == NULL)
+            return 0;
+
+        if (fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) < 0 ||
+            fseek(file, 0, SEEK_SET) != 0)
+        {
+            fclose(file);
+            return 0;
+        }
+
+        if (size > 0)
+        {
+            map->data = flint_malloc(size);
+
+            if (fread(map->data, 1, size, file) != (size_t) size)
+            {
+                flint_free(map->data);
+                map->data = NULL;
+                fclose(file);
+                return 0;
+            }
+
+            map->size = size;
+        }
+
+        fclose(file);
+        return 1;
+    }
+#endif
+}
+
+void
+flint_bin_map_clear(flint_bin_map_t map)
+{
+#ifndef FLINT_BIN_NO_MMAP
+    if (map->mapped)
+        munmap(map->data, map->size);
+#else
+    flint_free(map->data);
+#endif
+
+    map->data = NULL;
+    map->size = 0;
+    map->mapped = 0;
+}
@@ -0,0 +1,70 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_vec.h"
+
+#define FLINT_CPU_UNKNOWN (UWORD(1) << (FLINT_BITS - 1))
+
+static ulong _flint_cpu_features = FLINT_CPU_UNKNOWN;
+
+static ulong
+_flint_cpu_detect(void)
+{
+    ulong features = 0;
+
+#if FLINT_HAVE_CPU_DISPATCH
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")
+        && __builtin_cpu_supports("bmi") && __builtin_cpu_supports("bmi2")
+        && __builtin_cpu_supports("popcnt"))
+    {
+        features |= FLINT_CPU_AVX2;
+
+        if (__builtin_cpu_supports("avx512f")
+            && __builtin_cpu_supports("avx512dq")
+            && __builtin_cpu_supports("avx512vl")
+            && __builtin_cpu_supports("avx512bw"))
+            features |= FLINT_CPU_AVX512;
+    }
+#endif
+
+    return features;
+}
+
+#if FLINT_HAVE_CPU_DISPATCH
+/* detect the features once when the library is loaded */
+__attribute__((constructor)) static void
+_flint_cpu_features_init(void)
+{
+    _flint_cpu_features = _flint_cpu_detect();
+}
+#endif
+
+ulong
+flint_get_cpu_features(void)
+{
+    /* a racing first call stores the same value twice */
+    if (FLINT_UNLIKELY(_flint_cpu_features == FLINT_CPU_UNKNOWN))
+        _flint_cpu_features = _flint_cpu_detect();
+
+    return _flint_cpu_features;
+}
+
+void
+flint_set_cpu_features(ulong features)
+{
+    _flint_cpu_features = features & _flint_cpu_detect();
+
+    /* kernels which cache their selection must choose again */
+    _nmod_vec_dot_reset();
+}
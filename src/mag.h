@@ -401,6 +401,52 @@ mag_fast_addmul(mag_t z, const mag_t x, const mag_t y)
     }
 }
 
+MAG_INLINE void
+mag_fast_add(mag_t z, const mag_t x, const mag_t y)
+{
+    if (MAG_MAN(x) == 0)
+    {
+        mag_fast_init_set(z, y);
+    }
+    else if (MAG_MAN(y) == 0)
+    {
+        mag_fast_init_set(z, x);
+    }
+    else
+    {
+        slong shift;
+        shift = MAG_EXP(x) - MAG_EXP(y);
+
+        if (shift == 0)
+        {
+            MAG_EXP(z) = MAG_EXP(x);
+            MAG_MAN(z) = MAG_MAN(x) + MAG_MAN(y);
+            MAG_FAST_ADJUST_ONE_TOO_LARGE(z); /* may need two adjustments */
+        }
+        else if (shift > 0)
+        {
+            MAG_EXP(z) = MAG_EXP(x);
+
+            if (shift >= MAG_BITS)
+                MAG_MAN(z) = MAG_MAN(x) + LIMB_ONE;
+            else
+                MAG_MAN(z) = MAG_MAN(x) + (MAG_MAN(y) >> shift) + LIMB_ONE;
+        }
+        else
+        {
+            shift = -shift;
+            MAG_EXP(z) = MAG_EXP(y);
+
+            if (shift >= MAG_BITS)
+                MAG_MAN(z) = MAG_MAN(y) + LIMB_ONE;
+            else
+                MAG_MAN(z) = MAG_MAN(y) + (MAG_MAN(x) >> shift) + LIMB_ONE;
+        }
+
+        MAG_FAST_ADJUST_ONE_TOO_LARGE(z);
+    }
+}
+
 MAG_INLINE void
 mag_fast_add_2exp_si(mag_t z, const mag_t x, slong e)
 {
@@ -35,6 +35,7 @@
 #include "t-expm1.c"
 #include "t-exp_tail.c"
 #include "t-fac_ui.c"
+#include "t-fast_add.c"
 #include "t-fast_add_2exp_si.c"
 #include "t-fast_addmul.c"
 #include "t-fast_mul_2exp_si.c"
@@ -90,6 +91,7 @@ test_struct tests[] =
     TEST_FUNCTION(mag_expm1),
     TEST_FUNCTION(mag_exp_tail),
     TEST_FUNCTION(mag_fac_ui),
+    TEST_FUNCTION(mag_fast_add),
     TEST_FUNCTION(mag_fast_add_2exp_si),
     TEST_FUNCTION(mag_fast_addmul),
     TEST_FUNCTION(mag_fast_mul_2exp_si),
@@ -0,0 +1,100 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "arf.h"
+#include "mag.h"
+
+TEST_FUNCTION_START(mag_fast_add, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 100000 * 0.1 * flint_test_multiplier(); iter++)
+    {
+        arf_t x, y, z, z2, w;
+        mag_t xb, yb, zb;
+        int alias;
+
+        arf_init(x);
+        arf_init(y);
+        arf_init(z);
+        arf_init(z2);
+        arf_init(w);
+
+        mag_init(xb);
+        mag_init(yb);
+        mag_init(zb);
+
+        mag_randtest(xb, state, 15);
+        mag_randtest(yb, state, 15);
+
+        arf_set_mag(x, xb);
+        arf_set_mag(y, yb);
+
+        arf_add(z, x, y, MAG_BITS + 10, ARF_RND_DOWN);
+        arf_mul_ui(z2, z, 1025, MAG_BITS, ARF_RND_UP);
+        arf_mul_2exp_si(z2, z2, -10);
+
+        alias = n_randint(state, 4);
+
+        if (alias == 0)
+        {
+            mag_fast_add(zb, xb, yb);
+        }
+        else if (alias == 1)
+        {
+            mag_set(zb, xb);
+            mag_fast_add(zb, zb, yb);
+        }
+        else if (alias == 2)
+        {
+            mag_set(zb, yb);
+            mag_fast_add(zb, xb, zb);
+        }
+        else
+        {
+            arf_add(z, x, x, MAG_BITS + 10, ARF_RND_DOWN);
+            arf_mul_ui(z2, z, 1025, MAG_BITS, ARF_RND_UP);
+            arf_mul_2exp_si(z2, z2, -10);
+
+            mag_set(zb, xb);
+            mag_fast_add(zb, zb, zb);
+        }
+
+        arf_set_mag(w, zb);
+
+        MAG_CHECK_BITS(xb)
+        MAG_CHECK_BITS(yb)
+        MAG_CHECK_BITS(zb)
+
+        if (!(arf_cmpabs(z, w) <= 0 && arf_cmpabs(w, z2) <= 0))
+        {
+            flint_printf("FAIL (alias = %d)\n\n", alias);
+            flint_printf("x = "); arf_printd(x, 15); flint_printf("\n\n");
+            flint_printf("y = "); arf_printd(y, 15); flint_printf("\n\n");
+            flint_printf("z = "); arf_printd(z, 15); flint_printf("\n\n");
+            flint_printf("w = "); arf_printd(w, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        arf_clear(x);
+        arf_clear(y);
+        arf_clear(z);
+        arf_clear(z2);
+        arf_clear(w);
+
+        mag_clear(xb);
+        mag_clear(yb);
+        mag_clear(zb);
+    }
+
+    TEST_FUNCTION_END(state);
+}
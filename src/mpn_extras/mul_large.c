@@ -24,12 +24,45 @@
 
 
 #ifdef FLINT_HAVE_FFT_SMALL
-
 #include "fft_small.h"
+#endif
+
+#if !defined(FLINT_HAVE_FFT_SMALL) || FLINT_FFT_SMALL_DISPATCH
+
+static mp_limb_t
+_flint_mpn_mul_large_fft(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
+                        mp_srcptr i2, mp_size_t n2)
+{
+    if (n2 < FLINT_FFT_MUL_THRESHOLD)
+    {
+        if (n1 == n2)
+            if (i1 == i2)
+                mpn_sqr(r1, i1, n1);
+            else
+                mpn_mul_n(r1, i1, i2, n2);
+        else
+            mpn_mul(r1, i1, n1, i2, n2);
+    }
+    else
+    {
+        flint_mpn_mul_fft_main(r1, i1, n1, i2, n2);
+    }
+
+    return r1[n1 + n2 - 1];
+}
+
+#endif
+
+#ifdef FLINT_HAVE_FFT_SMALL
 
 mp_limb_t flint_mpn_mul_large(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
                         mp_srcptr i2, mp_size_t n2)
 {
+#if FLINT_FFT_SMALL_DISPATCH
+    if (!FFT_SMALL_AVAILABLE)
+        return _flint_mpn_mul_large_fft(r1, i1, n1, i2, n2);
+#endif
+
     /* Experimental: strip trailing zeros. Normally this should
        be handled by the caller where appropriate, but there can be
        situations where it helps to do so here. */
@@ -77,23 +110,7 @@ mp_limb_t flint_mpn_mul_large(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
 mp_limb_t flint_mpn_mul_large(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
                         mp_srcptr i2, mp_size_t n2)
 {
-    if (n2 < FLINT_FFT_MUL_THRESHOLD)
-    {
-        if (n1 == n2)
-            if (i1 == i2)
-                mpn_sqr(r1, i1, n1);
-            else
-                mpn_mul_n(r1, i1, i2, n2);
-        else
-            mpn_mul(r1, i1, n1, i2, n2);
-    }
-    else
-    {
-        flint_mpn_mul_fft_main(r1, i1, n1, i2, n2);
-    }
-
-    return r1[n1 + n2 - 1];
+    return _flint_mpn_mul_large_fft(r1, i1, n1, i2, n2);
 }
 
 #endif
-
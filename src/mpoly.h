@@ -1485,6 +1485,34 @@ void * _mpoly_heap_pop(mpoly_heap_s * heap, slong * heap_len, slong N,
 int _mpoly_heap_insert(mpoly_heap_s * heap, ulong * exp, void * x,
        slong * next_loc, slong * heap_len, slong N, const ulong * cmpmask);
 
+/*
+   4-ary heap of single word exponents: the children of i are 4i - 2, ...,
+   4i + 1, so that with heap + 2 aligned to 64 bytes each set of siblings
+   sits in one cache line. MPOLY_HEAP4_ALIGN aligns an array allocated
+   with MPOLY_HEAP4_PAD extra entries.
+*/
+
+#define HEAP4_FIRST_CHILD(i) (4*(i) - 2)
+#define HEAP4_PARENT(i) (((i) + 2)/4)
+
+#define MPOLY_HEAP4_PAD 8
+#define MPOLY_HEAP4_ALIGN(h) \
+   ((mpoly_heap1_s *) ((((ulong) ((h) + 2)) + 63) & ~UWORD(63)) - 2)
+
+/* below this many entries the binary heap fits in cache and is faster */
+#define MPOLY_HEAP4_CUTOFF 65536
+
+#if defined(__GNUC__)
+# define MPOLY_HEAP_PREFETCH(p) __builtin_prefetch(p)
+#else
+# define MPOLY_HEAP_PREFETCH(p) ((void) 0)
+#endif
+
+void * _mpoly_heap4_pop1(mpoly_heap1_s * heap, slong * heap_len, ulong maskhi);
+
+void _mpoly_heap4_insert1(mpoly_heap1_s * heap, ulong exp, void * x,
+                              slong * next_loc, slong * heap_len, ulong maskhi);
+
 /* generic parsing ***********************************************************/
 
 typedef struct {
@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "mpoly.h"
+
+/*
+   4-ary version of _mpoly_heap_pop1. The hole left at the root is moved
+   down along the largest children to the bottom, and the last element
+   is then sifted up from there. While the children of a node are being
+   compared, the block of grandchildren along the chosen path is prefetched.
+*/
+void * _mpoly_heap4_pop1(mpoly_heap1_s * heap, slong * heap_len, ulong maskhi)
+{
+   ulong exp, e;
+   slong i, j, c, m, s = --(*heap_len);
+   void * x = heap[1].next;
+
+   i = 1;
+   j = HEAP4_FIRST_CHILD(i);
+
+   while (j + 3 < s)
+   {
+      /* tournament among the four children */
+      m = j + ((heap[j + 1].exp^maskhi) > (heap[j].exp^maskhi));
+      c = j + 2 + ((heap[j + 3].exp^maskhi) > (heap[j + 2].exp^maskhi));
+      m = ((heap[c].exp^maskhi) > (heap[m].exp^maskhi)) ? c : m;
+
+      j = HEAP4_FIRST_CHILD(m);
+      MPOLY_HEAP_PREFETCH(heap + j);
+
+      heap[i] = heap[m];
+      i = m;
+   }
+
+   if (j < s)
+   {
+      /* incomplete last set of children */
+      m = j;
+      exp = heap[j].exp^maskhi;
+
+      for (c = j + 1; c < s; c++)
+      {
+         e = heap[c].exp^maskhi;
+         if (e > exp)
+         {
+            exp = e;
+            m = c;
+         }
+      }
+
+      heap[i] = heap[m];
+      i = m;
+   }
+
+   /* insert last element into heap[i] */
+   exp = heap[s].exp^maskhi;
+   j = HEAP4_PARENT(i);
+
+   while (i > 1 && exp > (heap[j].exp^maskhi))
+   {
+      heap[i] = heap[j];
+      i = j;
+      j = HEAP4_PARENT(j);
+   }
+
+   heap[i] = heap[s];
+
+   return x;
+}
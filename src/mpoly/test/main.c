@@ -14,6 +14,7 @@
 
 /* Include functions *********************************************************/
 
+#include "t-heap4.c"
 #include "t-max_degrees_tight.c"
 #include "t-max_fields.c"
 #include "t-monomial_halves.c"
@@ -26,6 +27,7 @@
 
 test_struct tests[] =
 {
+    TEST_FUNCTION(mpoly_heap4),
     TEST_FUNCTION(mpoly_max_degrees_tight),
     TEST_FUNCTION(mpoly_max_fields),
     TEST_FUNCTION(mpoly_monomial_halves),
@@ -0,0 +1,133 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "mpoly.h"
+
+/* pop all entries with exponent e, returning the number of nodes or -1 */
+static slong
+pop_all(int quad, mpoly_heap1_s * heap, slong * heap_len, ulong e,
+                                                ulong maskhi, const ulong * es)
+{
+    slong count = 0;
+    mpoly_heap_t * x;
+
+    while (*heap_len > 1 && heap[1].exp == e)
+    {
+        x = quad ? _mpoly_heap4_pop1(heap, heap_len, maskhi)
+                 : _mpoly_heap_pop1(heap, heap_len, maskhi);
+
+        for ( ; x != NULL; x = x->next)
+        {
+            if (es[x->i] != e)
+                return -1;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+TEST_FUNCTION_START(mpoly_heap4, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 1000*flint_test_multiplier(); iter++)
+    {
+        slong i, n, len2, len4, next2, next4, c2, c4;
+        mpoly_heap1_s * heap2, * heap4, * heap4_alloc;
+        mpoly_heap_t * chain2, * chain4;
+        ulong * es, maskhi, range, e;
+
+        n = 1 + n_randint(state, 1000);
+        range = 1 + n_randint(state, 2*n);
+        maskhi = n_randint(state, 2) ? 0 : n_randtest(state);
+
+        es = FLINT_ARRAY_ALLOC(n, ulong);
+        chain2 = FLINT_ARRAY_ALLOC(n, mpoly_heap_t);
+        chain4 = FLINT_ARRAY_ALLOC(n, mpoly_heap_t);
+        heap2 = FLINT_ARRAY_ALLOC(n + 1, mpoly_heap1_s);
+        heap4_alloc = FLINT_ARRAY_ALLOC(n + 1 + MPOLY_HEAP4_PAD,
+                                                          mpoly_heap1_s);
+        heap4 = MPOLY_HEAP4_ALIGN(heap4_alloc);
+
+        if (((ulong) (heap4 + 2)) % 64 != 0)
+        {
+            flint_printf("FAIL: heap is not aligned\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        for (i = 0; i < n; i++)
+            es[i] = n_randint(state, range);
+
+        len2 = len4 = 1;
+        next2 = next4 = n + 4;
+
+        /* random mix of insertions and removal of the maximum */
+        for (i = 0; i < n || len2 > 1; )
+        {
+            if (i < n && (len2 == 1 || n_randint(state, 3) != 0))
+            {
+                chain2[i].i = chain4[i].i = i;
+                chain2[i].j = chain4[i].j = 0;
+                chain2[i].next = chain4[i].next = NULL;
+                _mpoly_heap_insert1(heap2, es[i], chain2 + i,
+                                                  &next2, &len2, maskhi);
+                _mpoly_heap4_insert1(heap4, es[i], chain4 + i,
+                                                  &next4, &len4, maskhi);
+                i++;
+                continue;
+            }
+
+            if (len4 <= 1 || heap2[1].exp != heap4[1].exp)
+            {
+                flint_printf("FAIL: maximum mismatch: n = %wd\n", n);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            e = heap2[1].exp;
+            c2 = pop_all(0, heap2, &len2, e, maskhi, es);
+            c4 = pop_all(1, heap4, &len4, e, maskhi, es);
+
+            if (c2 < 1 || c2 != c4)
+            {
+                flint_printf("FAIL: chain mismatch\n");
+                flint_printf("n = %wd, c2 = %wd, c4 = %wd\n", n, c2, c4);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            if (len4 > 1 && (heap4[1].exp^maskhi) >= (e^maskhi))
+            {
+                flint_printf("FAIL: order: n = %wd\n", n);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        if (len4 != 1)
+        {
+            flint_printf("FAIL: heap not empty: n = %wd\n", n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        flint_free(es);
+        flint_free(chain2);
+        flint_free(chain4);
+        flint_free(heap2);
+        flint_free(heap4_alloc);
+    }
+
+    TEST_FUNCTION_END(state);
+}
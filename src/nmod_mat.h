@@ -102,8 +102,15 @@ void nmod_mat_randtriu(nmod_mat_t mat, flint_rand_t state, int unit);
 #ifdef FLINT_HAVE_FILE
 int nmod_mat_fprint_pretty(FILE* file, const nmod_mat_t mat);
 int nmod_mat_fprint(FILE* f, const nmod_mat_t mat);
+
+int nmod_mat_fwrite_bin(FILE * file, const nmod_mat_t mat);
+int nmod_mat_fread_bin(FILE * file, nmod_mat_t mat);
 #endif
 
+size_t nmod_mat_bin_view_init(nmod_mat_t mat, const char * data, size_t size);
+void nmod_mat_bin_view_clear(nmod_mat_t mat);
+
+
 void nmod_mat_print_pretty(const nmod_mat_t mat);
 int nmod_mat_print(const nmod_mat_t mat);
 
@@ -284,6 +291,7 @@ slong nmod_mat_lu(slong * P, nmod_mat_t A, int rank_check);
 slong nmod_mat_lu_classical(slong * P, nmod_mat_t A, int rank_check);
 slong nmod_mat_lu_classical_delayed(slong * P, nmod_mat_t A, int rank_check);
 slong nmod_mat_lu_recursive(slong * P, nmod_mat_t A, int rank_check);
+slong nmod_mat_lu_tiled(slong * P, nmod_mat_t A, int rank_check);
 
 /* Nonsingular solving */
 
@@ -341,6 +349,13 @@ void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
 #define NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF 64
 #define NMOD_MAT_SOLVE_TRI_COLS_CUTOFF 64
 
+/* Size from which the tiled LU decomposition is used when threads are
+   available (it must exceed NMOD_MAT_LU_TILE_MAX), and the range of tile
+   widths it uses */
+#define NMOD_MAT_LU_TILED_CUTOFF 512
+#define NMOD_MAT_LU_TILE_MIN 4
+#define NMOD_MAT_LU_TILE_MAX 128
+
 /*
    Suggested initial modulus size for multimodular algorithms. This should
    be chosen so that we get the most number of bits per cycle
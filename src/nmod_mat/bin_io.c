@@ -0,0 +1,176 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "bin_io.h"
+#include "nmod.h"
+#include "nmod_mat.h"
+
+/* Rows are written one at a time, so no copy of the matrix is made. */
+int
+nmod_mat_fwrite_bin(FILE * file, const nmod_mat_t mat)
+{
+    mp_limb_t w[3];
+    slong i;
+
+    w[0] = mat->mod.n;
+    w[1] = mat->r;
+    w[2] = mat->c;
+
+    if (!flint_bin_fwrite_header(file, FLINT_BIN_NMOD_MAT) ||
+        !flint_bin_fwrite_limbs(file, w, 3))
+        return 0;
+
+    for (i = 0; i < mat->r; i++)
+        if (!flint_bin_fwrite_limbs(file, mat->rows[i], mat->c))
+            return 0;
+
+    return 1;
+}
+
+static int
+nmod_mat_bin_dims(slong * r, slong * c, const mp_limb_t * w)
+{
+    mp_limb_t hi, lo;
+
+    *r = w[1];
+    *c = w[2];
+    umul_ppmm(hi, lo, w[1], w[2]);
+
+    /* the row pointers of an empty matrix are not backed by any data */
+    return w[0] != 0 && *r >= 0 && *c >= 0 && hi == 0 && lo <= WORD_MAX &&
+           !(*c == 0 && *r > FLINT_BIN_READ_CHUNK);
+}
+
+static int
+_nmod_mat_bin_check_entries(nmod_mat_t mat)
+{
+    slong i, j;
+
+    for (i = 0; i < mat->r; i++)
+    {
+        for (j = 0; j < mat->c; j++)
+        {
+            if (mat->rows[i][j] >= mat->mod.n)
+            {
+                nmod_mat_zero(mat);
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+int
+nmod_mat_fread_bin(FILE * file, nmod_mat_t mat)
+{
+    mp_limb_t w[3];
+    mp_ptr v;
+    slong i, r, c, done, k;
+    int swap;
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_NMOD_MAT, &swap) ||
+        !flint_bin_fread_limbs(file, w, 3, swap) || !nmod_mat_bin_dims(&r, &c, w))
+        return 0;
+
+    if (mat->r != r || mat->c != c || mat->mod.n != w[0])
+    {
+        /* r and c come from the stream: a large matrix is read into a
+           growing buffer first and only allocated once all its entries are
+           present */
+        if (r * c > FLINT_BIN_READ_CHUNK)
+        {
+            v = flint_malloc(FLINT_BIN_READ_CHUNK * sizeof(mp_limb_t));
+
+            for (done = 0; done < r * c; done += k)
+            {
+                k = FLINT_MIN(r * c - done, FLINT_MAX(done, FLINT_BIN_READ_CHUNK));
+
+                if (done != 0)
+                    v = flint_realloc(v, (done + k) * sizeof(mp_limb_t));
+
+                if (!flint_bin_fread_limbs(file, v + done, k, swap))
+                {
+                    flint_free(v);
+                    nmod_mat_zero(mat);
+                    return 0;
+                }
+            }
+
+            nmod_mat_clear(mat);
+            nmod_mat_init(mat, r, c, w[0]);
+
+            for (i = 0; i < r; i++)
+                memcpy(mat->rows[i], v + i * c, c * sizeof(mp_limb_t));
+
+            flint_free(v);
+
+            return _nmod_mat_bin_check_entries(mat);
+        }
+
+        nmod_mat_clear(mat);
+        nmod_mat_init(mat, r, c, w[0]);
+    }
+
+    for (i = 0; i < r; i++)
+    {
+        if (!flint_bin_fread_limbs(file, mat->rows[i], c, swap))
+        {
+            nmod_mat_zero(mat);
+            return 0;
+        }
+    }
+
+    return _nmod_mat_bin_check_entries(mat);
+}
+
+size_t
+nmod_mat_bin_view_init(nmod_mat_t mat, const char * data, size_t size)
+{
+    const mp_limb_t * w;
+    slong i, r, c;
+    int swap;
+
+    if (size < FLINT_BIN_HEADER_SIZE + 3 * sizeof(mp_limb_t) ||
+        ((size_t) data) % sizeof(mp_limb_t) != 0 ||
+        !flint_bin_check_header((const unsigned char *) data, FLINT_BIN_NMOD_MAT, &swap) ||
+        swap)
+        return 0;
+
+    w = (const mp_limb_t *) (data + FLINT_BIN_HEADER_SIZE);
+
+    if (!nmod_mat_bin_dims(&r, &c, w) ||
+        (size_t) (r * c) > (size - FLINT_BIN_HEADER_SIZE) / sizeof(mp_limb_t) - 3)
+        return 0;
+
+    /* like a window: the entries belong to the caller */
+    mat->entries = NULL;
+    mat->rows = (r > 0) ? flint_malloc(r * sizeof(mp_limb_t *)) : NULL;
+    for (i = 0; i < r; i++)
+        mat->rows[i] = (mp_ptr) (w + 3 + i * c);
+
+    mat->r = r;
+    mat->c = c;
+    nmod_init(&mat->mod, w[0]);
+
+    return FLINT_BIN_HEADER_SIZE + (3 + r * c) * sizeof(mp_limb_t);
+}
+
+void
+nmod_mat_bin_view_clear(nmod_mat_t mat)
+{
+    flint_free(mat->rows);
+    mat->rows = NULL;
+    mat->r = 0;
+    mat->c = 0;
+}
@@ -12,6 +12,7 @@
 #include "nmod.h"
 #include "nmod_vec.h"
 #include "nmod_mat.h"
+#include "thread_support.h"
 
 slong
 nmod_mat_lu(slong * P, nmod_mat_t A, int rank_check)
@@ -29,6 +30,9 @@ nmod_mat_lu(slong * P, nmod_mat_t A, int rank_check)
     }
     else
     {
+        if (n >= NMOD_MAT_LU_TILED_CUTOFF && flint_get_num_threads() > 1)
+            return nmod_mat_lu_tiled(P, A, rank_check);
+
         if (n >= 20)
         {
             bits = NMOD_BITS(A->mod);
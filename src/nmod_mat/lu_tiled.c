@@ -0,0 +1,235 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat.h"
+#include "thread_support.h"
+
+/*
+    Right-looking LU decomposition on column tiles.
+
+    At step t the panel consisting of tile t (restricted to the rows not
+    yet used as pivots) is factored with nmod_mat_lu. If it has rank r,
+    every tile j > t is then updated with the r new pivot rows:
+
+        [U01_j]   [L00^-1 A01_j        ]
+        [A11_j] = [A11_j - A10 U01_j   ]
+
+    The updates of distinct tiles are independent and run as tasks. The
+    update of tile t + 1 is done directly by the calling thread so that
+    the next panel can be factored while the remaining updates of step t
+    are still running (lookahead of depth one). The update of tile j at
+    step t + 1 is only spawned once its update at step t has been joined.
+
+    All row exchanges are done by permuting row pointers. The windows used
+    by a task take a copy of the row pointers when they are created, so
+    factoring the next panel does not disturb the tasks in flight.
+
+    As in nmod_mat_lu_recursive, the columns of L belonging to a
+    rank-deficient panel are compressed at the end.
+*/
+
+typedef struct
+{
+    nmod_mat_t L00;
+    nmod_mat_t A10;
+    nmod_mat_t A01;
+    nmod_mat_t A11;
+}
+_lu_tile_arg_struct;
+
+static void
+_lu_tile_update(void * varg)
+{
+    _lu_tile_arg_struct * arg = (_lu_tile_arg_struct *) varg;
+
+    nmod_mat_solve_tril(arg->A01, arg->L00, arg->A01, 1);
+
+    if (arg->A11->r != 0)
+        nmod_mat_submul(arg->A11, arg->A11, arg->A10, arg->A01);
+
+    nmod_mat_window_clear(arg->L00);
+    nmod_mat_window_clear(arg->A10);
+    nmod_mat_window_clear(arg->A01);
+    nmod_mat_window_clear(arg->A11);
+}
+
+static void
+_apply_permutation(slong * AP, nmod_mat_t A, slong * P,
+    slong n, slong offset)
+{
+    if (n != 0)
+    {
+        mp_ptr * Atmp;
+        slong * APtmp;
+        slong i;
+
+        Atmp = flint_malloc(sizeof(mp_ptr) * n);
+        APtmp = flint_malloc(sizeof(slong) * n);
+
+        for (i = 0; i < n; i++) Atmp[i] = A->rows[P[i] + offset];
+        for (i = 0; i < n; i++) A->rows[i + offset] = Atmp[i];
+
+        for (i = 0; i < n; i++) APtmp[i] = AP[P[i] + offset];
+        for (i = 0; i < n; i++) AP[i + offset] = APtmp[i];
+
+        flint_free(Atmp);
+        flint_free(APtmp);
+    }
+}
+
+slong
+nmod_mat_lu_tiled(slong * P, nmod_mat_t A, int rank_check)
+{
+    slong i, j, t, m, n, b, num_tiles, num_panels, k, r, c, w, rank;
+    slong * P1, * panel_row, * panel_rank;
+    _lu_tile_arg_struct * args;
+    flint_task_struct * tasks;
+    int * active;
+    nmod_mat_t W;
+
+    m = A->r;
+    n = A->c;
+
+    for (i = 0; i < m; i++)
+        P[i] = i;
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    b = n / (2 * flint_get_num_threads());
+    b = FLINT_MAX(b, NMOD_MAT_LU_TILE_MIN);
+    b = FLINT_MIN(b, NMOD_MAT_LU_TILE_MAX);
+
+    num_tiles = (n + b - 1) / b;
+
+    P1 = flint_malloc(sizeof(slong) * m);
+    panel_row = flint_malloc(sizeof(slong) * num_tiles);
+    panel_rank = flint_malloc(sizeof(slong) * num_tiles);
+    args = flint_malloc(sizeof(_lu_tile_arg_struct) * num_tiles);
+    tasks = flint_malloc(sizeof(flint_task_struct) * num_tiles);
+    active = flint_calloc(num_tiles, sizeof(int));
+
+    flint_task_begin(0);
+
+    k = 0;
+    rank = 0;
+    num_panels = 0;
+
+    for (t = 0; t < num_tiles && k < m; t++)
+    {
+        c = t * b;
+        w = FLINT_MIN(b, n - c);
+
+        /* an update of this tile is still pending if the previous
+           panel was zero */
+        if (active[t])
+        {
+            flint_task_join(tasks + t);
+            active[t] = 0;
+        }
+
+        nmod_mat_window_init(W, A, k, c, m, c + w);
+        r = nmod_mat_lu(P1, W, 0);
+        nmod_mat_window_clear(W);
+
+        _apply_permutation(P, A, P1, m - k, k);
+
+        panel_row[t] = k;
+        panel_rank[t] = r;
+        num_panels++;
+
+        /* the columns right of this panel can no longer make up for
+           a rank deficiency */
+        if (rank_check && rank + r + (n - c - w) < FLINT_MIN(m, n))
+        {
+            rank = -1;
+            break;
+        }
+
+        if (r != 0)
+        {
+            /* spawn the updates of the far tiles, then do the next one */
+            for (j = num_tiles - 1; j > t; j--)
+            {
+                slong cj = j * b;
+                slong wj = FLINT_MIN(b, n - cj);
+
+                if (active[j])
+                    flint_task_join(tasks + j);
+
+                nmod_mat_window_init(args[j].L00, A, k, c, k + r, c + r);
+                nmod_mat_window_init(args[j].A10, A, k + r, c, m, c + r);
+                nmod_mat_window_init(args[j].A01, A, k, cj, k + r, cj + wj);
+                nmod_mat_window_init(args[j].A11, A, k + r, cj, m, cj + wj);
+
+                if (j == t + 1)
+                {
+                    _lu_tile_update(args + j);
+                    active[j] = 0;
+                }
+                else
+                {
+                    flint_task_init(tasks + j, _lu_tile_update, args + j);
+                    flint_task_spawn(tasks + j);
+                    active[j] = 1;
+                }
+            }
+        }
+
+        k += r;
+        rank += r;
+    }
+
+    for (j = 0; j < num_tiles; j++)
+        if (active[j])
+            flint_task_join(tasks + j);
+
+    flint_task_end();
+
+    if (rank < 0)
+    {
+        rank = 0;
+    }
+    else
+    {
+        /* compress L */
+        for (t = 0; t < num_panels; t++)
+        {
+            k = panel_row[t];
+            r = panel_rank[t];
+            c = t * b;
+
+            if (c == k)
+                continue;
+
+            for (i = k + 1; i < m; i++)
+            {
+                mp_ptr row = A->rows[i];
+
+                for (j = 0; j < FLINT_MIN(i - k, r); j++)
+                {
+                    mp_limb_t v = row[c + j];
+                    row[c + j] = 0;
+                    row[k + j] = v;
+                }
+            }
+        }
+    }
+
+    flint_free(P1);
+    flint_free(panel_row);
+    flint_free(panel_rank);
+    flint_free(args);
+    flint_free(tasks);
+    flint_free(active);
+
+    return rank;
+}
@@ -13,6 +13,10 @@
 #include "nmod_vec.h"
 #include "nmod_mat.h"
 
+#if FLINT_HAVE_CPU_DISPATCH
+# include <immintrin.h>
+#endif
+
 /*
 with op = 0, computes D = A*B
 with op = 1, computes D = C + A*B
@@ -156,6 +160,135 @@ _nmod_mat_addmul_packed_op(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
 
 
 
+#if FLINT_HAVE_CPU_DISPATCH
+
+/*
+    For n < 2^31, rows of A*B are accumulated as rows of unreduced 64-bit
+    sums using SIMD 32 x 32 -> 64 bit multiplications, much like the
+    packed variant. If the sums may overflow, the accumulator is split
+    into 32-bit halves after every block of rows of B.
+*/
+
+static void
+_nmod_mat_addmul_u32_row_finish(mp_ptr Di, mp_srcptr Ci, mp_srcptr lo,
+                      mp_srcptr hi, slong n, int op, nmod_t mod, int split)
+{
+    mp_limb_t c, h, l;
+    slong j;
+
+    for (j = 0; j < n; j++)
+    {
+        if (split)
+        {
+            add_ssaaaa(h, l, hi[j] >> 32, hi[j] << 32, 0, lo[j]);
+            NMOD2_RED2(c, h, l, mod);
+        }
+        else
+        {
+            NMOD_RED(c, lo[j], mod);
+        }
+
+        if (op == 1)
+            c = nmod_add(Ci[j], c, mod);
+        else if (op == -1)
+            c = nmod_sub(Ci[j], c, mod);
+
+        Di[j] = c;
+    }
+}
+
+#define U32_ADDMUL_KERNEL(vec, load, store, set1, add, and, srli, mul, W)   \
+    do {                                                                    \
+        vec __a0, __a1, __x, __mask = set1(0xffffffff);                     \
+        mp_ptr acc, lo, hi;                                                 \
+        mp_srcptr B0, B1;                                                   \
+        mp_limb_t a0, a1;                                                   \
+        slong i, j, l, block;                                               \
+        int split = (nlimbs != 1);                                          \
+                                                                            \
+        acc = flint_malloc(3 * n * sizeof(mp_limb_t));                      \
+        lo = acc + n;                                                       \
+        hi = lo + n;                                                        \
+                                                                            \
+        /* number of products which can be summed in one word; this is     \
+           even since n < 2^31 */                                           \
+        block = split ? UWORD(1) << (2 * mod.norm - FLINT_BITS) : k;        \
+                                                                            \
+        for (i = 0; i < m; i++)                                             \
+        {                                                                   \
+            flint_mpn_zero(acc, split ? 3 * n : n);                         \
+                                                                            \
+            for (l = 0; l < k; )                                            \
+            {                                                               \
+                /* two rows of B at a time */                               \
+                a0 = A[i][l];                                               \
+                a1 = (l + 1 < k) ? A[i][l + 1] : 0;                         \
+                B0 = B[l];                                                  \
+                B1 = (l + 1 < k) ? B[l + 1] : B[l];                         \
+                __a0 = set1(a0);                                            \
+                __a1 = set1(a1);                                            \
+                                                                            \
+                for (j = 0; j + W <= n; j += W)                             \
+                {                                                           \
+                    __x = add(mul(__a0, load(B0 + j)),                      \
+                              mul(__a1, load(B1 + j)));                     \
+                    store(acc + j, add(__x, load(acc + j)));                \
+                }                                                           \
+                for ( ; j < n; j++)                                         \
+                    acc[j] += a0 * B0[j] + a1 * B1[j];                      \
+                                                                            \
+                l = FLINT_MIN(l + 2, k);                                    \
+                                                                            \
+                if (split && (l % block == 0 || l == k))                    \
+                {                                                           \
+                    for (j = 0; j + W <= n; j += W)                         \
+                    {                                                       \
+                        __x = load(acc + j);                                \
+                        store(lo + j, add(load(lo + j), and(__x, __mask))); \
+                        store(hi + j, add(load(hi + j), srli(__x, 32)));    \
+                    }                                                       \
+                    for ( ; j < n; j++)                                     \
+                    {                                                       \
+                        lo[j] += acc[j] & UWORD(0xffffffff);                \
+                        hi[j] += acc[j] >> 32;                              \
+                    }                                                       \
+                    flint_mpn_zero(acc, n);                                 \
+                }                                                           \
+            }                                                               \
+                                                                            \
+            _nmod_mat_addmul_u32_row_finish(D[i], (op == 0) ? NULL : C[i],  \
+                                  split ? lo : acc, hi, n, op, mod, split); \
+        }                                                                   \
+                                                                            \
+        flint_free(acc);                                                    \
+    } while (0)
+
+#define LOAD256(p) _mm256_loadu_si256((const __m256i *) (p))
+#define STORE256(p, x) _mm256_storeu_si256((__m256i *) (p), (x))
+#define LOAD512(p) _mm512_loadu_si512((const void *) (p))
+#define STORE512(p, x) _mm512_storeu_si512((void *) (p), (x))
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX2 void
+_nmod_mat_addmul_u32_avx2(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
+    const mp_ptr * B, slong m, slong k, slong n, int op, nmod_t mod, int nlimbs)
+{
+    U32_ADDMUL_KERNEL(__m256i, LOAD256, STORE256, _mm256_set1_epi64x,
+        _mm256_add_epi64, _mm256_and_si256, _mm256_srli_epi64,
+        _mm256_mul_epu32, 4);
+}
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX512 void
+_nmod_mat_addmul_u32_avx512(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
+    const mp_ptr * B, slong m, slong k, slong n, int op, nmod_t mod, int nlimbs)
+{
+    U32_ADDMUL_KERNEL(__m512i, LOAD512, STORE512, _mm512_set1_epi64,
+        _mm512_add_epi64, _mm512_and_si512, _mm512_srli_epi64,
+        _mm512_mul_epu32, 8);
+}
+
+#endif
+
+
 void
 _nmod_mat_mul_classical_op(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op)
@@ -180,6 +313,26 @@ _nmod_mat_mul_classical_op(nmod_mat_t D, const nmod_mat_t C,
 
     nlimbs = _nmod_vec_dot_bound_limbs(k, mod);
 
+#if FLINT_HAVE_CPU_DISPATCH
+    if (NMOD_BITS(mod) < 32 && n >= 8 && mod.n != 1)
+    {
+        ulong cpu = flint_get_cpu_features();
+
+        if (cpu & FLINT_CPU_AVX512)
+        {
+            _nmod_mat_addmul_u32_avx512(D->rows, (op == 0) ? NULL : C->rows,
+                A->rows, B->rows, m, k, n, op, D->mod, nlimbs);
+            return;
+        }
+        else if (cpu & FLINT_CPU_AVX2)
+        {
+            _nmod_mat_addmul_u32_avx2(D->rows, (op == 0) ? NULL : C->rows,
+                A->rows, B->rows, m, k, n, op, D->mod, nlimbs);
+            return;
+        }
+    }
+#endif
+
     if (nlimbs == 1 && m > 10 && k > 10 && n > 10)
     {
         _nmod_mat_addmul_packed_op(D->rows, (op == 0) ? NULL : C->rows,
@@ -10,9 +10,10 @@
 */
 
 #include "nmod_mat.h"
+#include "thread_support.h"
 
-void
-nmod_mat_solve_tril(nmod_mat_t X, const nmod_mat_t L,
+static void
+_nmod_mat_solve_tril(nmod_mat_t X, const nmod_mat_t L,
                                     const nmod_mat_t B, int unit)
 {
     if (B->r < NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF ||
@@ -25,3 +26,59 @@ nmod_mat_solve_tril(nmod_mat_t X, const nmod_mat_t L,
         nmod_mat_solve_tril_recursive(X, L, B, unit);
     }
 }
+
+typedef struct
+{
+    nmod_mat_struct * X;
+    const nmod_mat_struct * L;
+    const nmod_mat_struct * B;
+    int unit;
+    slong num_blocks;
+}
+_solve_tril_arg_struct;
+
+/* the columns of X are independent; solve a block of them */
+static void
+_solve_tril_worker(slong i, void * varg)
+{
+    _solve_tril_arg_struct * arg = (_solve_tril_arg_struct *) varg;
+    slong n = arg->B->r, c = arg->B->c;
+    slong c1 = (i * c) / arg->num_blocks;
+    slong c2 = ((i + 1) * c) / arg->num_blocks;
+    nmod_mat_t XX, BB;
+
+    nmod_mat_window_init(XX, arg->X, 0, c1, n, c2);
+    nmod_mat_window_init(BB, arg->B, 0, c1, n, c2);
+
+    _nmod_mat_solve_tril(XX, arg->L, BB, arg->unit);
+
+    nmod_mat_window_clear(XX);
+    nmod_mat_window_clear(BB);
+}
+
+void
+nmod_mat_solve_tril(nmod_mat_t X, const nmod_mat_t L,
+                                    const nmod_mat_t B, int unit)
+{
+    slong num_threads = flint_get_num_threads();
+
+    if (num_threads > 1 && B->r >= NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF &&
+        B->c >= 2 * NMOD_MAT_SOLVE_TRI_COLS_CUTOFF)
+    {
+        _solve_tril_arg_struct arg;
+
+        arg.X = X;
+        arg.L = L;
+        arg.B = B;
+        arg.unit = unit;
+        arg.num_blocks = FLINT_MIN(num_threads,
+                                    B->c / NMOD_MAT_SOLVE_TRI_COLS_CUTOFF);
+
+        flint_parallel_do(_solve_tril_worker, &arg, arg.num_blocks,
+                                           num_threads, FLINT_PARALLEL_UNIFORM);
+    }
+    else
+    {
+        _nmod_mat_solve_tril(X, L, B, unit);
+    }
+}
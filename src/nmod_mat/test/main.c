@@ -24,6 +24,7 @@
 #include "t-concat_vertical.c"
 #include "t-det.c"
 #include "t-det_howell.c"
+#include "t-fwrite_fread_bin.c"
 #include "t-howell_form.c"
 #include "t-init_clear.c"
 #include "t-inv.c"
@@ -31,6 +32,7 @@
 #include "t-lu_classical.c"
 #include "t-lu_classical_delayed.c"
 #include "t-lu_recursive.c"
+#include "t-lu_tiled.c"
 #include "t-minpoly.c"
 #include "t-mul_blas.c"
 #include "t-mul.c"
@@ -73,6 +75,7 @@ test_struct tests[] =
     TEST_FUNCTION(nmod_mat_concat_vertical),
     TEST_FUNCTION(nmod_mat_det),
     TEST_FUNCTION(nmod_mat_det_howell),
+    TEST_FUNCTION(nmod_mat_fwrite_fread_bin),
     TEST_FUNCTION(nmod_mat_howell_form),
     TEST_FUNCTION(nmod_mat_init_clear),
     TEST_FUNCTION(nmod_mat_inv),
@@ -80,6 +83,7 @@ test_struct tests[] =
     TEST_FUNCTION(nmod_mat_lu_classical),
     TEST_FUNCTION(nmod_mat_lu_classical_delayed),
     TEST_FUNCTION(nmod_mat_lu_recursive),
+    TEST_FUNCTION(nmod_mat_lu_tiled),
     TEST_FUNCTION(nmod_mat_minpoly),
     TEST_FUNCTION(nmod_mat_mul_blas),
     TEST_FUNCTION(nmod_mat_mul),
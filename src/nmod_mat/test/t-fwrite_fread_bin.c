@@ -0,0 +1,253 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "test_helpers.h"
+#include "ulong_extras.h"
+#include "bin_io.h"
+#include "nmod_mat.h"
+
+TEST_FUNCTION_START(nmod_mat_fwrite_fread_bin, state)
+{
+    slong iter;
+
+/* assume tmpfile() is broken on windows */
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_mat_t A, B, V;
+        FILE * tmp;
+        char * buf;
+        long size;
+        size_t len;
+
+        nmod_mat_init(A, n_randint(state, 30), n_randint(state, 30), n_randtest_not_zero(state));
+        nmod_mat_init(B, n_randint(state, 30), n_randint(state, 30), n_randtest_not_zero(state));
+        nmod_mat_randtest(A, state);
+
+        tmp = tmpfile();
+        if (tmp == NULL)
+        {
+            flint_printf("FAIL (creating temporary file)\n");
+            flint_abort();
+        }
+
+        if (!nmod_mat_fwrite_bin(tmp, A) || !nmod_mat_fwrite_bin(tmp, A))
+        {
+            flint_printf("FAIL (write)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+
+        if (!nmod_mat_fread_bin(tmp, B) || B->mod.n != A->mod.n || !nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL (roundtrip)\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            flint_abort();
+        }
+
+        /* two consecutive views of the bytes in memory */
+        size = ftell(tmp) * 2;
+        buf = flint_malloc(size);
+        rewind(tmp);
+        if (fread(buf, 1, size, tmp) != (size_t) size)
+        {
+            flint_printf("FAIL (reading back)\n");
+            flint_abort();
+        }
+
+        len = nmod_mat_bin_view_init(V, buf, size);
+        if (len != (size_t) size / 2 || V->mod.n != A->mod.n || !nmod_mat_equal(A, V))
+        {
+            flint_printf("FAIL (view)\n");
+            flint_abort();
+        }
+        nmod_mat_bin_view_clear(V);
+
+        if (nmod_mat_bin_view_init(V, buf + len, size - len) != len || !nmod_mat_equal(A, V))
+        {
+            flint_printf("FAIL (second view)\n");
+            flint_abort();
+        }
+        nmod_mat_bin_view_clear(V);
+
+        /* the same file written on a machine of the opposite endianness */
+        buf[6] = (buf[6] == 'L') ? 'B' : 'L';
+        flint_bin_swap_limbs((mp_ptr) (buf + FLINT_BIN_HEADER_SIZE),
+            (len - FLINT_BIN_HEADER_SIZE) / sizeof(mp_limb_t));
+
+        if (nmod_mat_bin_view_init(V, buf, len) != 0)
+        {
+            flint_printf("FAIL (view of foreign endianness)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+        fwrite(buf, 1, len, tmp);
+        rewind(tmp);
+
+        if (!nmod_mat_fread_bin(tmp, B) || !nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL (byte swapped)\n");
+            flint_abort();
+        }
+
+        fclose(tmp);
+        flint_free(buf);
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+    }
+
+    /* memory-mapped file */
+    {
+        const char * filename = "nmod_mat_fwrite_fread_bin.tmp";
+        flint_bin_map_t map;
+        nmod_mat_t A, V;
+        FILE * file;
+
+        nmod_mat_init(A, 1 + n_randint(state, 100), 1 + n_randint(state, 100), n_randtest_prime(state, 0));
+        nmod_mat_randtest(A, state);
+
+        file = fopen(filename, "wb");
+        if (file == NULL || !nmod_mat_fwrite_bin(file, A) || fclose(file) != 0)
+        {
+            flint_printf("FAIL (writing %s)\n", filename);
+            flint_abort();
+        }
+
+        if (!flint_bin_map_init(map, filename) ||
+            nmod_mat_bin_view_init(V, map->data, map->size) != map->size ||
+            !nmod_mat_equal(A, V))
+        {
+            flint_printf("FAIL (mapped view)\n");
+            flint_abort();
+        }
+
+        nmod_mat_bin_view_clear(V);
+        flint_bin_map_clear(map);
+        remove(filename);
+
+        nmod_mat_clear(A);
+    }
+
+    /* matrices above FLINT_BIN_READ_CHUNK entries, complete and truncated */
+    {
+        nmod_mat_t A, B, W;
+        FILE * tmp;
+        slong n = 260 + n_randint(state, 20);
+        mp_limb_t r = n;
+
+        nmod_mat_init(A, n, n, n_randtest_not_zero(state));
+        nmod_mat_init(B, 0, 0, 2);
+        nmod_mat_randtest(A, state);
+
+        tmp = tmpfile();
+        if (tmp == NULL || !nmod_mat_fwrite_bin(tmp, A))
+        {
+            flint_printf("FAIL (write large)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+        if (!nmod_mat_fread_bin(tmp, B) || !nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL (roundtrip large)\n");
+            flint_abort();
+        }
+
+        /* drop the last row but keep the full row count in the header */
+        fclose(tmp);
+        tmp = tmpfile();
+        nmod_mat_window_init(W, A, 0, 0, n - 1, n);
+        if (tmp == NULL || !nmod_mat_fwrite_bin(tmp, W))
+        {
+            flint_printf("FAIL (write large)\n");
+            flint_abort();
+        }
+        nmod_mat_window_clear(W);
+
+        fseek(tmp, FLINT_BIN_HEADER_SIZE + sizeof(mp_limb_t), SEEK_SET);
+        flint_bin_fwrite_limbs(tmp, &r, 1);
+        rewind(tmp);
+
+        nmod_mat_clear(B);
+        nmod_mat_init(B, 0, 0, 2);
+        if (nmod_mat_fread_bin(tmp, B))
+        {
+            flint_printf("FAIL (truncated large)\n");
+            flint_abort();
+        }
+
+        fclose(tmp);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+    }
+
+    /* sizes in a corrupt header must not be trusted */
+    {
+        mp_limb_t w[4] = { 7, UWORD(1) << 31, UWORD(1) << 31, 1 };
+        FILE * tmp = tmpfile();
+        nmod_mat_t B;
+
+        if (tmp == NULL || !flint_bin_fwrite_header(tmp, FLINT_BIN_NMOD_MAT) ||
+            !flint_bin_fwrite_limbs(tmp, w, 4))
+        {
+            flint_printf("FAIL (writing corrupt header)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+        nmod_mat_init(B, 0, 0, 2);
+
+        if (nmod_mat_fread_bin(tmp, B))
+        {
+            flint_printf("FAIL (corrupt header)\n");
+            flint_abort();
+        }
+
+        nmod_mat_clear(B);
+        fclose(tmp);
+    }
+
+    /* no columns but a huge number of rows */
+    {
+        mp_limb_t w[4] = { 7, WORD_MAX, 0, 1 };
+        FILE * tmp = tmpfile();
+        nmod_mat_t B;
+
+        if (tmp == NULL || !flint_bin_fwrite_header(tmp, FLINT_BIN_NMOD_MAT) ||
+            !flint_bin_fwrite_limbs(tmp, w, 4))
+        {
+            flint_printf("FAIL (writing corrupt header)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+        nmod_mat_init(B, 0, 0, 2);
+
+        if (nmod_mat_fread_bin(tmp, B))
+        {
+            flint_printf("FAIL (corrupt header)\n");
+            flint_abort();
+        }
+
+        nmod_mat_clear(B);
+        fclose(tmp);
+    }
+
+#endif
+
+    TEST_FUNCTION_END(state);
+}
@@ -13,7 +13,8 @@
 #include "ulong_extras.h"
 #include "nmod_mat.h"
 
-/* Defined in t-lu_classical.c, t-lu_classical_delayed.c and t-lu_recursive.c */
+/* Defined in t-lu_classical.c, t-lu_classical_delayed.c, t-lu_recursive.c and
+   t-lu_tiled.c */
 #ifndef perm
 #define perm perm
 void perm(nmod_mat_t A, slong * P)
@@ -33,7 +34,8 @@ void perm(nmod_mat_t A, slong * P)
 }
 #endif
 
-/* Defined in t-lu_classical.c, t-lu_classical_delayed.c and t-lu_recursive.c */
+/* Defined in t-lu_classical.c, t-lu_classical_delayed.c, t-lu_recursive.c and
+   t-lu_tiled.c */
 #ifndef check
 #define check check
 void check(slong * P, nmod_mat_t LU, const nmod_mat_t A, slong rank)
@@ -29,6 +29,8 @@ TEST_FUNCTION_START(nmod_mat_solve_triu, state)
         cols = n_randint(state, 200);
         unit = n_randint(state, 2);
 
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
         nmod_mat_init(A, rows, rows, m);
         nmod_mat_init(B, rows, cols, m);
         nmod_mat_init(X, rows, cols, m);
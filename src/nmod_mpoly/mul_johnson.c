@@ -32,12 +32,17 @@ slong _nmod_mpoly_mul_johnson1(
     slong * hind;
     ulong exp;
     ulong acc0, acc1, acc2, pp0, pp1;
+    int quad;
     TMP_INIT;
 
     TMP_START;
 
     next_loc = len2 + 4;   /* something bigger than heap can ever be */
-    heap = (mpoly_heap1_s *) TMP_ALLOC((len2 + 1)*sizeof(mpoly_heap1_s));
+    /* large heaps are 4-ary, aligned so that siblings share a cache line */
+    quad = len2 > MPOLY_HEAP4_CUTOFF;
+    heap = (mpoly_heap1_s *) TMP_ALLOC((len2 + 1 + MPOLY_HEAP4_PAD)*
+                                                 sizeof(mpoly_heap1_s));
+    heap = MPOLY_HEAP4_ALIGN(heap);
     chain = (mpoly_heap_t *) TMP_ALLOC(len2*sizeof(mpoly_heap_t));
     Q = (slong *) TMP_ALLOC(2*len2*sizeof(slong));
 
@@ -68,7 +73,8 @@ slong _nmod_mpoly_mul_johnson1(
         acc0 = acc1 = acc2 = 0;
         do
         {
-            x = _mpoly_heap_pop1(heap, &heap_len, maskhi);
+            x = quad ? _mpoly_heap4_pop1(heap, &heap_len, maskhi)
+                     : _mpoly_heap_pop1(heap, &heap_len, maskhi);
 
             hind[x->i] |= WORD(1);
             Q[Q_len++] = x->i;
@@ -105,8 +111,12 @@ slong _nmod_mpoly_mul_johnson1(
                 x->next = NULL;
 
                 hind[x->i] = 2*(x->j + 1) + 0;
-                _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j], x,
-                                                 &next_loc, &heap_len, maskhi);
+                if (quad)
+                    _mpoly_heap4_insert1(heap, exp2[x->i] + exp3[x->j], x,
+                                             &next_loc, &heap_len, maskhi);
+                else
+                    _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j], x,
+                                             &next_loc, &heap_len, maskhi);
             }
 
             /* should we go up? */
@@ -123,8 +133,12 @@ slong _nmod_mpoly_mul_johnson1(
                 x->next = NULL;
 
                 hind[x->i] = 2*(x->j + 1) + 0;
-                _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j], x,
-                                                 &next_loc, &heap_len, maskhi);
+                if (quad)
+                    _mpoly_heap4_insert1(heap, exp2[x->i] + exp3[x->j], x,
+                                             &next_loc, &heap_len, maskhi);
+                else
+                    _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j], x,
+                                             &next_loc, &heap_len, maskhi);
             }
         }
     }
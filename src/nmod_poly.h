@@ -308,8 +308,15 @@ int nmod_poly_fprint(FILE * f, const nmod_poly_t poly);
 int nmod_poly_fprint_pretty(FILE * f, const nmod_poly_t a, const char * x);
 
 int nmod_poly_fread(FILE * f, nmod_poly_t poly);
+
+int nmod_poly_fwrite_bin(FILE * file, const nmod_poly_t poly);
+int nmod_poly_fread_bin(FILE * file, nmod_poly_t poly);
 #endif
 
+size_t nmod_poly_bin_view_init(nmod_poly_t poly, const char * data, size_t size);
+void nmod_poly_bin_view_clear(nmod_poly_t poly);
+
+
 int nmod_poly_print(const nmod_poly_t a);
 int nmod_poly_print_pretty(const nmod_poly_t a, const char * x);
 
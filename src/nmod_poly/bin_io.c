@@ -0,0 +1,111 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "bin_io.h"
+#include "nmod.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+int
+nmod_poly_fwrite_bin(FILE * file, const nmod_poly_t poly)
+{
+    mp_limb_t w[2];
+
+    w[0] = poly->mod.n;
+    w[1] = poly->length;
+
+    return flint_bin_fwrite_header(file, FLINT_BIN_NMOD_POLY) &&
+           flint_bin_fwrite_limbs(file, w, 2) &&
+           flint_bin_fwrite_limbs(file, poly->coeffs, poly->length);
+}
+
+int
+nmod_poly_fread_bin(FILE * file, nmod_poly_t poly)
+{
+    mp_limb_t w[2];
+    slong i, len, done, k;
+    int swap;
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_NMOD_POLY, &swap) ||
+        !flint_bin_fread_limbs(file, w, 2, swap) || w[0] == 0 || (slong) w[1] < 0)
+        return 0;
+
+    len = w[1];
+
+    if (poly->mod.n != w[0])
+    {
+        nmod_poly_clear(poly);
+        nmod_poly_init(poly, w[0]);
+    }
+
+    /* len comes from the stream, so only grow poly as the data arrives */
+    for (done = 0; done < len; done += k)
+    {
+        k = FLINT_MIN(len - done, FLINT_MAX(done, FLINT_BIN_READ_CHUNK));
+        nmod_poly_fit_length(poly, done + k);
+
+        if (!flint_bin_fread_limbs(file, poly->coeffs + done, k, swap))
+        {
+            nmod_poly_zero(poly);
+            return 0;
+        }
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        if (poly->coeffs[i] >= poly->mod.n)
+        {
+            nmod_poly_zero(poly);
+            return 0;
+        }
+    }
+
+    poly->length = len;
+    _nmod_poly_normalise(poly);
+
+    return 1;
+}
+
+size_t
+nmod_poly_bin_view_init(nmod_poly_t poly, const char * data, size_t size)
+{
+    const mp_limb_t * w;
+    slong len;
+    int swap;
+
+    if (size < FLINT_BIN_HEADER_SIZE + 2 * sizeof(mp_limb_t) ||
+        ((size_t) data) % sizeof(mp_limb_t) != 0 ||
+        !flint_bin_check_header((const unsigned char *) data, FLINT_BIN_NMOD_POLY, &swap) ||
+        swap)
+        return 0;
+
+    w = (const mp_limb_t *) (data + FLINT_BIN_HEADER_SIZE);
+    len = w[1];
+
+    if (w[0] == 0 || len < 0 ||
+        (size_t) len > (size - FLINT_BIN_HEADER_SIZE) / sizeof(mp_limb_t) - 2)
+        return 0;
+
+    nmod_init(&poly->mod, w[0]);
+    poly->coeffs = (mp_ptr) (w + 2);
+    poly->alloc = 0;
+    poly->length = len;
+
+    return FLINT_BIN_HEADER_SIZE + (2 + len) * sizeof(mp_limb_t);
+}
+
+void
+nmod_poly_bin_view_clear(nmod_poly_t poly)
+{
+    poly->coeffs = NULL;
+    poly->length = 0;
+}
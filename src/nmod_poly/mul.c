@@ -51,7 +51,7 @@ void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1,
 
     if (poly1 == poly2 && len1 == len2)
     {
-        if (cutoff_len >= fft_sqr_tab[bits - 1])
+        if (cutoff_len >= fft_sqr_tab[bits - 1] && FFT_SMALL_AVAILABLE)
         {
             _nmod_poly_mul_mid_default_mpn_ctx(res, 0, len1 + len2 - 1, poly1, len1, poly2, len2, mod);
             return;
@@ -59,7 +59,7 @@ void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1,
     }
     else
     {
-        if (cutoff_len >= fft_mul_tab[bits - 1])
+        if (cutoff_len >= fft_mul_tab[bits - 1] && FFT_SMALL_AVAILABLE)
         {
             _nmod_poly_mul_mid_default_mpn_ctx(res, 0, len1 + len2 - 1, poly1, len1, poly2, len2, mod);
             return;
@@ -22,6 +22,8 @@ _nmod_poly_mul_classical(mp_ptr res, mp_srcptr poly1,
     slong i, j, bits, log_len, nlimbs, n1, n2;
     int squaring;
     mp_limb_t c;
+    mp_ptr rev;
+    TMP_INIT;
 
     if (len1 == 1)
     {
@@ -86,6 +88,19 @@ _nmod_poly_mul_classical(mp_ptr res, mp_srcptr poly1,
     else
         nlimbs = 3;
 
+    /* the coefficients are dot products with one operand reversed; when
+       they are long enough for the vectorised code in _nmod_vec_dot, make
+       a reversed copy so that both operands run forwards */
+    rev = NULL;
+    TMP_START;
+
+    if ((squaring ? len1 / 2 : len2) >= _nmod_vec_dot_simd_cutoff(mod))
+    {
+        rev = TMP_ALLOC(len2 * sizeof(mp_limb_t));
+        for (j = 0; j < len2; j++)
+            rev[j] = poly2[len2 - 1 - j];
+    }
+
     if (squaring)
     {
         for (i = 0; i < 2 * len1 - 1; i++)
@@ -93,7 +108,12 @@ _nmod_poly_mul_classical(mp_ptr res, mp_srcptr poly1,
             n1 = FLINT_MAX(0, i - len1 + 1);
             n2 = FLINT_MIN(len1 - 1, (i + 1) / 2 - 1);
 
-            c = _nmod_vec_dot_rev(poly1 + n1, poly1 + i - n2, n2 - n1 + 1, mod, nlimbs);
+            if (rev != NULL)
+                c = _nmod_vec_dot(poly1 + n1, rev + len1 - 1 - i + n1,
+                                                    n2 - n1 + 1, mod, nlimbs);
+            else
+                c = _nmod_vec_dot_rev(poly1 + n1, poly1 + i - n2,
+                                                    n2 - n1 + 1, mod, nlimbs);
             c = nmod_add(c, c, mod);
 
             if (i % 2 == 0 && i / 2 < len1)
@@ -109,11 +129,18 @@ _nmod_poly_mul_classical(mp_ptr res, mp_srcptr poly1,
             n1 = FLINT_MIN(len1 - 1, i);
             n2 = FLINT_MIN(len2 - 1, i);
 
-            res[i] = _nmod_vec_dot_rev(poly1 + i - n2,
+            if (rev != NULL)
+                res[i] = _nmod_vec_dot(poly1 + i - n2,
+                                       rev + len2 - 1 - n2,
+                                       n1 + n2 - i + 1, mod, nlimbs);
+            else
+                res[i] = _nmod_vec_dot_rev(poly1 + i - n2,
                                        poly2 + i - n1,
                                        n1 + n2 - i + 1, mod, nlimbs);
         }
     }
+
+    TMP_END;
 }
 
 void
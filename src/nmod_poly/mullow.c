@@ -53,7 +53,7 @@ void _nmod_poly_mullow(mp_ptr res, mp_srcptr poly1, slong len1,
 
 #ifdef FLINT_HAVE_FFT_SMALL
 
-    if (len2 >= fft_mullow_tab[bits - 1])
+    if (len2 >= fft_mullow_tab[bits - 1] && FFT_SMALL_AVAILABLE)
     {
         _nmod_poly_mul_mid_default_mpn_ctx(res, 0, n, poly1, len1, poly2, len2, mod);
         return;
@@ -56,6 +56,7 @@
 #include "t-exp_series.c"
 #include "t-find_distinct_nonzero_roots.c"
 #include "t-fread_print.c"
+#include "t-fwrite_fread_bin.c"
 #include "t-gcd.c"
 #include "t-gcd_euclidean.c"
 #include "t-gcd_hgcd.c"
@@ -177,6 +178,7 @@ test_struct tests[] =
     TEST_FUNCTION(nmod_poly_exp_series),
     TEST_FUNCTION(nmod_poly_find_distinct_nonzero_roots),
     TEST_FUNCTION(nmod_poly_fread_print),
+    TEST_FUNCTION(nmod_poly_fwrite_fread_bin),
     TEST_FUNCTION(nmod_poly_gcd),
     TEST_FUNCTION(nmod_poly_gcd_euclidean),
     TEST_FUNCTION(nmod_poly_gcd_hgcd),
@@ -0,0 +1,121 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "test_helpers.h"
+#include "bin_io.h"
+#include "ulong_extras.h"
+#include "nmod_poly.h"
+
+TEST_FUNCTION_START(nmod_poly_fwrite_fread_bin, state)
+{
+    slong iter;
+
+/* assume tmpfile() is broken on windows */
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_t a, b, v;
+        FILE * tmp;
+        char * buf;
+        long size;
+
+        nmod_poly_init(a, n_randtest_not_zero(state));
+        nmod_poly_init(b, n_randtest_not_zero(state));
+        nmod_poly_randtest(a, state, n_randint(state, 100));
+        nmod_poly_randtest(b, state, n_randint(state, 100));
+
+        tmp = tmpfile();
+        if (tmp == NULL)
+        {
+            flint_printf("FAIL (creating temporary file)\n");
+            flint_abort();
+        }
+
+        if (!nmod_poly_fwrite_bin(tmp, a))
+        {
+            flint_printf("FAIL (write)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+
+        if (!nmod_poly_fread_bin(tmp, b) || b->mod.n != a->mod.n || !nmod_poly_equal(a, b))
+        {
+            flint_printf("FAIL (roundtrip)\n");
+            nmod_poly_print(a); flint_printf("\n");
+            nmod_poly_print(b); flint_printf("\n");
+            flint_abort();
+        }
+
+        /* view of the bytes in memory */
+        size = ftell(tmp);
+        buf = flint_malloc(size);
+        rewind(tmp);
+        if (fread(buf, 1, size, tmp) != (size_t) size)
+        {
+            flint_printf("FAIL (reading back)\n");
+            flint_abort();
+        }
+
+        if (nmod_poly_bin_view_init(v, buf, size) != (size_t) size ||
+            v->mod.n != a->mod.n || !nmod_poly_equal(a, v))
+        {
+            flint_printf("FAIL (view)\n");
+            flint_abort();
+        }
+
+        nmod_poly_bin_view_clear(v);
+
+        if (nmod_poly_bin_view_init(v, buf, size - 1) != 0)
+        {
+            flint_printf("FAIL (truncated view)\n");
+            flint_abort();
+        }
+
+        fclose(tmp);
+        flint_free(buf);
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+    }
+
+    /* sizes in a corrupt header must not be trusted */
+    {
+        mp_limb_t w[3] = { 7, WORD_MAX, 1 };
+        FILE * tmp = tmpfile();
+        nmod_poly_t b;
+
+        if (tmp == NULL || !flint_bin_fwrite_header(tmp, FLINT_BIN_NMOD_POLY) ||
+            !flint_bin_fwrite_limbs(tmp, w, 3))
+        {
+            flint_printf("FAIL (writing corrupt header)\n");
+            flint_abort();
+        }
+
+        rewind(tmp);
+        nmod_poly_init(b, 2);
+
+        if (nmod_poly_fread_bin(tmp, b) || b->length != 0)
+        {
+            flint_printf("FAIL (corrupt header)\n");
+            flint_abort();
+        }
+
+        nmod_poly_clear(b);
+        fclose(tmp);
+    }
+
+#endif
+
+    TEST_FUNCTION_END(state);
+}
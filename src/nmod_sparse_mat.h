@@ -0,0 +1,149 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef NMOD_SPARSE_MAT_H
+#define NMOD_SPARSE_MAT_H
+
+#ifdef NMOD_SPARSE_MAT_INLINES_C
+#define NMOD_SPARSE_MAT_INLINE
+#else
+#define NMOD_SPARSE_MAT_INLINE static inline
+#endif
+
+#include "nmod_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Compressed sparse row storage: the nonzero entries of row i are
+   entries[rows[i]], ..., entries[rows[i + 1] - 1], in columns
+   cols[rows[i]] < ... < cols[rows[i + 1] - 1]. */
+typedef struct
+{
+    slong r;
+    slong c;
+    slong * rows;
+    slong * cols;
+    mp_limb_t * entries;
+    slong alloc;
+    nmod_t mod;
+}
+nmod_sparse_mat_struct;
+
+typedef nmod_sparse_mat_struct nmod_sparse_mat_t[1];
+
+/* Record of a structured Gaussian elimination, see nmod_sparse_mat_sge */
+typedef struct
+{
+    nmod_sparse_mat_struct prows;
+    slong * pcols;
+    slong * rows;
+    slong * cols;
+    slong nrows;
+    slong ncols;
+}
+nmod_sparse_mat_sge_struct;
+
+typedef nmod_sparse_mat_sge_struct nmod_sparse_mat_sge_t[1];
+
+/* Default block size of the block Wiedemann algorithm */
+#define NMOD_SPARSE_MAT_BW_BLOCK_SIZE 8
+
+/* Matrices whose reduced form has at most this many entries are handled
+   with dense linear algebra */
+#define NMOD_SPARSE_MAT_DENSE_CUTOFF 1000000
+
+/* Number of nonzero entries above which products are split between
+   threads */
+#define NMOD_SPARSE_MAT_MUL_THREAD_CUTOFF 20000
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nrows(const nmod_sparse_mat_t A)
+{
+    return A->r;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_ncols(const nmod_sparse_mat_t A)
+{
+    return A->c;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nnz(const nmod_sparse_mat_t A)
+{
+    return A->rows[A->r];
+}
+
+/* Memory management */
+
+void nmod_sparse_mat_init(nmod_sparse_mat_t A, slong rows, slong cols, mp_limb_t n);
+void nmod_sparse_mat_clear(nmod_sparse_mat_t A);
+void nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t A, slong nnz);
+
+NMOD_SPARSE_MAT_INLINE
+void nmod_sparse_mat_swap(nmod_sparse_mat_t A, nmod_sparse_mat_t B)
+{
+    FLINT_SWAP(nmod_sparse_mat_struct, *A, *B);
+}
+
+/* Basic manipulation */
+
+void nmod_sparse_mat_zero(nmod_sparse_mat_t A);
+void nmod_sparse_mat_set(nmod_sparse_mat_t B, const nmod_sparse_mat_t A);
+int nmod_sparse_mat_equal(const nmod_sparse_mat_t A, const nmod_sparse_mat_t B);
+mp_limb_t nmod_sparse_mat_get_entry(const nmod_sparse_mat_t A, slong i, slong j);
+
+void nmod_sparse_mat_set_coo(nmod_sparse_mat_t A, const slong * ri,
+    const slong * ci, mp_srcptr v, slong nnz);
+void nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t A, const nmod_mat_t B);
+void nmod_sparse_mat_get_nmod_mat(nmod_mat_t B, const nmod_sparse_mat_t A);
+
+void nmod_sparse_mat_transpose(nmod_sparse_mat_t B, const nmod_sparse_mat_t A);
+
+void nmod_sparse_mat_randtest(nmod_sparse_mat_t A, flint_rand_t state, slong max_row_nnz);
+
+/* Products */
+
+void _nmod_sparse_mat_split_rows(slong * bounds, const nmod_sparse_mat_t A, slong num);
+
+void nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x);
+void nmod_sparse_mat_mul_nmod_mat(nmod_mat_t Y, const nmod_sparse_mat_t A, const nmod_mat_t X);
+
+/* Structured Gaussian elimination */
+
+void nmod_sparse_mat_sge_init(nmod_sparse_mat_sge_t E, mp_limb_t n);
+void nmod_sparse_mat_sge_clear(nmod_sparse_mat_sge_t E);
+
+void _nmod_sparse_mat_sge(nmod_sparse_mat_t B, nmod_sparse_mat_sge_t E,
+    const nmod_sparse_mat_t A, slong cmax);
+void nmod_sparse_mat_sge(nmod_sparse_mat_t B, nmod_sparse_mat_sge_t E,
+    const nmod_sparse_mat_t A);
+void nmod_sparse_mat_sge_lift(mp_ptr x, const nmod_sparse_mat_sge_t E, mp_srcptr y);
+
+/* Block Wiedemann */
+
+slong nmod_sparse_mat_nullspace_block_wiedemann(nmod_mat_t X,
+    const nmod_sparse_mat_t A, slong block_size, flint_rand_t state);
+
+/* Rank, nullspace and solving */
+
+slong _nmod_sparse_mat_nullspace(nmod_mat_t X, const nmod_sparse_mat_t A, flint_rand_t state);
+slong nmod_sparse_mat_nullspace(nmod_mat_t X, const nmod_sparse_mat_t A, flint_rand_t state);
+slong nmod_sparse_mat_rank(const nmod_sparse_mat_t A, flint_rand_t state);
+int nmod_sparse_mat_solve(mp_ptr x, const nmod_sparse_mat_t A, mp_srcptr b, flint_rand_t state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,24 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t A, slong nnz)
+{
+    if (nnz > A->alloc)
+    {
+        nnz = FLINT_MAX(nnz, 2 * A->alloc);
+        A->cols = flint_realloc(A->cols, nnz * sizeof(slong));
+        A->entries = flint_realloc(A->entries, nnz * sizeof(mp_limb_t));
+        A->alloc = nnz;
+    }
+}
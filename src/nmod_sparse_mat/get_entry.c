@@ -0,0 +1,31 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+mp_limb_t
+nmod_sparse_mat_get_entry(const nmod_sparse_mat_t A, slong i, slong j)
+{
+    slong lo = A->rows[i], hi = A->rows[i + 1], mid;
+
+    /* binary search in the sorted columns of row i */
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+
+        if (A->cols[mid] < j)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return (lo < A->rows[i + 1] && A->cols[lo] == j) ? A->entries[lo] : 0;
+}
@@ -0,0 +1,100 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "nmod.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+static void
+_nmod_sparse_mat_mul_nmod_mat_rows(nmod_mat_t Y, const nmod_sparse_mat_t A,
+    const nmod_mat_t X, slong start, slong stop)
+{
+    slong i, j, l, len, maxlen;
+    const slong * c;
+    mp_srcptr e;
+    mp_ptr const * Xr = X->rows;
+    int nlimbs;
+
+    maxlen = 0;
+    for (i = start; i < stop; i++)
+        maxlen = FLINT_MAX(maxlen, A->rows[i + 1] - A->rows[i]);
+
+    nlimbs = FLINT_MAX(1, _nmod_vec_dot_bound_limbs(maxlen, A->mod));
+
+    for (i = start; i < stop; i++)
+    {
+        c = A->cols + A->rows[i];
+        e = A->entries + A->rows[i];
+        len = A->rows[i + 1] - A->rows[i];
+
+        for (l = 0; l < X->c; l++)
+            NMOD_VEC_DOT(Y->rows[i][l], j, len, e[j], Xr[c[j]][l], A->mod, nlimbs);
+    }
+}
+
+typedef struct
+{
+    nmod_mat_struct * Y;
+    const nmod_sparse_mat_struct * A;
+    const nmod_mat_struct * X;
+    const slong * bounds;
+}
+mul_mat_work_t;
+
+static void
+mul_mat_worker(slong t, void * varg)
+{
+    mul_mat_work_t * work = (mul_mat_work_t *) varg;
+
+    _nmod_sparse_mat_mul_nmod_mat_rows(work->Y, work->A, work->X,
+        work->bounds[t], work->bounds[t + 1]);
+}
+
+void
+nmod_sparse_mat_mul_nmod_mat(nmod_mat_t Y, const nmod_sparse_mat_t A, const nmod_mat_t X)
+{
+    mul_mat_work_t work;
+    slong * bounds;
+    slong num;
+
+    if (Y == X)
+    {
+        nmod_mat_t T;
+        nmod_mat_init(T, Y->r, Y->c, Y->mod.n);
+        nmod_sparse_mat_mul_nmod_mat(T, A, X);
+        nmod_mat_swap_entrywise(Y, T);
+        nmod_mat_clear(T);
+        return;
+    }
+
+    num = flint_get_num_threads();
+
+    if (num <= 1 || nmod_sparse_mat_nnz(A) * X->c < NMOD_SPARSE_MAT_MUL_THREAD_CUTOFF)
+    {
+        _nmod_sparse_mat_mul_nmod_mat_rows(Y, A, X, 0, A->r);
+        return;
+    }
+
+    num = FLINT_MIN(4 * num, A->r);
+    bounds = flint_malloc((num + 1) * sizeof(slong));
+    _nmod_sparse_mat_split_rows(bounds, A, num);
+
+    work.Y = Y;
+    work.A = A;
+    work.X = X;
+    work.bounds = bounds;
+
+    flint_parallel_do(mul_mat_worker, &work, num, -1, FLINT_PARALLEL_DYNAMIC);
+
+    flint_free(bounds);
+}
@@ -0,0 +1,88 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "nmod.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+static void
+_nmod_sparse_mat_mul_vec_rows(mp_ptr y, const nmod_sparse_mat_t A,
+    mp_srcptr x, slong start, slong stop)
+{
+    slong i, j, len, maxlen;
+    const slong * c;
+    mp_srcptr e;
+    int nlimbs;
+
+    maxlen = 0;
+    for (i = start; i < stop; i++)
+        maxlen = FLINT_MAX(maxlen, A->rows[i + 1] - A->rows[i]);
+
+    nlimbs = FLINT_MAX(1, _nmod_vec_dot_bound_limbs(maxlen, A->mod));
+
+    for (i = start; i < stop; i++)
+    {
+        c = A->cols + A->rows[i];
+        e = A->entries + A->rows[i];
+        len = A->rows[i + 1] - A->rows[i];
+
+        NMOD_VEC_DOT(y[i], j, len, e[j], x[c[j]], A->mod, nlimbs);
+    }
+}
+
+typedef struct
+{
+    mp_ptr y;
+    const nmod_sparse_mat_struct * A;
+    mp_srcptr x;
+    const slong * bounds;
+}
+mul_vec_work_t;
+
+static void
+mul_vec_worker(slong t, void * varg)
+{
+    mul_vec_work_t * work = (mul_vec_work_t *) varg;
+
+    _nmod_sparse_mat_mul_vec_rows(work->y, work->A, work->x,
+        work->bounds[t], work->bounds[t + 1]);
+}
+
+void
+nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x)
+{
+    mul_vec_work_t work;
+    slong * bounds;
+    slong num;
+
+    num = flint_get_num_threads();
+
+    if (num <= 1 || nmod_sparse_mat_nnz(A) < NMOD_SPARSE_MAT_MUL_THREAD_CUTOFF)
+    {
+        _nmod_sparse_mat_mul_vec_rows(y, A, x, 0, A->r);
+        return;
+    }
+
+    /* a few blocks per thread to even out the load */
+    num = FLINT_MIN(4 * num, A->r);
+    bounds = flint_malloc((num + 1) * sizeof(slong));
+    _nmod_sparse_mat_split_rows(bounds, A, num);
+
+    work.y = y;
+    work.A = A;
+    work.x = x;
+    work.bounds = bounds;
+
+    flint_parallel_do(mul_vec_worker, &work, num, -1, FLINT_PARALLEL_DYNAMIC);
+
+    flint_free(bounds);
+}
@@ -0,0 +1,200 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+/* Basis of the kernel of A as the columns of X, without elimination. Empty
+   columns give unit vectors directly; the remaining columns are handled
+   densely when small and by rounds of block Wiedemann otherwise, until two
+   consecutive rounds do not enlarge the span found so far. A round returns
+   at most block size vectors, so the block size is doubled after a round
+   that found that many, and before the second round of a confirmation. */
+slong
+_nmod_sparse_mat_nullspace(nmod_mat_t X, const nmod_sparse_mat_t A, flint_rand_t state)
+{
+    slong r = A->r, c = A->c;
+    slong i, j, k, nz, dim, bs, nullity;
+    slong * cmap, * cols;
+    nmod_sparse_mat_t C;
+    nmod_mat_t K, Z;
+
+    /* nonempty columns */
+    cmap = flint_malloc(FLINT_MAX(c, 1) * sizeof(slong));
+    cols = flint_malloc(FLINT_MAX(c, 1) * sizeof(slong));
+
+    for (j = 0; j < c; j++)
+        cmap[j] = -1;
+    for (k = 0; k < nmod_sparse_mat_nnz(A); k++)
+        cmap[A->cols[k]] = 0;
+
+    nz = 0;
+    for (j = 0; j < c; j++)
+    {
+        if (cmap[j] == 0)
+        {
+            cmap[j] = nz;
+            cols[nz++] = j;
+        }
+    }
+
+    nmod_sparse_mat_init(C, r, nz, A->mod.n);
+    nmod_sparse_mat_fit_nnz(C, nmod_sparse_mat_nnz(A));
+    for (i = 0; i <= r; i++)
+        C->rows[i] = A->rows[i];
+    for (k = 0; k < nmod_sparse_mat_nnz(A); k++)
+    {
+        C->cols[k] = cmap[A->cols[k]];
+        C->entries[k] = A->entries[k];
+    }
+
+    /* kernel of C, as the rows of K */
+    if (r * nz <= NMOD_SPARSE_MAT_DENSE_CUTOFF)
+    {
+        nmod_mat_t D;
+
+        nmod_mat_init(D, r, nz, A->mod.n);
+        nmod_mat_init(Z, nz, nz, A->mod.n);
+        nmod_sparse_mat_get_nmod_mat(D, C);
+        dim = nmod_mat_nullspace(Z, D);
+
+        nmod_mat_init(K, dim, nz, A->mod.n);
+        for (i = 0; i < dim; i++)
+            for (j = 0; j < nz; j++)
+                nmod_mat_entry(K, i, j) = nmod_mat_entry(Z, j, i);
+
+        nmod_mat_clear(D);
+        nmod_mat_clear(Z);
+    }
+    else
+    {
+        nmod_mat_t T;
+        int grown, confirm = 0;
+
+        nmod_mat_init(K, 0, nz, A->mod.n);
+        nmod_mat_init(Z, nz, 0, A->mod.n);
+        dim = 0;
+        bs = NMOD_SPARSE_MAT_BW_BLOCK_SIZE;
+
+        while (1)
+        {
+            k = nmod_sparse_mat_nullspace_block_wiedemann(Z, C, bs, state);
+            grown = 0;
+
+            if (k != 0)
+            {
+                if (k == bs)
+                    bs = FLINT_MIN(2 * bs, 64);
+
+                nmod_mat_init(T, dim + k, nz, A->mod.n);
+                for (i = 0; i < dim; i++)
+                    _nmod_vec_set(T->rows[i], K->rows[i], nz);
+                for (i = 0; i < k; i++)
+                    for (j = 0; j < nz; j++)
+                        nmod_mat_entry(T, dim + i, j) = nmod_mat_entry(Z, j, i);
+
+                k = nmod_mat_rref(T);
+
+                if (k > dim)
+                {
+                    nmod_mat_clear(K);
+                    nmod_mat_init(K, k, nz, A->mod.n);
+                    for (i = 0; i < k; i++)
+                        _nmod_vec_set(K->rows[i], T->rows[i], nz);
+                    dim = k;
+                    grown = 1;
+                }
+
+                nmod_mat_clear(T);
+            }
+
+            if (grown)
+            {
+                confirm = 0;
+                continue;
+            }
+
+            /* a round can miss kernel vectors, so the span is only taken
+               to be complete once a second round, with a larger block,
+               does not enlarge it either */
+            if (confirm)
+                break;
+
+            confirm = 1;
+            bs = FLINT_MIN(2 * bs, 64);
+        }
+
+        nmod_mat_clear(Z);
+    }
+
+    nullity = dim + (c - nz);
+
+    nmod_mat_clear(X);
+    nmod_mat_init(X, c, nullity, A->mod.n);
+
+    for (i = 0; i < dim; i++)
+        for (j = 0; j < nz; j++)
+            nmod_mat_entry(X, cols[j], i) = nmod_mat_entry(K, i, j);
+
+    for (j = 0, k = dim; j < c; j++)
+        if (cmap[j] == -1)
+            nmod_mat_entry(X, j, k++) = 1;
+
+    nmod_mat_clear(K);
+    nmod_sparse_mat_clear(C);
+    flint_free(cmap);
+    flint_free(cols);
+
+    return nullity;
+}
+
+slong
+nmod_sparse_mat_nullspace(nmod_mat_t X, const nmod_sparse_mat_t A, flint_rand_t state)
+{
+    nmod_sparse_mat_t B;
+    nmod_sparse_mat_sge_t E;
+    nmod_mat_t Y;
+    mp_ptr x, y;
+    slong i, j, nullity;
+
+    nmod_sparse_mat_init(B, 0, 0, A->mod.n);
+    nmod_sparse_mat_sge_init(E, A->mod.n);
+    nmod_mat_init(Y, 0, 0, A->mod.n);
+
+    nmod_sparse_mat_sge(B, E, A);
+    nullity = _nmod_sparse_mat_nullspace(Y, B, state);
+
+    nmod_mat_clear(X);
+    nmod_mat_init(X, A->c, nullity, A->mod.n);
+
+    x = _nmod_vec_init(A->c);
+    y = _nmod_vec_init(B->c);
+
+    for (i = 0; i < nullity; i++)
+    {
+        for (j = 0; j < B->c; j++)
+            y[j] = nmod_mat_entry(Y, j, i);
+
+        nmod_sparse_mat_sge_lift(x, E, y);
+
+        for (j = 0; j < A->c; j++)
+            nmod_mat_entry(X, j, i) = x[j];
+    }
+
+    _nmod_vec_clear(x);
+    _nmod_vec_clear(y);
+    nmod_mat_clear(Y);
+    nmod_sparse_mat_sge_clear(E);
+    nmod_sparse_mat_clear(B);
+
+    return nullity;
+}
@@ -0,0 +1,498 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <stdlib.h>
+#include "ulong_extras.h"
+#include "nmod.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+/*
+  Block Wiedemann (Coppersmith) on the square N x N operator B described
+  below, with N = A->c.
+
+  For random blocks X (N x m) and Y (N x n) we compute the sequence
+  S_i = X^T B^(i + 1) Y for i < L and a generator of it: polynomials
+  g = sum_k g_k x^k in K[x]^n of degree d with
+
+    sum_k S_(i + d - k) g_k = 0    for 0 <= i < L - d.
+
+  These are found as columns (g, h) of an order basis of [S(x) | -I] to
+  order L, computed with the iterative mbasis algorithm, where d is the
+  shifted degree max(deg g, deg h + 1). The vector
+  w = sum_k B^(deg g - k) Y g_k then satisfies X^T B^i B^(d - deg g + 1) w = 0
+  for many i, so that B^(d - deg g + 1) w = 0 with high probability, and the
+  last nonzero vector among w, B w, B^2 w, ... lies in the kernel of B.
+*/
+
+/* B = A if A is square, A padded with zero rows if it has fewer rows than
+   columns, and A^T D A for a random diagonal matrix D otherwise. The kernel
+   of B contains that of A, and is equal to it with high probability. */
+typedef struct
+{
+    const nmod_sparse_mat_struct * A;
+    nmod_sparse_mat_t At;
+    mp_ptr diag;
+    nmod_mat_t T;
+}
+bw_op_struct;
+
+static void
+bw_op_init(bw_op_struct * B, const nmod_sparse_mat_t A, flint_rand_t state)
+{
+    slong i;
+
+    B->A = A;
+    B->diag = NULL;
+    nmod_sparse_mat_init(B->At, 0, 0, A->mod.n);
+    nmod_mat_init(B->T, 0, 0, A->mod.n);
+
+    if (A->r > A->c)
+    {
+        nmod_sparse_mat_transpose(B->At, A);
+        B->diag = _nmod_vec_init(A->r);
+        for (i = 0; i < A->r; i++)
+            B->diag[i] = 1 + n_randint(state, A->mod.n - 1);
+    }
+}
+
+static void
+bw_op_clear(bw_op_struct * B)
+{
+    nmod_sparse_mat_clear(B->At);
+    _nmod_vec_clear(B->diag);
+    nmod_mat_clear(B->T);
+}
+
+static void
+bw_op_apply(nmod_mat_t Y, bw_op_struct * B, const nmod_mat_t X)
+{
+    const nmod_sparse_mat_struct * A = B->A;
+    slong N = A->c, i;
+
+    if (A->r == N)
+    {
+        nmod_sparse_mat_mul_nmod_mat(Y, A, X);
+        return;
+    }
+
+    if (B->T->r != A->r || B->T->c != X->c)
+    {
+        nmod_mat_clear(B->T);
+        nmod_mat_init(B->T, A->r, X->c, A->mod.n);
+    }
+
+    nmod_sparse_mat_mul_nmod_mat(B->T, A, X);
+
+    if (A->r < N)
+    {
+        for (i = 0; i < N; i++)
+        {
+            if (i < A->r)
+                _nmod_vec_set(Y->rows[i], B->T->rows[i], X->c);
+            else
+                _nmod_vec_zero(Y->rows[i], X->c);
+        }
+    }
+    else
+    {
+        for (i = 0; i < A->r; i++)
+            _nmod_vec_scalar_mul_nmod(B->T->rows[i], B->T->rows[i],
+                X->c, B->diag[i], A->mod);
+
+        nmod_sparse_mat_mul_nmod_mat(Y, B->At, B->T);
+    }
+}
+
+/* S = XT V, with XT of size m x N and V of size N x n */
+static void
+bw_project(mp_ptr S, const nmod_mat_t XT, const nmod_mat_t V, nmod_mat_t T)
+{
+    slong r;
+
+    nmod_mat_mul(T, XT, V);
+
+    for (r = 0; r < XT->r; r++)
+        _nmod_vec_set(S + r * V->c, T->rows[r], V->c);
+}
+
+/* Columns of the order basis; column j has coefficients P[j] + t * M for
+   t <= deg[j] and shifted degree sdeg[j]. */
+typedef struct
+{
+    slong M;
+    mp_ptr * P;
+    slong * deg;
+    slong * alloc;
+    slong * sdeg;
+}
+bw_basis_struct;
+
+static void
+bw_basis_fit(bw_basis_struct * Q, slong j, slong deg)
+{
+    slong M = Q->M;
+
+    if (deg + 1 > Q->alloc[j])
+    {
+        slong new_alloc = FLINT_MAX(deg + 1, 2 * Q->alloc[j]);
+        Q->P[j] = flint_realloc(Q->P[j], new_alloc * M * sizeof(mp_limb_t));
+        Q->alloc[j] = new_alloc;
+    }
+
+    if (deg > Q->deg[j])
+    {
+        _nmod_vec_zero(Q->P[j] + (Q->deg[j] + 1) * M, (deg - Q->deg[j]) * M);
+        Q->deg[j] = deg;
+    }
+}
+
+/* insertion sort of the column indices by shifted degree, stable */
+static void
+bw_sort_columns(slong * order, const slong * sdeg, slong M)
+{
+    slong i, j, t;
+
+    for (i = 1; i < M; i++)
+    {
+        t = order[i];
+        for (j = i; j > 0 && (sdeg[order[j - 1]] > sdeg[t] ||
+                (sdeg[order[j - 1]] == sdeg[t] && order[j - 1] > t)); j--)
+            order[j] = order[j - 1];
+        order[j] = t;
+    }
+}
+
+/* Order basis of [S(x) | -I_m] to order L with shifts (0, ..., 0, 1, ..., 1).
+   S has L coefficients of size m x n stored consecutively. */
+static void
+bw_mbasis(bw_basis_struct * Q, mp_srcptr S, slong m, slong n, slong L, nmod_t mod)
+{
+    slong M = m + n;
+    mp_ptr R, inv;
+    slong * order, * prow, * pivots;
+    slong k, j, q, r, i, t, npiv, jj;
+    mp_limb_t c;
+
+    R = flint_malloc(m * M * sizeof(mp_limb_t));
+    inv = flint_malloc(M * sizeof(mp_limb_t));
+    order = flint_malloc(M * sizeof(slong));
+    prow = flint_malloc(M * sizeof(slong));
+    pivots = flint_malloc(M * sizeof(slong));
+
+    for (j = 0; j < M; j++)
+    {
+        order[j] = j;
+        Q->P[j] = NULL;
+        Q->alloc[j] = 0;
+        Q->deg[j] = -1;
+        bw_basis_fit(Q, j, 0);
+        _nmod_vec_zero(Q->P[j], M);
+        Q->P[j][j] = 1;
+        Q->sdeg[j] = (j < n) ? 0 : 1;
+    }
+
+    for (k = 0; k < L; k++)
+    {
+        /* coefficient k of [S | -I] P; R is stored by columns */
+        for (j = 0; j < M; j++)
+        {
+            mp_ptr Rj = R + j * m;
+
+            for (r = 0; r < m; r++)
+            {
+                mp_limb_t s2 = 0, s1 = 0, s0 = 0, u1, u0;
+
+                for (t = 0; t <= FLINT_MIN(Q->deg[j], k); t++)
+                {
+                    mp_srcptr Sr = S + ((k - t) * m + r) * n;
+                    mp_srcptr g = Q->P[j] + t * M;
+
+                    for (i = 0; i < n; i++)
+                    {
+                        umul_ppmm(u1, u0, Sr[i], g[i]);
+                        add_sssaaaaaa(s2, s1, s0, s2, s1, s0, 0, u1, u0);
+                    }
+                }
+
+                NMOD_RED(s2, s2, mod);
+                NMOD_RED3(s0, s2, s1, s0, mod);
+
+                if (k <= Q->deg[j])
+                    s0 = nmod_sub(s0, Q->P[j][k * M + n + r], mod);
+
+                Rj[r] = s0;
+            }
+        }
+
+        /* column echelon form of R, by increasing shifted degree */
+        bw_sort_columns(order, Q->sdeg, M);
+        npiv = 0;
+
+        for (jj = 0; jj < M; jj++)
+        {
+            mp_ptr Rj;
+
+            j = order[jj];
+            Rj = R + j * m;
+
+            for (t = 0; t < npiv; t++)
+            {
+                q = pivots[t];
+                c = nmod_mul(Rj[prow[q]], inv[q], mod);
+
+                if (c != 0)
+                {
+                    c = nmod_neg(c, mod);
+                    _nmod_vec_scalar_addmul_nmod(Rj, R + q * m, m, c, mod);
+                    bw_basis_fit(Q, j, Q->deg[q]);
+                    _nmod_vec_scalar_addmul_nmod(Q->P[j], Q->P[q], (Q->deg[q] + 1) * M, c, mod);
+                }
+            }
+
+            for (r = 0; r < m && Rj[r] == 0; r++)
+                ;
+
+            if (r < m)
+            {
+                prow[j] = r;
+                inv[j] = n_invmod(Rj[r], mod.n);
+                pivots[npiv++] = j;
+            }
+        }
+
+        /* multiply the pivot columns by x */
+        for (t = 0; t < npiv; t++)
+        {
+            q = pivots[t];
+            bw_basis_fit(Q, q, Q->deg[q] + 1);
+            memmove(Q->P[q] + M, Q->P[q], Q->deg[q] * M * sizeof(mp_limb_t));
+            _nmod_vec_zero(Q->P[q], M);
+            Q->sdeg[q]++;
+        }
+    }
+
+    flint_free(R);
+    flint_free(inv);
+    flint_free(order);
+    flint_free(prow);
+    flint_free(pivots);
+}
+
+/* degree of the entries lo <= i < hi of column j, or -1 */
+static slong
+bw_basis_degree(const bw_basis_struct * Q, slong j, slong lo, slong hi)
+{
+    slong t, i;
+
+    for (t = Q->deg[j]; t >= 0; t--)
+        for (i = lo; i < hi; i++)
+            if (Q->P[j][t * Q->M + i] != 0)
+                return t;
+
+    return -1;
+}
+
+static int
+bw_is_zero_column(const nmod_mat_t A, slong c)
+{
+    slong i;
+
+    for (i = 0; i < A->r; i++)
+        if (nmod_mat_entry(A, i, c) != 0)
+            return 0;
+
+    return 1;
+}
+
+slong
+nmod_sparse_mat_nullspace_block_wiedemann(nmod_mat_t X,
+    const nmod_sparse_mat_t A, slong block_size, flint_rand_t state)
+{
+    nmod_t mod = A->mod;
+    slong N = A->c;
+    slong m, n, M, L, D, E, nc, nk, rank;
+    slong i, j, k, t, iter;
+    bw_op_struct B;
+    bw_basis_struct Q;
+    nmod_mat_t XT, Y, V, U, W, F, T, K, Kw;
+    mp_ptr S, v, w;
+    slong * cand, * cdeg, * csdeg;
+
+    if (N == 0 || mod.n == 1)
+    {
+        nmod_mat_clear(X);
+        nmod_mat_init(X, N, 0, mod.n);
+        return 0;
+    }
+
+    m = n = FLINT_MAX(block_size, 1);
+    M = m + n;
+    L = (N + m - 1) / m + (N + n - 1) / n + 4;
+
+    bw_op_init(&B, A, state);
+
+    nmod_mat_init(XT, m, N, mod.n);
+    nmod_mat_init(Y, N, n, mod.n);
+    nmod_mat_init(V, N, n, mod.n);
+    nmod_mat_init(T, m, n, mod.n);
+    S = flint_malloc(L * m * n * sizeof(mp_limb_t));
+
+    for (i = 0; i < m; i++)
+        for (t = 0; t < N; t++)
+            nmod_mat_entry(XT, i, t) = n_randint(state, mod.n);
+
+    for (t = 0; t < N; t++)
+        for (i = 0; i < n; i++)
+            nmod_mat_entry(Y, t, i) = n_randint(state, mod.n);
+
+    /* S_i = X^T B^(i + 1) Y */
+    bw_op_apply(V, &B, Y);
+    for (i = 0; i < L; i++)
+    {
+        bw_project(S + i * m * n, XT, V, T);
+        if (i + 1 < L)
+            bw_op_apply(V, &B, V);
+    }
+
+    nmod_mat_clear(XT);
+    nmod_mat_clear(V);
+    nmod_mat_clear(T);
+
+    /* generator */
+    Q.M = M;
+    Q.P = flint_malloc(M * sizeof(mp_ptr));
+    Q.deg = flint_malloc(M * sizeof(slong));
+    Q.alloc = flint_malloc(M * sizeof(slong));
+    Q.sdeg = flint_malloc(M * sizeof(slong));
+
+    bw_mbasis(&Q, S, m, n, L, mod);
+    flint_free(S);
+
+    /* columns (g, h) with g != 0, by increasing shifted degree
+       d = max(deg g, deg h + 1) */
+    cand = flint_malloc(M * sizeof(slong));
+    cdeg = flint_malloc(M * sizeof(slong));
+    csdeg = flint_malloc(M * sizeof(slong));
+    nc = 0;
+    E = 0;
+    for (j = 0; j < M; j++)
+    {
+        slong dg = bw_basis_degree(&Q, j, 0, n);
+        slong d = FLINT_MAX(dg, bw_basis_degree(&Q, j, n, M) + 1);
+
+        if (dg >= 0)
+        {
+            for (k = nc; k > 0 && csdeg[k - 1] > d; k--)
+            {
+                cand[k] = cand[k - 1];
+                cdeg[k] = cdeg[k - 1];
+                csdeg[k] = csdeg[k - 1];
+            }
+            cand[k] = j;
+            cdeg[k] = dg;
+            csdeg[k] = d;
+            nc++;
+            E = FLINT_MAX(E, d - dg + 1);
+        }
+    }
+    D = 0;
+    for (j = 0; j < nc; j++)
+        D = FLINT_MAX(D, cdeg[j]);
+
+    /* U = sum_k B^(deg g - k) Y g_k for each candidate, by Horner's rule */
+    nmod_mat_init(U, N, nc, mod.n);
+    nmod_mat_init(W, N, nc, mod.n);
+    nmod_mat_init(F, n, nc, mod.n);
+    nmod_mat_init(T, N, nc, mod.n);
+
+    for (k = D; k >= 0 && nc > 0; k--)
+    {
+        if (k != D)
+            bw_op_apply(U, &B, U);
+
+        for (j = 0; j < nc; j++)
+        {
+            t = cdeg[j] - k;
+
+            for (i = 0; i < n; i++)
+                nmod_mat_entry(F, i, j) = (t >= 0) ? Q.P[cand[j]][t * M + i] : 0;
+        }
+
+        nmod_mat_mul(T, Y, F);
+        nmod_mat_add(U, U, T);
+    }
+
+    for (j = 0; j < M; j++)
+        flint_free(Q.P[j]);
+    flint_free(Q.P);
+    flint_free(Q.deg);
+    flint_free(Q.alloc);
+    flint_free(Q.sdeg);
+
+    /* B^(d - deg g + 1) u = 0 is expected; the last nonzero vector in
+       u, B u, B^2 u, ... is then in the kernel */
+    nmod_mat_init(K, nc, N, mod.n);
+    v = _nmod_vec_init(FLINT_MAX(A->r, 1));
+    nk = 0;
+
+    for (iter = 0; iter < FLINT_MIN(E, N) + 1 && nc > 0; iter++)
+    {
+        bw_op_apply(W, &B, U);
+
+        for (j = 0; j < nc; j++)
+        {
+            if (bw_is_zero_column(U, j) || !bw_is_zero_column(W, j))
+                continue;
+
+            w = K->rows[nk];
+            for (t = 0; t < N; t++)
+                w[t] = nmod_mat_entry(U, t, j);
+
+            /* the kernel of B may be larger than that of A */
+            nmod_sparse_mat_mul_vec(v, A, w);
+            if (_nmod_vec_is_zero(v, A->r))
+                nk++;
+
+            for (t = 0; t < N; t++)
+                nmod_mat_entry(W, t, j) = 0;
+        }
+
+        nmod_mat_swap(U, W);
+    }
+
+    /* independent vectors */
+    nmod_mat_window_init(Kw, K, 0, 0, nk, N);
+    rank = nmod_mat_rref(Kw);
+
+    nmod_mat_clear(X);
+    nmod_mat_init(X, N, rank, mod.n);
+    for (i = 0; i < rank; i++)
+        for (t = 0; t < N; t++)
+            nmod_mat_entry(X, t, i) = nmod_mat_entry(Kw, i, t);
+
+    nmod_mat_window_clear(Kw);
+    nmod_mat_clear(K);
+    nmod_mat_clear(Y);
+    nmod_mat_clear(U);
+    nmod_mat_clear(W);
+    nmod_mat_clear(F);
+    nmod_mat_clear(T);
+    _nmod_vec_clear(v);
+    flint_free(cand);
+    flint_free(cdeg);
+    flint_free(csdeg);
+    bw_op_clear(&B);
+
+    return rank;
+}
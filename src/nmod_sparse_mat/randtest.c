@@ -0,0 +1,58 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_randtest(nmod_sparse_mat_t A, flint_rand_t state, slong max_row_nnz)
+{
+    slong i, j, k, len, nnz;
+    slong * cols;
+    mp_limb_t n = A->mod.n;
+
+    max_row_nnz = FLINT_MIN(max_row_nnz, A->c);
+    cols = flint_malloc(FLINT_MAX(max_row_nnz, 1) * sizeof(slong));
+
+    nnz = 0;
+    for (i = 0; i < A->r; i++)
+    {
+        A->rows[i] = nnz;
+        len = (max_row_nnz > 0) ? n_randint(state, max_row_nnz + 1) : 0;
+
+        /* distinct random columns, kept sorted by insertion */
+        for (k = 0; k < len; )
+        {
+            slong c = n_randint(state, A->c);
+
+            for (j = k; j > 0 && cols[j - 1] > c; j--)
+                ;
+            if (j > 0 && cols[j - 1] == c)
+                continue;
+
+            memmove(cols + j + 1, cols + j, (k - j) * sizeof(slong));
+            cols[j] = c;
+            k++;
+        }
+
+        nmod_sparse_mat_fit_nnz(A, nnz + len);
+        for (k = 0; k < len; k++)
+        {
+            A->cols[nnz] = cols[k];
+            A->entries[nnz] = (n == 1) ? 0 : 1 + n_randint(state, n - 1);
+            nnz += (n != 1);
+        }
+    }
+    A->rows[A->r] = nnz;
+
+    flint_free(cols);
+}
@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+slong
+nmod_sparse_mat_rank(const nmod_sparse_mat_t A, flint_rand_t state)
+{
+    nmod_mat_t X;
+    slong nullity;
+
+    nmod_mat_init(X, 0, 0, A->mod.n);
+    nullity = nmod_sparse_mat_nullspace(X, A, state);
+    nmod_mat_clear(X);
+
+    return A->c - nullity;
+}
@@ -0,0 +1,39 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set(nmod_sparse_mat_t B, const nmod_sparse_mat_t A)
+{
+    slong nnz = nmod_sparse_mat_nnz(A);
+
+    if (B == A)
+        return;
+
+    if (B->r != A->r)
+    {
+        B->rows = flint_realloc(B->rows, (A->r + 1) * sizeof(slong));
+        B->r = A->r;
+    }
+
+    B->c = A->c;
+    B->mod = A->mod;
+
+    nmod_sparse_mat_fit_nnz(B, nnz);
+    memcpy(B->rows, A->rows, (A->r + 1) * sizeof(slong));
+    if (nnz != 0)
+    {
+        memcpy(B->cols, A->cols, nnz * sizeof(slong));
+        memcpy(B->entries, A->entries, nnz * sizeof(mp_limb_t));
+    }
+}
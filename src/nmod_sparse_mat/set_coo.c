@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "nmod.h"
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    slong col;
+    mp_limb_t val;
+}
+coo_entry_struct;
+
+static int
+coo_entry_cmp(const void * a, const void * b)
+{
+    slong x = ((const coo_entry_struct *) a)->col;
+    slong y = ((const coo_entry_struct *) b)->col;
+
+    return (x > y) - (x < y);
+}
+
+void
+nmod_sparse_mat_set_coo(nmod_sparse_mat_t A, const slong * ri,
+    const slong * ci, mp_srcptr v, slong nnz)
+{
+    coo_entry_struct * T;
+    slong * start;
+    slong i, k, len;
+    mp_limb_t x;
+
+    start = flint_calloc(A->r + 2, sizeof(slong));
+    T = flint_malloc(FLINT_MAX(nnz, 1) * sizeof(coo_entry_struct));
+
+    /* bucket the entries by row */
+    for (k = 0; k < nnz; k++)
+    {
+        if (ri[k] < 0 || ri[k] >= A->r || ci[k] < 0 || ci[k] >= A->c)
+            flint_throw(FLINT_ERROR, "(%s): index out of range\n", __func__);
+
+        start[ri[k] + 2]++;
+    }
+
+    for (i = 2; i <= A->r + 1; i++)
+        start[i] += start[i - 1];
+
+    for (k = 0; k < nnz; k++)
+    {
+        i = start[ri[k] + 1]++;
+        T[i].col = ci[k];
+        NMOD_RED(T[i].val, v[k], A->mod);
+    }
+
+    /* now start[i] is the beginning of row i; sort each row and add up
+       duplicate entries */
+    nmod_sparse_mat_fit_nnz(A, nnz);
+
+    len = 0;
+    for (i = 0; i < A->r; i++)
+    {
+        A->rows[i] = len;
+
+        qsort(T + start[i], start[i + 1] - start[i], sizeof(coo_entry_struct), coo_entry_cmp);
+
+        for (k = start[i]; k < start[i + 1]; )
+        {
+            x = T[k].val;
+            for (k++; k < start[i + 1] && T[k].col == T[k - 1].col; k++)
+                x = nmod_add(x, T[k].val, A->mod);
+
+            if (x != 0)
+            {
+                A->cols[len] = T[k - 1].col;
+                A->entries[len] = x;
+                len++;
+            }
+        }
+    }
+    A->rows[A->r] = len;
+
+    flint_free(start);
+    flint_free(T);
+}
@@ -0,0 +1,43 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t A, const nmod_mat_t B)
+{
+    slong i, j, nnz;
+
+    nnz = 0;
+    for (i = 0; i < B->r; i++)
+        for (j = 0; j < B->c; j++)
+            nnz += (nmod_mat_entry(B, i, j) != 0);
+
+    nmod_sparse_mat_clear(A);
+    nmod_sparse_mat_init(A, B->r, B->c, B->mod.n);
+    nmod_sparse_mat_fit_nnz(A, nnz);
+
+    nnz = 0;
+    for (i = 0; i < B->r; i++)
+    {
+        for (j = 0; j < B->c; j++)
+        {
+            if (nmod_mat_entry(B, i, j) != 0)
+            {
+                A->cols[nnz] = j;
+                A->entries[nnz] = nmod_mat_entry(B, i, j);
+                nnz++;
+            }
+        }
+        A->rows[i + 1] = nnz;
+    }
+}
@@ -0,0 +1,378 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "ulong_extras.h"
+#include "nmod.h"
+#include "nmod_sparse_mat.h"
+
+/*
+  Structured Gaussian elimination. A pivot (i, j) is taken only when it
+  cannot increase the number of nonzero entries:
+
+    * column j has a single entry, in row i: row i is simply dropped;
+    * row i has one or two entries: row i is subtracted from the other rows
+      containing column j, which trades entry j of each such row for at
+      most one new entry.
+
+  Pivot rows are recorded as they are at the time of elimination, which is
+  all that is needed to recover the eliminated variables.
+*/
+
+typedef struct
+{
+    slong * cols;
+    mp_limb_t * vals;
+    slong len;
+    slong alloc;
+}
+sge_vec_struct;
+
+typedef struct
+{
+    sge_vec_struct * rows;      /* rows of the matrix being reduced */
+    slong ** clist;             /* rows which may contain each column */
+    slong * clen;
+    slong * calloc;
+    slong * cw;                 /* exact number of entries in each column */
+    char * col_alive;
+    char * row_alive;
+    sge_vec_struct tmp;
+    nmod_t mod;
+}
+sge_struct;
+
+static void
+sge_vec_fit(sge_vec_struct * v, slong len)
+{
+    if (len > v->alloc)
+    {
+        len = FLINT_MAX(len, 2 * v->alloc);
+        v->cols = flint_realloc(v->cols, len * sizeof(slong));
+        v->vals = flint_realloc(v->vals, len * sizeof(mp_limb_t));
+        v->alloc = len;
+    }
+}
+
+static void
+sge_clist_push(sge_struct * S, slong j, slong i)
+{
+    if (S->clen[j] == S->calloc[j])
+    {
+        S->calloc[j] = FLINT_MAX(4, 2 * S->calloc[j]);
+        S->clist[j] = flint_realloc(S->clist[j], S->calloc[j] * sizeof(slong));
+    }
+
+    S->clist[j][S->clen[j]++] = i;
+}
+
+/* index of column j in row i, or -1 */
+static slong
+sge_find(const sge_vec_struct * v, slong j)
+{
+    slong lo = 0, hi = v->len, mid;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (v->cols[mid] < j)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return (lo < v->len && v->cols[lo] == j) ? lo : -1;
+}
+
+/* row k -= c * row i */
+static void
+sge_row_submul(sge_struct * S, slong k, slong i, mp_limb_t c)
+{
+    sge_vec_struct * a = S->rows + k;
+    const sge_vec_struct * b = S->rows + i;
+    sge_vec_struct * t = &S->tmp;
+    slong x, y, len;
+    mp_limb_t v, nc = nmod_neg(c, S->mod);
+
+    sge_vec_fit(t, a->len + b->len);
+
+    for (x = y = len = 0; x < a->len || y < b->len; )
+    {
+        if (y == b->len || (x < a->len && a->cols[x] < b->cols[y]))
+        {
+            t->cols[len] = a->cols[x];
+            t->vals[len] = a->vals[x];
+            len++;
+            x++;
+        }
+        else if (x == a->len || b->cols[y] < a->cols[x])
+        {
+            t->cols[len] = b->cols[y];
+            t->vals[len] = nmod_mul(nc, b->vals[y], S->mod);
+            S->cw[b->cols[y]]++;
+            sge_clist_push(S, b->cols[y], k);
+            len++;
+            y++;
+        }
+        else
+        {
+            v = nmod_addmul(a->vals[x], nc, b->vals[y], S->mod);
+            if (v != 0)
+            {
+                t->cols[len] = a->cols[x];
+                t->vals[len] = v;
+                len++;
+            }
+            else
+            {
+                S->cw[a->cols[x]]--;
+            }
+            x++;
+            y++;
+        }
+    }
+
+    t->len = len;
+    FLINT_SWAP(sge_vec_struct, *a, *t);
+}
+
+static void
+sge_pivot(sge_struct * S, nmod_sparse_mat_sge_t E, slong * palloc, slong i, slong j)
+{
+    nmod_sparse_mat_struct * P = &E->prows;
+    sge_vec_struct * row = S->rows + i;
+    slong k, l, t, nnz;
+    mp_limb_t ainv, c;
+
+    /* record the pivot row */
+    if (P->r == *palloc)
+    {
+        *palloc = FLINT_MAX(16, 2 * (*palloc));
+        P->rows = flint_realloc(P->rows, (*palloc + 1) * sizeof(slong));
+        E->pcols = flint_realloc(E->pcols, (*palloc) * sizeof(slong));
+    }
+
+    nnz = P->rows[P->r];
+    nmod_sparse_mat_fit_nnz(P, nnz + row->len);
+    memcpy(P->cols + nnz, row->cols, row->len * sizeof(slong));
+    memcpy(P->entries + nnz, row->vals, row->len * sizeof(mp_limb_t));
+    E->pcols[P->r] = j;
+    P->r++;
+    P->rows[P->r] = nnz + row->len;
+
+    /* eliminate column j from the other rows */
+    ainv = n_invmod(row->vals[sge_find(row, j)], S->mod.n);
+
+    for (t = 0; t < S->clen[j]; t++)
+    {
+        k = S->clist[j][t];
+
+        if (k == i || !S->row_alive[k])
+            continue;
+
+        l = sge_find(S->rows + k, j);
+        if (l < 0)
+            continue;
+
+        c = nmod_mul(S->rows[k].vals[l], ainv, S->mod);
+        sge_row_submul(S, k, i, c);
+    }
+
+    /* remove row i and column j */
+    for (t = 0; t < row->len; t++)
+        S->cw[row->cols[t]]--;
+
+    S->row_alive[i] = 0;
+    row->len = 0;
+
+    S->col_alive[j] = 0;
+    flint_free(S->clist[j]);
+    S->clist[j] = NULL;
+    S->clen[j] = S->calloc[j] = 0;
+}
+
+void
+_nmod_sparse_mat_sge(nmod_sparse_mat_t B, nmod_sparse_mat_sge_t E,
+    const nmod_sparse_mat_t A, slong cmax)
+{
+    sge_struct S[1];
+    slong r = A->r, c = A->c;
+    slong palloc, i, j, k, t, len, nnz;
+    slong * cmap;
+    int changed;
+
+    cmax = FLINT_MIN(cmax, c);
+
+    S->mod = A->mod;
+    S->rows = flint_calloc(r, sizeof(sge_vec_struct));
+    S->clist = flint_calloc(c, sizeof(slong *));
+    S->clen = flint_calloc(c, sizeof(slong));
+    S->calloc = flint_calloc(c, sizeof(slong));
+    S->cw = flint_calloc(c, sizeof(slong));
+    S->col_alive = flint_malloc(c + 1);
+    S->row_alive = flint_malloc(r + 1);
+    S->tmp.cols = NULL;
+    S->tmp.vals = NULL;
+    S->tmp.len = S->tmp.alloc = 0;
+
+    memset(S->col_alive, 1, c);
+    memset(S->row_alive, 1, r);
+
+    for (i = 0; i < r; i++)
+    {
+        len = A->rows[i + 1] - A->rows[i];
+        sge_vec_fit(S->rows + i, len);
+        memcpy(S->rows[i].cols, A->cols + A->rows[i], len * sizeof(slong));
+        memcpy(S->rows[i].vals, A->entries + A->rows[i], len * sizeof(mp_limb_t));
+        S->rows[i].len = len;
+
+        for (k = 0; k < len; k++)
+        {
+            S->cw[S->rows[i].cols[k]]++;
+            sge_clist_push(S, S->rows[i].cols[k], i);
+        }
+    }
+
+    nmod_sparse_mat_clear(&E->prows);
+    nmod_sparse_mat_init(&E->prows, 0, c, A->mod.n);
+    flint_free(E->pcols);
+    E->pcols = NULL;
+    palloc = 0;
+
+    do
+    {
+        changed = 0;
+
+        /* columns with a single entry */
+        for (j = 0; j < cmax; j++)
+        {
+            if (!S->col_alive[j] || S->cw[j] != 1)
+                continue;
+
+            for (t = 0; t < S->clen[j]; t++)
+            {
+                i = S->clist[j][t];
+                if (S->row_alive[i] && sge_find(S->rows + i, j) >= 0)
+                    break;
+            }
+
+            sge_pivot(S, E, &palloc, i, j);
+            changed = 1;
+        }
+
+        /* rows with one or two entries */
+        for (i = 0; i < r; i++)
+        {
+            if (!S->row_alive[i])
+                continue;
+
+            len = S->rows[i].len;
+
+            if (len == 0)
+            {
+                S->row_alive[i] = 0;
+                continue;
+            }
+
+            if (len > 2)
+                continue;
+
+            /* pivot on the lightest column that may be eliminated */
+            j = -1;
+            for (k = 0; k < len; k++)
+            {
+                t = S->rows[i].cols[k];
+                if (t < cmax && (j == -1 || S->cw[t] < S->cw[j]))
+                    j = t;
+            }
+
+            if (j != -1)
+            {
+                sge_pivot(S, E, &palloc, i, j);
+                changed = 1;
+            }
+        }
+    }
+    while (changed);
+
+    /* the remaining rows and columns form B */
+    flint_free(E->rows);
+    flint_free(E->cols);
+    E->rows = flint_malloc(FLINT_MAX(r, 1) * sizeof(slong));
+    E->cols = flint_malloc(FLINT_MAX(c, 1) * sizeof(slong));
+    cmap = flint_malloc(FLINT_MAX(c, 1) * sizeof(slong));
+
+    E->ncols = 0;
+    for (j = 0; j < c; j++)
+    {
+        if (S->col_alive[j])
+        {
+            cmap[j] = E->ncols;
+            E->cols[E->ncols++] = j;
+        }
+    }
+
+    E->nrows = 0;
+    nnz = 0;
+    for (i = 0; i < r; i++)
+    {
+        if (S->row_alive[i] && S->rows[i].len != 0)
+        {
+            E->rows[E->nrows++] = i;
+            nnz += S->rows[i].len;
+        }
+    }
+
+    nmod_sparse_mat_clear(B);
+    nmod_sparse_mat_init(B, E->nrows, E->ncols, A->mod.n);
+    nmod_sparse_mat_fit_nnz(B, nnz);
+
+    nnz = 0;
+    for (k = 0; k < E->nrows; k++)
+    {
+        const sge_vec_struct * v = S->rows + E->rows[k];
+
+        for (t = 0; t < v->len; t++)
+        {
+            B->cols[nnz + t] = cmap[v->cols[t]];
+            B->entries[nnz + t] = v->vals[t];
+        }
+
+        nnz += v->len;
+        B->rows[k + 1] = nnz;
+    }
+
+    for (i = 0; i < r; i++)
+    {
+        flint_free(S->rows[i].cols);
+        flint_free(S->rows[i].vals);
+    }
+    for (j = 0; j < c; j++)
+        flint_free(S->clist[j]);
+
+    flint_free(S->rows);
+    flint_free(S->clist);
+    flint_free(S->clen);
+    flint_free(S->calloc);
+    flint_free(S->cw);
+    flint_free(S->col_alive);
+    flint_free(S->row_alive);
+    flint_free(S->tmp.cols);
+    flint_free(S->tmp.vals);
+    flint_free(cmap);
+}
+
+void
+nmod_sparse_mat_sge(nmod_sparse_mat_t B, nmod_sparse_mat_sge_t E,
+    const nmod_sparse_mat_t A)
+{
+    _nmod_sparse_mat_sge(B, E, A, A->c);
+}
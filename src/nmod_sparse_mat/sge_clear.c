@@ -0,0 +1,21 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_sge_clear(nmod_sparse_mat_sge_t E)
+{
+    nmod_sparse_mat_clear(&E->prows);
+    flint_free(E->pcols);
+    flint_free(E->rows);
+    flint_free(E->cols);
+}
@@ -0,0 +1,23 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_sge_init(nmod_sparse_mat_sge_t E, mp_limb_t n)
+{
+    nmod_sparse_mat_init(&E->prows, 0, 0, n);
+    E->pcols = NULL;
+    E->rows = NULL;
+    E->cols = NULL;
+    E->nrows = 0;
+    E->ncols = 0;
+}
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_sge_lift(mp_ptr x, const nmod_sparse_mat_sge_t E, mp_srcptr y)
+{
+    const nmod_sparse_mat_struct * P = &E->prows;
+    nmod_t mod = P->mod;
+    mp_limb_t s, a;
+    slong i, j, k;
+
+    for (k = 0; k < E->ncols; k++)
+        x[E->cols[k]] = y[k];
+
+    /* a pivot row only involves columns that were still present when it
+       was used, so going backwards every other variable is known */
+    for (i = P->r - 1; i >= 0; i--)
+    {
+        j = E->pcols[i];
+        s = 0;
+        a = 0;
+
+        for (k = P->rows[i]; k < P->rows[i + 1]; k++)
+        {
+            if (P->cols[k] == j)
+                a = P->entries[k];
+            else
+                s = nmod_addmul(s, P->entries[k], x[P->cols[k]], mod);
+        }
+
+        x[j] = nmod_neg(nmod_div(s, a, mod), mod);
+    }
+}
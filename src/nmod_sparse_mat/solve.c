@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+/* A solution of A x = b is read off a kernel vector of [A | b] whose last
+   coordinate is nonzero. The column b is never used as a pivot by the
+   elimination, so it survives as the last column of the reduced matrix. */
+int
+nmod_sparse_mat_solve(mp_ptr x, const nmod_sparse_mat_t A, mp_srcptr b, flint_rand_t state)
+{
+    nmod_sparse_mat_t Ab, B;
+    nmod_sparse_mat_sge_t E;
+    nmod_mat_t Y;
+    nmod_t mod = A->mod;
+    mp_ptr y, z, t;
+    slong r = A->r, c = A->c;
+    slong i, j, k, nnz, nullity;
+    int found = 0;
+
+    /* [A | b] */
+    nmod_sparse_mat_init(Ab, r, c + 1, mod.n);
+    nmod_sparse_mat_fit_nnz(Ab, nmod_sparse_mat_nnz(A) + r);
+    for (i = 0, nnz = 0; i < r; i++)
+    {
+        Ab->rows[i] = nnz;
+        for (k = A->rows[i]; k < A->rows[i + 1]; k++, nnz++)
+        {
+            Ab->cols[nnz] = A->cols[k];
+            Ab->entries[nnz] = A->entries[k];
+        }
+        if (b[i] != 0)
+        {
+            Ab->cols[nnz] = c;
+            Ab->entries[nnz++] = b[i];
+        }
+    }
+    Ab->rows[r] = nnz;
+
+    nmod_sparse_mat_init(B, 0, 0, mod.n);
+    nmod_sparse_mat_sge_init(E, mod.n);
+    nmod_mat_init(Y, 0, 0, mod.n);
+
+    _nmod_sparse_mat_sge(B, E, Ab, c);
+    nullity = _nmod_sparse_mat_nullspace(Y, B, state);
+
+    y = _nmod_vec_init(B->c);
+    z = _nmod_vec_init(c + 1);
+    t = _nmod_vec_init(r);
+
+    for (i = 0; i < nullity && !found; i++)
+    {
+        mp_limb_t u;
+
+        if (nmod_mat_entry(Y, B->c - 1, i) == 0)
+            continue;
+
+        for (j = 0; j < B->c; j++)
+            y[j] = nmod_mat_entry(Y, j, i);
+
+        nmod_sparse_mat_sge_lift(z, E, y);
+
+        u = nmod_neg(n_invmod(z[c], mod.n), mod);
+        _nmod_vec_scalar_mul_nmod(x, z, c, u, mod);
+
+        nmod_sparse_mat_mul_vec(t, A, x);
+        found = _nmod_vec_equal(t, b, r);
+    }
+
+    _nmod_vec_clear(y);
+    _nmod_vec_clear(z);
+    _nmod_vec_clear(t);
+    nmod_mat_clear(Y);
+    nmod_sparse_mat_sge_clear(E);
+    nmod_sparse_mat_clear(B);
+    nmod_sparse_mat_clear(Ab);
+
+    return found;
+}
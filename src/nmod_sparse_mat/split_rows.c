@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+/* Sets bounds[0] = 0 <= bounds[1] <= ... <= bounds[num] = A->r so that the
+   row ranges [bounds[t], bounds[t + 1]) hold about the same number of
+   nonzero entries. */
+void
+_nmod_sparse_mat_split_rows(slong * bounds, const nmod_sparse_mat_t A, slong num)
+{
+    slong nnz = nmod_sparse_mat_nnz(A);
+    slong t, lo, hi, mid, target;
+
+    bounds[0] = 0;
+    bounds[num] = A->r;
+
+    for (t = 1; t < num; t++)
+    {
+        target = (slong) (((double) nnz * t) / num);
+
+        /* first row starting at or after the target */
+        lo = bounds[t - 1];
+        hi = A->r;
+        while (lo < hi)
+        {
+            mid = lo + (hi - lo) / 2;
+            if (A->rows[mid] < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        bounds[t] = lo;
+    }
+}
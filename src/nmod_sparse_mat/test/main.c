@@ -0,0 +1,43 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <string.h>
+#include <stdlib.h>
+
+/* Include functions *********************************************************/
+
+#include "t-mul_nmod_mat.c"
+#include "t-mul_vec.c"
+#include "t-nullspace_block_wiedemann.c"
+#include "t-nullspace.c"
+#include "t-set_coo.c"
+#include "t-sge.c"
+#include "t-solve.c"
+#include "t-transpose.c"
+
+/* Array of test functions ***************************************************/
+
+test_struct tests[] =
+{
+    TEST_FUNCTION(nmod_sparse_mat_mul_nmod_mat),
+    TEST_FUNCTION(nmod_sparse_mat_mul_vec),
+    TEST_FUNCTION(nmod_sparse_mat_nullspace_block_wiedemann),
+    TEST_FUNCTION(nmod_sparse_mat_nullspace),
+    TEST_FUNCTION(nmod_sparse_mat_set_coo),
+    TEST_FUNCTION(nmod_sparse_mat_sge),
+    TEST_FUNCTION(nmod_sparse_mat_solve),
+    TEST_FUNCTION(nmod_sparse_mat_transpose),
+};
+
+/* main function *************************************************************/
+
+TEST_MAIN(tests)
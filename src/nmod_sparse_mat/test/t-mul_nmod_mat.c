@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+TEST_FUNCTION_START(nmod_sparse_mat_mul_nmod_mat, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t D, X, Y, Z;
+        slong r, c, k;
+        mp_limb_t n;
+
+        if (n_randint(state, 4) == 0)
+        {
+            r = 500 + n_randint(state, 1000);
+            c = 500 + n_randint(state, 1000);
+        }
+        else
+        {
+            r = n_randint(state, 50);
+            c = n_randint(state, 50);
+        }
+
+        k = n_randint(state, 12);
+        n = n_randtest_not_zero(state);
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_mat_init(D, r, c, n);
+        nmod_mat_init(X, c, k, n);
+        nmod_mat_init(Y, r, k, n);
+        nmod_mat_init(Z, r, k, n);
+
+        nmod_sparse_mat_randtest(A, state, 1 + n_randint(state, 40));
+        nmod_sparse_mat_get_nmod_mat(D, A);
+        nmod_mat_randtest(X, state);
+
+        nmod_sparse_mat_mul_nmod_mat(Y, A, X);
+        nmod_mat_mul(Z, D, X);
+
+        if (!nmod_mat_equal(Y, Z))
+        {
+            flint_printf("FAIL\n");
+            flint_printf("r = %wd, c = %wd, k = %wd, n = %wu\n", r, c, k, n);
+            flint_abort();
+        }
+
+        /* aliasing */
+        if (r == c)
+        {
+            nmod_sparse_mat_mul_nmod_mat(X, A, X);
+
+            if (!nmod_mat_equal(X, Z))
+            {
+                flint_printf("FAIL (aliasing)\n");
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(D);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        nmod_mat_clear(Z);
+    }
+
+    flint_set_num_threads(1);
+
+    TEST_FUNCTION_END(state);
+}
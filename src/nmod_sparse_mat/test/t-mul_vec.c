@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+TEST_FUNCTION_START(nmod_sparse_mat_mul_vec, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t D;
+        mp_ptr x, y, z;
+        slong r, c, i;
+        mp_limb_t n;
+
+        /* large enough to go through the threaded code */
+        if (n_randint(state, 4) == 0)
+        {
+            r = 1000 + n_randint(state, 2000);
+            c = 1000 + n_randint(state, 2000);
+        }
+        else
+        {
+            r = n_randint(state, 50);
+            c = n_randint(state, 50);
+        }
+
+        n = n_randtest_not_zero(state);
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_mat_init(D, r, c, n);
+        x = _nmod_vec_init(c);
+        y = _nmod_vec_init(r);
+        z = _nmod_vec_init(r);
+
+        nmod_sparse_mat_randtest(A, state, 1 + n_randint(state, 40));
+        nmod_sparse_mat_get_nmod_mat(D, A);
+        _nmod_vec_randtest(x, state, c, A->mod);
+
+        nmod_sparse_mat_mul_vec(y, A, x);
+        nmod_mat_mul_nmod_vec(z, D, x, c);
+
+        if (!_nmod_vec_equal(y, z, r))
+        {
+            flint_printf("FAIL\n");
+            flint_printf("r = %wd, c = %wd, n = %wu\n", r, c, n);
+            for (i = 0; i < r && y[i] == z[i]; i++)
+                ;
+            flint_printf("first mismatch at %wd\n", i);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(D);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(z);
+    }
+
+    flint_set_num_threads(1);
+
+    TEST_FUNCTION_END(state);
+}
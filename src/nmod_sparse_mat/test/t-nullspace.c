@@ -0,0 +1,119 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+TEST_FUNCTION_START(nmod_sparse_mat_nullspace, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t D, X, Z;
+        slong r, c, rank, nullity;
+        mp_limb_t n;
+
+        r = n_randint(state, 50);
+        c = n_randint(state, 50);
+        n = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_mat_init(D, r, c, n);
+        nmod_mat_init(X, 0, 0, n);
+
+        nmod_sparse_mat_randtest(A, state, 1 + n_randint(state, 6));
+        nmod_sparse_mat_get_nmod_mat(D, A);
+        rank = nmod_mat_rank(D);
+
+        nullity = nmod_sparse_mat_nullspace(X, A, state);
+
+        if (nullity != c - rank || X->r != c || X->c != nullity ||
+            nmod_mat_rank(X) != nullity)
+        {
+            flint_printf("FAIL\n");
+            flint_printf("rank = %wd, nullity = %wd\n", rank, nullity);
+            nmod_mat_print_pretty(D);
+            flint_abort();
+        }
+
+        nmod_mat_init(Z, r, nullity, n);
+        nmod_mat_mul(Z, D, X);
+
+        if (!nmod_mat_is_zero(Z))
+        {
+            flint_printf("FAIL (not in the kernel)\n");
+            flint_abort();
+        }
+
+        if (nmod_sparse_mat_rank(A, state) != rank)
+        {
+            flint_printf("FAIL (rank)\n");
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(D);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Z);
+    }
+
+    /* above the dense cutoff, without elimination, so that the kernel
+       comes from rounds of block Wiedemann */
+    for (iter = 0; iter < flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t D, X, Z;
+        slong r, c, rank, nullity;
+        mp_limb_t n;
+
+        c = 1100;
+        r = 950 + n_randint(state, 200);
+        n = n_randprime(state, 60, 0);
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_mat_init(D, r, c, n);
+        nmod_mat_init(X, 0, 0, n);
+
+        nmod_sparse_mat_randtest(A, state, 2 + n_randint(state, 4));
+        nmod_sparse_mat_get_nmod_mat(D, A);
+        rank = nmod_mat_rank(D);
+
+        nullity = _nmod_sparse_mat_nullspace(X, A, state);
+
+        if (nullity != c - rank || X->r != c || X->c != nullity ||
+            nmod_mat_rank(X) != nullity)
+        {
+            flint_printf("FAIL (block Wiedemann)\n");
+            flint_printf("r = %wd, rank = %wd, nullity = %wd\n", r, rank, nullity);
+            flint_abort();
+        }
+
+        nmod_mat_init(Z, r, nullity, n);
+        nmod_mat_mul(Z, D, X);
+
+        if (!nmod_mat_is_zero(Z))
+        {
+            flint_printf("FAIL (block Wiedemann, not in the kernel)\n");
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(D);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Z);
+    }
+
+    TEST_FUNCTION_END(state);
+}
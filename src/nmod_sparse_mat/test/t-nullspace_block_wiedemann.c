@@ -0,0 +1,71 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+TEST_FUNCTION_START(nmod_sparse_mat_nullspace_block_wiedemann, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t D, X, Z;
+        slong r, c, k, nullity, bs;
+        mp_limb_t n;
+
+        r = n_randint(state, 80);
+        c = n_randint(state, 80);
+        bs = 1 + n_randint(state, 8);
+
+        /* the method may miss kernel vectors with small probability,
+           which becomes negligible for large primes */
+        n = n_randprime(state, 40 + n_randint(state, 24), 1);
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_mat_init(D, r, c, n);
+        nmod_mat_init(X, 0, 0, n);
+
+        nmod_sparse_mat_randtest(A, state, 1 + n_randint(state, 6));
+        nmod_sparse_mat_get_nmod_mat(D, A);
+        nullity = c - nmod_mat_rank(D);
+
+        k = nmod_sparse_mat_nullspace_block_wiedemann(X, A, bs, state);
+
+        if (X->r != c || X->c != k || k > nullity || (nullity > 0 && k == 0)
+            || nmod_mat_rank(X) != k)
+        {
+            flint_printf("FAIL\n");
+            flint_printf("r = %wd, c = %wd, block size = %wd\n", r, c, bs);
+            flint_printf("nullity = %wd, found = %wd\n", nullity, k);
+            flint_abort();
+        }
+
+        nmod_mat_init(Z, r, k, n);
+        nmod_mat_mul(Z, D, X);
+
+        if (!nmod_mat_is_zero(Z))
+        {
+            flint_printf("FAIL (not in the kernel)\n");
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(D);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Z);
+    }
+
+    TEST_FUNCTION_END(state);
+}
@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "ulong_extras.h"
+#include "nmod.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+TEST_FUNCTION_START(nmod_sparse_mat_set_coo, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A, B;
+        nmod_mat_t D, E;
+        slong * ri, * ci;
+        mp_ptr v;
+        slong r, c, nnz, k, i, j;
+        mp_limb_t n;
+
+        r = n_randint(state, 20);
+        c = n_randint(state, 20);
+        n = n_randtest_not_zero(state);
+        nnz = (r == 0 || c == 0) ? 0 : n_randint(state, 2 * r * c + 1);
+
+        ri = flint_malloc((nnz + 1) * sizeof(slong));
+        ci = flint_malloc((nnz + 1) * sizeof(slong));
+        v = flint_malloc((nnz + 1) * sizeof(mp_limb_t));
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_sparse_mat_init(B, 0, 0, n);
+        nmod_mat_init(D, r, c, n);
+        nmod_mat_init(E, r, c, n);
+
+        /* duplicates are summed */
+        for (k = 0; k < nnz; k++)
+        {
+            ri[k] = n_randint(state, r);
+            ci[k] = n_randint(state, c);
+            v[k] = n_randint(state, n);
+            nmod_mat_entry(D, ri[k], ci[k]) = nmod_add(nmod_mat_entry(D, ri[k], ci[k]), v[k], A->mod);
+        }
+
+        nmod_sparse_mat_set_coo(A, ri, ci, v, nnz);
+        nmod_sparse_mat_get_nmod_mat(E, A);
+
+        if (!nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL (set_coo)\n");
+            nmod_mat_print_pretty(D);
+            nmod_mat_print_pretty(E);
+            flint_abort();
+        }
+
+        for (i = 0; i < r; i++)
+        {
+            for (k = A->rows[i]; k < A->rows[i + 1]; k++)
+            {
+                if (A->entries[k] == 0 || (k > A->rows[i] && A->cols[k - 1] >= A->cols[k]))
+                {
+                    flint_printf("FAIL (normalisation)\n");
+                    flint_abort();
+                }
+            }
+
+            for (j = 0; j < c; j++)
+            {
+                if (nmod_sparse_mat_get_entry(A, i, j) != nmod_mat_entry(D, i, j))
+                {
+                    flint_printf("FAIL (get_entry)\n");
+                    flint_abort();
+                }
+            }
+        }
+
+        nmod_sparse_mat_set_nmod_mat(B, D);
+
+        if (!nmod_sparse_mat_equal(A, B))
+        {
+            flint_printf("FAIL (set_nmod_mat)\n");
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(B);
+        nmod_mat_clear(D);
+        nmod_mat_clear(E);
+        flint_free(ri);
+        flint_free(ci);
+        flint_free(v);
+    }
+
+    TEST_FUNCTION_END(state);
+}
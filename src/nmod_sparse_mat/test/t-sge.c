@@ -0,0 +1,99 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+TEST_FUNCTION_START(nmod_sparse_mat_sge, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A, B;
+        nmod_sparse_mat_sge_t E;
+        nmod_mat_t DA, DB, K;
+        mp_ptr x, y, z;
+        slong r, c, i, j, rA, rB, nullity;
+        mp_limb_t n;
+
+        r = n_randint(state, 40);
+        c = n_randint(state, 40);
+        n = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_sparse_mat_init(B, 0, 0, n);
+        nmod_sparse_mat_sge_init(E, n);
+
+        nmod_sparse_mat_randtest(A, state, 1 + n_randint(state, 5));
+        nmod_sparse_mat_sge(B, E, A);
+
+        if (nmod_sparse_mat_nnz(B) > nmod_sparse_mat_nnz(A) ||
+            B->r != E->nrows || B->c != E->ncols || B->c + E->prows.r != c)
+        {
+            flint_printf("FAIL (dimensions)\n");
+            flint_abort();
+        }
+
+        nmod_mat_init(DA, r, c, n);
+        nmod_mat_init(DB, B->r, B->c, n);
+        nmod_sparse_mat_get_nmod_mat(DA, A);
+        nmod_sparse_mat_get_nmod_mat(DB, B);
+
+        rA = nmod_mat_rank(DA);
+        rB = nmod_mat_rank(DB);
+
+        if (rA != rB + E->prows.r)
+        {
+            flint_printf("FAIL (rank)\n");
+            flint_printf("rank(A) = %wd, rank(B) = %wd, pivots = %wd\n", rA, rB, E->prows.r);
+            flint_abort();
+        }
+
+        /* kernel vectors lift */
+        nmod_mat_init(K, B->c, B->c, n);
+        nullity = nmod_mat_nullspace(K, DB);
+
+        x = _nmod_vec_init(c);
+        y = _nmod_vec_init(B->c);
+        z = _nmod_vec_init(r);
+
+        for (j = 0; j < nullity; j++)
+        {
+            for (i = 0; i < B->c; i++)
+                y[i] = nmod_mat_entry(K, i, j);
+
+            nmod_sparse_mat_sge_lift(x, E, y);
+            nmod_sparse_mat_mul_vec(z, A, x);
+
+            if (!_nmod_vec_is_zero(z, r))
+            {
+                flint_printf("FAIL (lift)\n");
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(B);
+        nmod_sparse_mat_sge_clear(E);
+        nmod_mat_clear(DA);
+        nmod_mat_clear(DB);
+        nmod_mat_clear(K);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(z);
+    }
+
+    TEST_FUNCTION_END(state);
+}
@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+TEST_FUNCTION_START(nmod_sparse_mat_solve, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t D, Db, Dx;
+        mp_ptr x, b, t;
+        slong r, c, i;
+        mp_limb_t n;
+        int consistent, result;
+
+        r = n_randint(state, 50);
+        c = n_randint(state, 50);
+        n = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, r, c, n);
+        x = _nmod_vec_init(c);
+        b = _nmod_vec_init(r);
+        t = _nmod_vec_init(r);
+
+        nmod_sparse_mat_randtest(A, state, 1 + n_randint(state, 6));
+
+        if (n_randint(state, 2))
+        {
+            _nmod_vec_randtest(x, state, c, A->mod);
+            nmod_sparse_mat_mul_vec(b, A, x);
+            consistent = 1;
+        }
+        else
+        {
+            _nmod_vec_randtest(b, state, r, A->mod);
+
+            nmod_mat_init(D, r, c, n);
+            nmod_mat_init(Db, r, 1, n);
+            nmod_mat_init(Dx, c, 1, n);
+            nmod_sparse_mat_get_nmod_mat(D, A);
+            for (i = 0; i < r; i++)
+                nmod_mat_entry(Db, i, 0) = b[i];
+            consistent = nmod_mat_can_solve(Dx, D, Db);
+            nmod_mat_clear(D);
+            nmod_mat_clear(Db);
+            nmod_mat_clear(Dx);
+        }
+
+        result = nmod_sparse_mat_solve(x, A, b, state);
+
+        if (result != consistent)
+        {
+            flint_printf("FAIL (consistency)\n");
+            flint_printf("expected %d, got %d\n", consistent, result);
+            flint_abort();
+        }
+
+        if (result)
+        {
+            nmod_sparse_mat_mul_vec(t, A, x);
+
+            if (!_nmod_vec_equal(t, b, r))
+            {
+                flint_printf("FAIL (A x != b)\n");
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(A);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(t);
+    }
+
+    TEST_FUNCTION_END(state);
+}
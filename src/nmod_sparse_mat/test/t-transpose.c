@@ -0,0 +1,71 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+TEST_FUNCTION_START(nmod_sparse_mat_transpose, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t A, B, C;
+        nmod_mat_t D, DT, E;
+        slong r, c;
+        mp_limb_t n;
+
+        r = n_randint(state, 30);
+        c = n_randint(state, 30);
+        n = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_sparse_mat_init(B, 0, 0, n);
+        nmod_sparse_mat_init(C, 0, 0, n);
+        nmod_mat_init(D, r, c, n);
+        nmod_mat_init(DT, c, r, n);
+        nmod_mat_init(E, c, r, n);
+
+        nmod_sparse_mat_randtest(A, state, n_randint(state, 10));
+        nmod_sparse_mat_transpose(B, A);
+
+        nmod_sparse_mat_get_nmod_mat(D, A);
+        nmod_sparse_mat_get_nmod_mat(E, B);
+        nmod_mat_transpose(DT, D);
+
+        if (!nmod_mat_equal(DT, E))
+        {
+            flint_printf("FAIL\n");
+            nmod_mat_print_pretty(D);
+            nmod_mat_print_pretty(E);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_transpose(C, B);
+
+        if (!nmod_sparse_mat_equal(A, C))
+        {
+            flint_printf("FAIL (involution)\n");
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(B);
+        nmod_sparse_mat_clear(C);
+        nmod_mat_clear(D);
+        nmod_mat_clear(DT);
+        nmod_mat_clear(E);
+    }
+
+    TEST_FUNCTION_END(state);
+}
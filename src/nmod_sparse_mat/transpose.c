@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_transpose(nmod_sparse_mat_t B, const nmod_sparse_mat_t A)
+{
+    nmod_sparse_mat_t T;
+    slong nnz = nmod_sparse_mat_nnz(A);
+    slong i, j, k;
+
+    nmod_sparse_mat_init(T, A->c, A->r, A->mod.n);
+    nmod_sparse_mat_fit_nnz(T, nnz);
+
+    /* count the entries in each column */
+    for (k = 0; k < nnz; k++)
+        T->rows[A->cols[k] + 1]++;
+
+    for (j = 0; j < A->c; j++)
+        T->rows[j + 1] += T->rows[j];
+
+    /* rows are visited in order, so the columns of T come out sorted */
+    for (i = 0; i < A->r; i++)
+    {
+        for (k = A->rows[i]; k < A->rows[i + 1]; k++)
+        {
+            j = T->rows[A->cols[k]]++;
+            T->cols[j] = i;
+            T->entries[j] = A->entries[k];
+        }
+    }
+
+    for (j = A->c; j > 0; j--)
+        T->rows[j] = T->rows[j - 1];
+    T->rows[0] = 0;
+
+    nmod_sparse_mat_swap(B, T);
+    nmod_sparse_mat_clear(T);
+}
@@ -184,6 +184,10 @@ int _nmod_vec_dot_bound_limbs(slong len, nmod_t mod);
 mp_limb_t _nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2,
     slong len, nmod_t mod, int nlimbs);
 
+void _nmod_vec_dot_reset(void);
+
+slong _nmod_vec_dot_simd_cutoff(nmod_t mod);
+
 mp_limb_t _nmod_vec_dot_rev(mp_srcptr vec1, mp_srcptr vec2,
     slong len, nmod_t mod, int nlimbs);
 
@@ -12,11 +12,530 @@
 #include "nmod.h"
 #include "nmod_vec.h"
 
-mp_limb_t
-_nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod, int nlimbs)
+#if FLINT_HAVE_CPU_DISPATCH
+# include <immintrin.h>
+#endif
+
+FLINT_FORCE_INLINE mp_limb_t
+_nmod_vec_dot_inline(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod,
+                                                                   int nlimbs)
 {
     mp_limb_t res;
     slong i;
     NMOD_VEC_DOT(res, i, len, vec1[i], vec2[i], mod, nlimbs);
     return res;
 }
+
+#if FLINT_HAVE_CPU_DISPATCH
+
+/*
+    SIMD kernels, chosen by the size of the modulus.
+
+    n < 2^32: the 32 x 32 -> 64 bit products are summed in 64-bit lanes.
+    With nlimbs = 1 the sum is bounded or only needed modulo 2^64, as for
+    the generic code. Otherwise the lanes are split into 32-bit halves,
+    which are accumulated separately, whenever they might overflow.
+
+    2^32 <= n < 2^50: each product is reduced to (-n, n) in double
+    precision, with the low part of the product recovered by an FMA as in
+    fft_small. Blocks of four vectors of these are summed and reduced
+    before being added to the accumulator, which is reduced in turn every
+    eight blocks; this keeps every intermediate value below 2^53.
+
+    n >= 2^50: the entries are split into 32-bit halves and the halves of
+    the four partial products are accumulated in 64-bit lanes.
+
+    The kernels handle a multiple of the vector width; the remaining
+    entries are added when the lanes are combined.
+*/
+
+/* below these lengths the latency of the kernels dominates */
+#define DOT_U32_CUTOFF 16
+#define DOT_D50_CUTOFF 64
+#define DOT_U64_CUTOFF 48
+
+/* (s2, s1, s0) += c 2^shift, where c < 2^64 and shift is a multiple of 32 */
+#define DOT_ADD_SHIFTED(s, c, shift)                                        \
+    do {                                                                    \
+        mp_limb_t __c = (c);                                                \
+        if ((shift) == 0)                                                   \
+            add_sssaaaaaa(s[2], s[1], s[0], s[2], s[1], s[0], 0, 0, __c);   \
+        else if ((shift) == 32)                                             \
+            add_sssaaaaaa(s[2], s[1], s[0], s[2], s[1], s[0],               \
+                                               0, __c >> 32, __c << 32);    \
+        else if ((shift) == 64)                                             \
+            add_sssaaaaaa(s[2], s[1], s[0], s[2], s[1], s[0], 0, __c, 0);   \
+        else                                                                \
+            add_sssaaaaaa(s[2], s[1], s[0], s[2], s[1], s[0],               \
+                                               __c >> 32, __c << 32, 0);    \
+    } while (0)
+
+/* add the products from index i on to (s2, s1, s0) and reduce */
+static mp_limb_t
+_nmod_vec_dot_simd_finish(mp_limb_t * s, mp_srcptr vec1, mp_srcptr vec2,
+                                               slong i, slong len, nmod_t mod)
+{
+    mp_limb_t t1, t0, res;
+
+    for ( ; i < len; i++)
+    {
+        umul_ppmm(t1, t0, vec1[i], vec2[i]);
+        add_sssaaaaaa(s[2], s[1], s[0], s[2], s[1], s[0], 0, t1, t0);
+    }
+
+    if (s[2] == 0)
+    {
+        NMOD2_RED2(res, s[1], s[0], mod);
+    }
+    else
+    {
+        NMOD_RED(s[2], s[2], mod);
+        NMOD_RED3(res, s[2], s[1], s[0], mod);
+    }
+
+    return res;
+}
+
+/* the sum of lanes in (-5n, 5n), plus the remaining products */
+static mp_limb_t
+_nmod_vec_dot_d_finish(const double * c, slong lanes, mp_srcptr vec1,
+                                 mp_srcptr vec2, slong i, slong len, nmod_t mod)
+{
+    mp_limb_t t = 5 * lanes * mod.n;
+    slong k;
+
+    for (k = 0; k < lanes; k++)
+        t += (slong) c[k];
+
+    NMOD_RED(t, t, mod);
+
+    for ( ; i < len; i++)
+        t = nmod_add(t, nmod_mul(vec1[i], vec2[i], mod), mod);
+
+    return t;
+}
+
+FLINT_FORCE_INLINE FLINT_TARGET_AVX2 mp_limb_t
+_hsum_epi64_256(__m256i x)
+{
+    __m128i y = _mm_add_epi64(_mm256_castsi256_si128(x),
+                              _mm256_extracti128_si256(x, 1));
+    return _mm_cvtsi128_si64(y) + _mm_extract_epi64(y, 1);
+}
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX2 mp_limb_t
+_nmod_vec_dot_u32_avx2(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod,
+                                                                   int nlimbs)
+{
+    __m256i a, b, s, lo, hi, mask;
+    mp_limb_t t, u[3] = {0, 0, 0};
+    slong i, j, block;
+
+    if (nlimbs == 1)
+    {
+        s = _mm256_setzero_si256();
+
+        for (i = 0; i + 4 <= len; i += 4)
+        {
+            a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+            b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+            s = _mm256_add_epi64(s, _mm256_mul_epu32(a, b));
+        }
+
+        t = _hsum_epi64_256(s);
+
+        for ( ; i < len; i++)
+            t += vec1[i] * vec2[i];
+
+        NMOD_RED(t, t, mod);
+        return t;
+    }
+
+    /* number of products which can be summed in one lane */
+    block = UWORD(1) << (2 * mod.norm - FLINT_BITS);
+
+    mask = _mm256_set1_epi64x(0xffffffff);
+    lo = hi = _mm256_setzero_si256();
+
+    for (i = 0; i + 4 <= len; )
+    {
+        s = _mm256_setzero_si256();
+
+        for (j = 0; j < block && i + 4 <= len; j++, i += 4)
+        {
+            a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+            b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+            s = _mm256_add_epi64(s, _mm256_mul_epu32(a, b));
+        }
+
+        lo = _mm256_add_epi64(lo, _mm256_and_si256(s, mask));
+        hi = _mm256_add_epi64(hi, _mm256_srli_epi64(s, 32));
+    }
+
+    DOT_ADD_SHIFTED(u, _hsum_epi64_256(lo), 0);
+    DOT_ADD_SHIFTED(u, _hsum_epi64_256(hi), 32);
+
+    return _nmod_vec_dot_simd_finish(u, vec1, vec2, i, len, mod);
+}
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX512 mp_limb_t
+_nmod_vec_dot_u32_avx512(mp_srcptr vec1, mp_srcptr vec2, slong len,
+                                                       nmod_t mod, int nlimbs)
+{
+    __m512i a, b, s, lo, hi, mask;
+    mp_limb_t t, u[3] = {0, 0, 0};
+    slong i, j, block;
+
+    if (nlimbs == 1)
+    {
+        s = _mm512_setzero_si512();
+
+        for (i = 0; i + 8 <= len; i += 8)
+        {
+            a = _mm512_loadu_si512((const void *) (vec1 + i));
+            b = _mm512_loadu_si512((const void *) (vec2 + i));
+            s = _mm512_add_epi64(s, _mm512_mul_epu32(a, b));
+        }
+
+        t = _mm512_reduce_add_epi64(s);
+
+        for ( ; i < len; i++)
+            t += vec1[i] * vec2[i];
+
+        NMOD_RED(t, t, mod);
+        return t;
+    }
+
+    block = UWORD(1) << (2 * mod.norm - FLINT_BITS);
+
+    mask = _mm512_set1_epi64(0xffffffff);
+    lo = hi = _mm512_setzero_si512();
+
+    for (i = 0; i + 8 <= len; )
+    {
+        s = _mm512_setzero_si512();
+
+        for (j = 0; j < block && i + 8 <= len; j++, i += 8)
+        {
+            a = _mm512_loadu_si512((const void *) (vec1 + i));
+            b = _mm512_loadu_si512((const void *) (vec2 + i));
+            s = _mm512_add_epi64(s, _mm512_mul_epu32(a, b));
+        }
+
+        lo = _mm512_add_epi64(lo, _mm512_and_si512(s, mask));
+        hi = _mm512_add_epi64(hi, _mm512_srli_epi64(s, 32));
+    }
+
+    DOT_ADD_SHIFTED(u, _mm512_reduce_add_epi64(lo), 0);
+    DOT_ADD_SHIFTED(u, _mm512_reduce_add_epi64(hi), 32);
+
+    return _nmod_vec_dot_simd_finish(u, vec1, vec2, i, len, mod);
+}
+
+#define ROUND_MODE (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+
+/* exact conversion of integers below 2^52 */
+#define U52_TO_PD256(x) \
+    _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256((x), magic_i)), magic)
+
+/* a b - q n in (-n, n) for 0 <= a, b < n < 2^50 */
+#define MULMOD_PD256(r, a, b)                                               \
+    do {                                                                    \
+        __m256d __a, __b, __h, __l, __q;                                    \
+        __a = U52_TO_PD256(_mm256_loadu_si256((const __m256i *) (a)));      \
+        __b = U52_TO_PD256(_mm256_loadu_si256((const __m256i *) (b)));      \
+        __h = _mm256_mul_pd(__a, __b);                                      \
+        __l = _mm256_fmsub_pd(__a, __b, __h);                               \
+        __q = _mm256_round_pd(_mm256_mul_pd(__h, ninv), ROUND_MODE);        \
+        r = _mm256_add_pd(_mm256_fnmadd_pd(__q, n, __h), __l);              \
+    } while (0)
+
+/* r - q n in [-n/2 - 1, n/2 + 1] for |r| < 2^53 */
+#define REDUCE_PD256(r)                                                     \
+    _mm256_fnmadd_pd(_mm256_round_pd(_mm256_mul_pd(r, ninv), ROUND_MODE), n, r)
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX2 mp_limb_t
+_nmod_vec_dot_d50_avx2(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod)
+{
+    __m256d n, ninv, magic, s, t, r0, r1, r2, r3;
+    __m256i magic_i;
+    double c[4];
+    slong i, j;
+
+    n = _mm256_set1_pd((double) mod.n);
+    ninv = _mm256_set1_pd(1.0 / (double) mod.n);
+    magic = _mm256_set1_pd(4503599627370496.0);     /* 2^52 */
+    magic_i = _mm256_castpd_si256(magic);
+    s = _mm256_setzero_pd();
+
+    for (i = 0, j = 0; i + 4 <= len; )
+    {
+        if (i + 16 <= len)
+        {
+            MULMOD_PD256(r0, vec1 + i + 0, vec2 + i + 0);
+            MULMOD_PD256(r1, vec1 + i + 4, vec2 + i + 4);
+            MULMOD_PD256(r2, vec1 + i + 8, vec2 + i + 8);
+            MULMOD_PD256(r3, vec1 + i + 12, vec2 + i + 12);
+            t = _mm256_add_pd(_mm256_add_pd(r0, r1), _mm256_add_pd(r2, r3));
+            i += 16;
+        }
+        else
+        {
+            MULMOD_PD256(t, vec1 + i, vec2 + i);
+            i += 4;
+        }
+
+        /* |s| < 9 (n/2 + 1) */
+        s = _mm256_add_pd(s, REDUCE_PD256(t));
+
+        if (++j == 8)
+        {
+            s = REDUCE_PD256(s);
+            j = 0;
+        }
+    }
+
+    _mm256_storeu_pd(c, s);
+
+    return _nmod_vec_dot_d_finish(c, 4, vec1, vec2, i, len, mod);
+}
+
+#define MULMOD_PD512(r, a, b)                                               \
+    do {                                                                    \
+        __m512d __a, __b, __h, __l, __q;                                    \
+        __a = _mm512_cvtepu64_pd(_mm512_loadu_si512((const void *) (a)));  \
+        __b = _mm512_cvtepu64_pd(_mm512_loadu_si512((const void *) (b)));  \
+        __h = _mm512_mul_pd(__a, __b);                                      \
+        __l = _mm512_fmsub_pd(__a, __b, __h);                               \
+        __q = _mm512_roundscale_pd(_mm512_mul_pd(__h, ninv), ROUND_MODE);   \
+        r = _mm512_add_pd(_mm512_fnmadd_pd(__q, n, __h), __l);              \
+    } while (0)
+
+#define REDUCE_PD512(r)                                                     \
+    _mm512_fnmadd_pd(_mm512_roundscale_pd(_mm512_mul_pd(r, ninv),           \
+                                                         ROUND_MODE), n, r)
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX512 mp_limb_t
+_nmod_vec_dot_d50_avx512(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod)
+{
+    __m512d n, ninv, s, t, r0, r1, r2, r3;
+    double c[8];
+    slong i, j;
+
+    n = _mm512_set1_pd((double) mod.n);
+    ninv = _mm512_set1_pd(1.0 / (double) mod.n);
+    s = _mm512_setzero_pd();
+
+    for (i = 0, j = 0; i + 8 <= len; )
+    {
+        if (i + 32 <= len)
+        {
+            MULMOD_PD512(r0, vec1 + i + 0, vec2 + i + 0);
+            MULMOD_PD512(r1, vec1 + i + 8, vec2 + i + 8);
+            MULMOD_PD512(r2, vec1 + i + 16, vec2 + i + 16);
+            MULMOD_PD512(r3, vec1 + i + 24, vec2 + i + 24);
+            t = _mm512_add_pd(_mm512_add_pd(r0, r1), _mm512_add_pd(r2, r3));
+            i += 32;
+        }
+        else
+        {
+            MULMOD_PD512(t, vec1 + i, vec2 + i);
+            i += 8;
+        }
+
+        s = _mm512_add_pd(s, REDUCE_PD512(t));
+
+        if (++j == 8)
+        {
+            s = REDUCE_PD512(s);
+            j = 0;
+        }
+    }
+
+    _mm512_storeu_pd(c, s);
+
+    return _nmod_vec_dot_d_finish(c, 8, vec1, vec2, i, len, mod);
+}
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX512 mp_limb_t
+_nmod_vec_dot_u64_avx512(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod)
+{
+    __m512i a, b, ah, bh, p, c0, c1, c2, c3, mask;
+    mp_limb_t u[3] = {0, 0, 0};
+    slong i;
+
+    mask = _mm512_set1_epi64(0xffffffff);
+    c0 = c1 = c2 = c3 = _mm512_setzero_si512();
+
+    /* c0 + 2^32 c1 + 2^64 c2 + 2^96 c3 */
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = _mm512_loadu_si512((const void *) (vec1 + i));
+        b = _mm512_loadu_si512((const void *) (vec2 + i));
+        ah = _mm512_srli_epi64(a, 32);
+        bh = _mm512_srli_epi64(b, 32);
+
+        p = _mm512_mul_epu32(a, b);
+        c0 = _mm512_add_epi64(c0, _mm512_and_si512(p, mask));
+        c1 = _mm512_add_epi64(c1, _mm512_srli_epi64(p, 32));
+        p = _mm512_mul_epu32(a, bh);
+        c1 = _mm512_add_epi64(c1, _mm512_and_si512(p, mask));
+        c2 = _mm512_add_epi64(c2, _mm512_srli_epi64(p, 32));
+        p = _mm512_mul_epu32(ah, b);
+        c1 = _mm512_add_epi64(c1, _mm512_and_si512(p, mask));
+        c2 = _mm512_add_epi64(c2, _mm512_srli_epi64(p, 32));
+        p = _mm512_mul_epu32(ah, bh);
+        c2 = _mm512_add_epi64(c2, _mm512_and_si512(p, mask));
+        c3 = _mm512_add_epi64(c3, _mm512_srli_epi64(p, 32));
+    }
+
+    /* propagate the carries so that no lane sum can overflow */
+    c1 = _mm512_add_epi64(c1, _mm512_srli_epi64(c0, 32));
+    c0 = _mm512_and_si512(c0, mask);
+    c2 = _mm512_add_epi64(c2, _mm512_srli_epi64(c1, 32));
+    c1 = _mm512_and_si512(c1, mask);
+    c3 = _mm512_add_epi64(c3, _mm512_srli_epi64(c2, 32));
+    c2 = _mm512_and_si512(c2, mask);
+
+    DOT_ADD_SHIFTED(u, _mm512_reduce_add_epi64(c0), 0);
+    DOT_ADD_SHIFTED(u, _mm512_reduce_add_epi64(c1), 32);
+    DOT_ADD_SHIFTED(u, _mm512_reduce_add_epi64(c2), 64);
+    DOT_ADD_SHIFTED(u, _mm512_reduce_add_epi64(c3), 96);
+
+    return _nmod_vec_dot_simd_finish(u, vec1, vec2, i, len, mod);
+}
+
+static FLINT_TARGET_AVX2 mp_limb_t
+_nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod,
+                                                                   int nlimbs)
+{
+    if (NMOD_BITS(mod) <= 32)
+    {
+        if (len >= DOT_U32_CUTOFF && mod.n != 1)
+            return _nmod_vec_dot_u32_avx2(vec1, vec2, len, mod, nlimbs);
+    }
+    else if (NMOD_BITS(mod) <= 50)
+    {
+        if (len >= DOT_D50_CUTOFF)
+            return _nmod_vec_dot_d50_avx2(vec1, vec2, len, mod);
+    }
+
+    return _nmod_vec_dot_inline(vec1, vec2, len, mod, nlimbs);
+}
+
+static FLINT_TARGET_AVX512 mp_limb_t
+_nmod_vec_dot_avx512(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod,
+                                                                   int nlimbs)
+{
+    if (NMOD_BITS(mod) <= 32)
+    {
+        if (len >= DOT_U32_CUTOFF && mod.n != 1)
+            return _nmod_vec_dot_u32_avx512(vec1, vec2, len, mod, nlimbs);
+    }
+    else if (NMOD_BITS(mod) <= 50)
+    {
+        if (len >= DOT_D50_CUTOFF)
+            return _nmod_vec_dot_d50_avx512(vec1, vec2, len, mod);
+    }
+    else
+    {
+        if (len >= DOT_U64_CUTOFF)
+            return _nmod_vec_dot_u64_avx512(vec1, vec2, len, mod);
+    }
+
+    return _nmod_vec_dot_inline(vec1, vec2, len, mod, nlimbs);
+}
+
+static mp_limb_t
+_nmod_vec_dot_generic(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod,
+                                                                   int nlimbs)
+{
+    return _nmod_vec_dot_inline(vec1, vec2, len, mod, nlimbs);
+}
+
+typedef mp_limb_t (* _nmod_vec_dot_func_t)(mp_srcptr, mp_srcptr, slong,
+                                                               nmod_t, int);
+
+static mp_limb_t _nmod_vec_dot_resolve(mp_srcptr vec1, mp_srcptr vec2,
+                                        slong len, nmod_t mod, int nlimbs);
+
+/* the kernel for the CPU features, selected on first use */
+static _nmod_vec_dot_func_t _nmod_vec_dot_func = _nmod_vec_dot_resolve;
+
+static mp_limb_t
+_nmod_vec_dot_resolve(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod,
+                                                                   int nlimbs)
+{
+    ulong cpu = flint_get_cpu_features();
+    _nmod_vec_dot_func_t func;
+
+    if (cpu & FLINT_CPU_AVX512)
+        func = _nmod_vec_dot_avx512;
+    else if (cpu & FLINT_CPU_AVX2)
+        func = _nmod_vec_dot_avx2;
+    else
+        func = _nmod_vec_dot_generic;
+
+    /* a racing first call stores the same value twice */
+    _nmod_vec_dot_func = func;
+
+    return func(vec1, vec2, len, mod, nlimbs);
+}
+
+void
+_nmod_vec_dot_reset(void)
+{
+    _nmod_vec_dot_func = _nmod_vec_dot_resolve;
+}
+
+slong
+_nmod_vec_dot_simd_cutoff(nmod_t mod)
+{
+    ulong cpu = flint_get_cpu_features();
+
+    if (!(cpu & FLINT_CPU_AVX2) || mod.n == 1)
+        return WORD_MAX;
+
+    if (NMOD_BITS(mod) <= 32)
+        return DOT_U32_CUTOFF;
+    else if (NMOD_BITS(mod) <= 50)
+        return DOT_D50_CUTOFF;
+    else if (cpu & FLINT_CPU_AVX512)
+        return DOT_U64_CUTOFF;
+    else
+        return WORD_MAX;
+}
+
+#else
+
+void
+_nmod_vec_dot_reset(void)
+{
+}
+
+slong
+_nmod_vec_dot_simd_cutoff(nmod_t FLINT_UNUSED(mod))
+{
+    return WORD_MAX;
+}
+
+#endif
+
+mp_limb_t
+_nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod, int nlimbs)
+{
+#if FLINT_HAVE_CPU_DISPATCH
+    /* keep the 64-bit lane sums of the kernels from overflowing */
+    if (len > (WORD(1) << 30))
+    {
+        slong m = WORD(1) << 30;
+
+        return nmod_add(_nmod_vec_dot(vec1, vec2, m, mod, nlimbs),
+                   _nmod_vec_dot(vec1 + m, vec2 + m, len - m, mod, nlimbs), mod);
+    }
+
+    return _nmod_vec_dot_func(vec1, vec2, len, mod, nlimbs);
+#else
+    return _nmod_vec_dot_inline(vec1, vec2, len, mod, nlimbs);
+#endif
+}
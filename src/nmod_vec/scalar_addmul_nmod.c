@@ -13,6 +13,10 @@
 #include "nmod.h"
 #include "nmod_vec.h"
 
+#if FLINT_HAVE_CPU_DISPATCH
+# include <immintrin.h>
+#endif
+
 void _nmod_vec_scalar_addmul_nmod_fullword(mp_ptr res, mp_srcptr vec,
 				             slong len, mp_limb_t c, nmod_t mod)
 {
@@ -54,9 +58,178 @@ void _nmod_vec_scalar_addmul_nmod_shoup(mp_ptr res, mp_srcptr vec,
     }
 }
 
+#if FLINT_HAVE_CPU_DISPATCH
+
+/*
+    SIMD kernels. For n < 2^32 the products are reduced with Shoup's
+    method using a 32-bit precomputed quotient, all in 64-bit lanes. For
+    n < 2^50 they are reduced in double precision as in _nmod_vec_dot.
+    Larger moduli use the scalar code.
+*/
+
+#define ADDMUL_SIMD_CUTOFF 8
+
+#define ROUND_MODE (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+
+/* x - n if x >= n, otherwise x, for 0 <= x < 2n < 2^63 */
+#define RED_EPI64_256(x, n)                                                 \
+    _mm256_castpd_si256(_mm256_blendv_pd(                                   \
+        _mm256_castsi256_pd(_mm256_sub_epi64(x, n)), _mm256_castsi256_pd(x), \
+        _mm256_castsi256_pd(_mm256_sub_epi64(x, n))))
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX2 void
+_nmod_vec_scalar_addmul_nmod_u32_avx2(mp_ptr res, mp_srcptr vec,
+                               slong len, mp_limb_t c, nmod_t mod)
+{
+    __m256i x, q, r, vc, vcpre, vn;
+    slong i;
+
+    vc = _mm256_set1_epi64x(c);
+    vcpre = _mm256_set1_epi64x((c << 32) / mod.n);
+    vn = _mm256_set1_epi64x(mod.n);
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        x = _mm256_loadu_si256((const __m256i *) (vec + i));
+        q = _mm256_srli_epi64(_mm256_mul_epu32(x, vcpre), 32);
+        r = _mm256_sub_epi64(_mm256_mul_epu32(x, vc), _mm256_mul_epu32(q, vn));
+        r = RED_EPI64_256(r, vn);
+        r = _mm256_add_epi64(r, _mm256_loadu_si256((const __m256i *) (res + i)));
+        r = RED_EPI64_256(r, vn);
+        _mm256_storeu_si256((__m256i *) (res + i), r);
+    }
+
+    _nmod_vec_scalar_addmul_nmod_generic(res + i, vec + i, len - i, c, mod);
+}
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX512 void
+_nmod_vec_scalar_addmul_nmod_u32_avx512(mp_ptr res, mp_srcptr vec,
+                               slong len, mp_limb_t c, nmod_t mod)
+{
+    __m512i x, q, r, vc, vcpre, vn;
+    slong i;
+
+    vc = _mm512_set1_epi64(c);
+    vcpre = _mm512_set1_epi64((c << 32) / mod.n);
+    vn = _mm512_set1_epi64(mod.n);
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        x = _mm512_loadu_si512((const void *) (vec + i));
+        q = _mm512_srli_epi64(_mm512_mul_epu32(x, vcpre), 32);
+        r = _mm512_sub_epi64(_mm512_mul_epu32(x, vc), _mm512_mul_epu32(q, vn));
+        r = _mm512_min_epu64(r, _mm512_sub_epi64(r, vn));
+        r = _mm512_add_epi64(r, _mm512_loadu_si512((const void *) (res + i)));
+        r = _mm512_min_epu64(r, _mm512_sub_epi64(r, vn));
+        _mm512_storeu_si512((void *) (res + i), r);
+    }
+
+    _nmod_vec_scalar_addmul_nmod_generic(res + i, vec + i, len - i, c, mod);
+}
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX2 void
+_nmod_vec_scalar_addmul_nmod_d50_avx2(mp_ptr res, mp_srcptr vec,
+                               slong len, mp_limb_t c, nmod_t mod)
+{
+    __m256d x, y, h, l, q, r, t, vc, n, ninv, magic;
+    __m256i magic_i;
+    slong i;
+
+    vc = _mm256_set1_pd((double) c);
+    n = _mm256_set1_pd((double) mod.n);
+    ninv = _mm256_set1_pd(1.0 / (double) mod.n);
+    magic = _mm256_set1_pd(4503599627370496.0);     /* 2^52 */
+    magic_i = _mm256_castpd_si256(magic);
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        /* exact conversions of integers below 2^52 */
+        x = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+              _mm256_loadu_si256((const __m256i *) (vec + i)), magic_i)), magic);
+        y = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+              _mm256_loadu_si256((const __m256i *) (res + i)), magic_i)), magic);
+
+        /* x c - q n in (-n, n) */
+        h = _mm256_mul_pd(x, vc);
+        l = _mm256_fmsub_pd(x, vc, h);
+        q = _mm256_round_pd(_mm256_mul_pd(h, ninv), ROUND_MODE);
+        r = _mm256_add_pd(_mm256_fnmadd_pd(q, n, h), l);
+
+        /* y + r in [0, n) */
+        r = _mm256_add_pd(r, y);
+        t = _mm256_sub_pd(r, n);
+        r = _mm256_blendv_pd(t, r, t);
+        t = _mm256_add_pd(r, n);
+        r = _mm256_blendv_pd(r, t, r);
+
+        _mm256_storeu_si256((__m256i *) (res + i), _mm256_xor_si256(
+              _mm256_castpd_si256(_mm256_add_pd(r, magic)), magic_i));
+    }
+
+    _nmod_vec_scalar_addmul_nmod_generic(res + i, vec + i, len - i, c, mod);
+}
+
+FLINT_STATIC_NOINLINE FLINT_TARGET_AVX512 void
+_nmod_vec_scalar_addmul_nmod_d50_avx512(mp_ptr res, mp_srcptr vec,
+                               slong len, mp_limb_t c, nmod_t mod)
+{
+    __m512d x, y, h, l, q, r, vc, n, ninv, zero;
+    slong i;
+
+    vc = _mm512_set1_pd((double) c);
+    n = _mm512_set1_pd((double) mod.n);
+    ninv = _mm512_set1_pd(1.0 / (double) mod.n);
+    zero = _mm512_setzero_pd();
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        x = _mm512_cvtepu64_pd(_mm512_loadu_si512((const void *) (vec + i)));
+        y = _mm512_cvtepu64_pd(_mm512_loadu_si512((const void *) (res + i)));
+
+        h = _mm512_mul_pd(x, vc);
+        l = _mm512_fmsub_pd(x, vc, h);
+        q = _mm512_roundscale_pd(_mm512_mul_pd(h, ninv), ROUND_MODE);
+        r = _mm512_add_pd(_mm512_fnmadd_pd(q, n, h), l);
+
+        r = _mm512_add_pd(r, y);
+        r = _mm512_mask_sub_pd(r, _mm512_cmp_pd_mask(r, n, _CMP_GE_OQ), r, n);
+        r = _mm512_mask_add_pd(r, _mm512_cmp_pd_mask(r, zero, _CMP_LT_OQ), r, n);
+
+        _mm512_storeu_si512((void *) (res + i), _mm512_cvtpd_epu64(r));
+    }
+
+    _nmod_vec_scalar_addmul_nmod_generic(res + i, vec + i, len - i, c, mod);
+}
+
+#endif
+
 void _nmod_vec_scalar_addmul_nmod(mp_ptr res, mp_srcptr vec,
 				             slong len, mp_limb_t c, nmod_t mod)
 {
+#if FLINT_HAVE_CPU_DISPATCH
+    if (len >= ADDMUL_SIMD_CUTOFF && NMOD_BITS(mod) <= 50)
+    {
+        ulong cpu = flint_get_cpu_features();
+
+        if (cpu & FLINT_CPU_AVX512)
+        {
+            if (NMOD_BITS(mod) <= 32)
+                _nmod_vec_scalar_addmul_nmod_u32_avx512(res, vec, len, c, mod);
+            else
+                _nmod_vec_scalar_addmul_nmod_d50_avx512(res, vec, len, c, mod);
+            return;
+        }
+        else if (cpu & FLINT_CPU_AVX2)
+        {
+            if (NMOD_BITS(mod) <= 32)
+                _nmod_vec_scalar_addmul_nmod_u32_avx2(res, vec, len, c, mod);
+            else
+                _nmod_vec_scalar_addmul_nmod_d50_avx2(res, vec, len, c, mod);
+            return;
+        }
+    }
+#endif
+
     if (NMOD_BITS(mod) == FLINT_BITS)
         _nmod_vec_scalar_addmul_nmod_fullword(res, vec, len, c, mod);
     else if (len > 10)
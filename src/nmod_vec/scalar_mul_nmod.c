@@ -10,6 +10,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include "ulong_extras.h"
 #include "nmod.h"
 #include "nmod_vec.h"
 
@@ -31,13 +32,60 @@ void _nmod_vec_scalar_mul_nmod_generic(mp_ptr res, mp_srcptr vec,
         NMOD_MUL_PRENORM(res[i], vec[i], c << mod.norm, mod);
 }
 
-void _nmod_vec_scalar_mul_nmod(mp_ptr res, mp_srcptr vec,
+FLINT_FORCE_INLINE void
+_nmod_vec_scalar_mul_nmod_inline(mp_ptr res, mp_srcptr vec,
                                slong len, mp_limb_t c, nmod_t mod)
 {
+    slong i;
+
     if (NMOD_BITS(mod) == FLINT_BITS)
-        _nmod_vec_scalar_mul_nmod_fullword(res, vec, len, c, mod);
+    {
+        for (i = 0; i < len; i++)
+            NMOD_MUL_FULLWORD(res[i], vec[i], c, mod);
+    }
     else if (len > 10)
-        _nmod_vec_scalar_mul_nmod_shoup(res, vec, len, c, mod);
+    {
+        mp_limb_t w_pr = n_mulmod_precomp_shoup(c, mod.n);
+
+        for (i = 0; i < len; i++)
+            res[i] = n_mulmod_shoup(c, vec[i], w_pr, mod.n);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            NMOD_MUL_PRENORM(res[i], vec[i], c << mod.norm, mod);
+    }
+}
+
+#if FLINT_HAVE_CPU_DISPATCH
+
+static FLINT_TARGET_AVX2 void
+_nmod_vec_scalar_mul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+                               slong len, mp_limb_t c, nmod_t mod)
+{
+    _nmod_vec_scalar_mul_nmod_inline(res, vec, len, c, mod);
+}
+
+static FLINT_TARGET_AVX512 void
+_nmod_vec_scalar_mul_nmod_avx512(mp_ptr res, mp_srcptr vec,
+                               slong len, mp_limb_t c, nmod_t mod)
+{
+    _nmod_vec_scalar_mul_nmod_inline(res, vec, len, c, mod);
+}
+
+#endif
+
+void _nmod_vec_scalar_mul_nmod(mp_ptr res, mp_srcptr vec,
+                               slong len, mp_limb_t c, nmod_t mod)
+{
+#if FLINT_HAVE_CPU_DISPATCH
+    ulong cpu = flint_get_cpu_features();
+
+    if (cpu & FLINT_CPU_AVX512)
+        _nmod_vec_scalar_mul_nmod_avx512(res, vec, len, c, mod);
+    else if (cpu & FLINT_CPU_AVX2)
+        _nmod_vec_scalar_mul_nmod_avx2(res, vec, len, c, mod);
     else
-        _nmod_vec_scalar_mul_nmod_generic(res, vec, len, c, mod);
+#endif
+        _nmod_vec_scalar_mul_nmod_inline(res, vec, len, c, mod);
 }
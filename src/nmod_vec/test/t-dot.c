@@ -16,7 +16,10 @@
 
 TEST_FUNCTION_START(nmod_vec_dot, state)
 {
-    int i;
+    /* from the generic code up to every kernel the cpu supports */
+    const ulong features[3] = {0, FLINT_CPU_AVX2,
+                               FLINT_CPU_AVX2 | FLINT_CPU_AVX512};
+    int i, k;
 
     for (i = 0; i < 1000 * flint_test_multiplier(); i++)
     {
@@ -39,9 +42,14 @@ TEST_FUNCTION_START(nmod_vec_dot, state)
         _nmod_vec_randtest(x, state, len, mod);
         _nmod_vec_randtest(y, state, len, mod);
 
-        limbs1 = _nmod_vec_dot_bound_limbs(len, mod);
+        /* worst case for the accumulators */
+        if (n_randint(state, 8) == 0)
+        {
+            for (j = 0; j < len; j++)
+                x[j] = y[j] = m - 1;
+        }
 
-        res = _nmod_vec_dot(x, y, len, mod, limbs1);
+        limbs1 = _nmod_vec_dot_bound_limbs(len, mod);
 
         mpz_init(s);
         mpz_init(t);
@@ -54,16 +62,26 @@ TEST_FUNCTION_START(nmod_vec_dot, state)
 
         flint_mpz_mod_ui(s, s, m);
 
-        if (flint_mpz_get_ui(s) != res)
+        for (k = 0; k < 3; k++)
         {
-            flint_printf("FAIL:\n");
-            flint_printf("m = %wu\n", m);
-            flint_printf("len = %wd\n", len);
-            flint_printf("limbs1 = %d\n", limbs1);
-            fflush(stdout);
-            flint_abort();
+            flint_set_cpu_features(features[k]);
+
+            res = _nmod_vec_dot(x, y, len, mod, limbs1);
+
+            if (flint_mpz_get_ui(s) != res)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("m = %wu\n", m);
+                flint_printf("len = %wd\n", len);
+                flint_printf("limbs1 = %d\n", limbs1);
+                flint_printf("features = %wu\n", features[k]);
+                fflush(stdout);
+                flint_abort();
+            }
         }
 
+        flint_set_cpu_features(UWORD_MAX);
+
         mpz_clear(s);
         mpz_clear(t);
 
@@ -38,8 +38,13 @@ TEST_FUNCTION_START(nmod_vec_scalar_addmul_nmod, state)
         _nmod_vec_scalar_mul_nmod(vec3, vec, len, c, mod);
         _nmod_vec_add(vec3, vec3, vec2, len, mod);
 
+        /* exercise every kernel the cpu supports */
+        flint_set_cpu_features(n_randlimb(state));
+
         _nmod_vec_scalar_addmul_nmod(vec2, vec, len, c, mod);
 
+        flint_set_cpu_features(UWORD_MAX);
+
         result = _nmod_vec_equal(vec2, vec3, len);
         if (!result)
         {
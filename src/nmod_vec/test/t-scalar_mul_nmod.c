@@ -40,9 +40,12 @@ TEST_FUNCTION_START(nmod_vec_scalar_mul_nmod, state)
         _nmod_vec_randtest(vec, state, len, mod);
         _nmod_vec_randtest(vec2, state, len, mod);
 
+        /* compare the kernels for different cpu features */
+        flint_set_cpu_features(n_randlimb(state));
         _nmod_vec_add(vec3, vec, vec2, len, mod);
         _nmod_vec_scalar_mul_nmod(vec3, vec3, len, c, mod);
 
+        flint_set_cpu_features(n_randlimb(state));
         _nmod_vec_scalar_mul_nmod(vec, vec, len, c, mod);
         _nmod_vec_scalar_mul_nmod(vec2, vec2, len, c, mod);
         _nmod_vec_add(vec, vec, vec2, len, mod);
@@ -61,5 +64,7 @@ TEST_FUNCTION_START(nmod_vec_scalar_mul_nmod, state)
         _nmod_vec_clear(vec3);
     }
 
+    flint_set_cpu_features(UWORD_MAX);
+
     TEST_FUNCTION_END(state);
 }
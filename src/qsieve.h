@@ -75,6 +75,9 @@ typedef struct
    slong * small;     /* exponents of small prime factors in relations */
    fac_t * factor;    /* factors for a relation */
    slong num_factors; /* number of factors found in a relation */
+   char * rels;       /* relations found by this thread, in file format */
+   slong rels_len;    /* number of bytes used in rels */
+   slong rels_alloc;  /* number of bytes allocated for rels */
 } qs_poly_s;
 
 typedef qs_poly_s qs_poly_t[1];
@@ -85,8 +88,7 @@ typedef struct
 #if FLINT_USES_PTHREAD
    pthread_mutex_t mutex;
 #endif
-   thread_pool_handle * handles;
-   slong num_handles;
+   slong num_handles;      /* maximum number of helper threads */
 
    fmpz_t n;               /* Number to factor */
 
@@ -353,6 +355,11 @@ slong qsieve_merge_relations(qs_t qs_inf);
 void qsieve_write_to_file(qs_t qs_inf, mp_limb_t prime,
                                                      const fmpz_t Y, const qs_poly_t poly);
 
+void qsieve_write_to_buffer(qs_t qs_inf, mp_limb_t prime,
+                                                     const fmpz_t Y, qs_poly_t poly);
+
+void qsieve_flush_relations(qs_t qs_inf, qs_poly_t poly);
+
 hash_t * qsieve_get_table_entry(qs_t qs_inf, mp_limb_t prime);
 
 void qsieve_add_to_hashtable(qs_t qs_inf, mp_limb_t prime);
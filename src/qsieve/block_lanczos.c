@@ -22,6 +22,7 @@ benefit from your work.
 
 
 #include "ulong_extras.h"
+#include "thread_support.h"
 #include "qsieve.h"
 
 #ifdef __GNUC__
@@ -256,21 +257,40 @@ static void precompute_Nx64_64x64(uint64_t *x, uint64_t *c) {
 }
 
 /*-------------------------------------------------------------------*/
-static void mul_Nx64_64x64_acc(uint64_t *v, uint64_t *x, uint64_t *c,
-				uint64_t *y, slong n) {
 
-	/* let v[][] be a n x 64 matrix with elements in GF(2),
-	   represented as an array of n 64-bit words. Let c[][]
-	   be an 8 x 256 scratch matrix of 64-bit words.
-	   This code multiplies v[][] by the 64x64 matrix
-	   x[][], then XORs the n x 64 result into y[][] */
+/* Number of columns below which a block of work is not worth a thread */
+#define LANCZOS_BLOCK_COLS 4096
 
-    slong i;
-	uint64_t word;
+static slong lanczos_num_blocks(slong n) {
 
-	precompute_Nx64_64x64(x, c);
+	/* the number of blocks the size-n vectors are split into
+	   for the parallel kernels below; 1 means serial */
 
-	for (i = 0; i < n; i++) {
+	slong nb = FLINT_MIN(flint_get_num_threads(), n / LANCZOS_BLOCK_COLS);
+
+	return FLINT_MAX(nb, 1);
+}
+
+typedef struct {
+	slong vsize;
+	slong dense_rows;
+	slong ncols;
+	la_col_t *A;
+	uint64_t *x;
+	uint64_t *y;
+	uint64_t *b;
+	uint64_t *c;
+	slong num_blocks;
+} lanczos_arg_t;
+
+/*-------------------------------------------------------------------*/
+static void mul_Nx64_64x64_acc_range(uint64_t *v, uint64_t *c,
+				uint64_t *y, slong start, slong stop) {
+
+	slong i;
+	uint64_t word;
+
+	for (i = start; i < stop; i++) {
 		word = v[i];
 		y[i] ^=  c[ 0*256 + ((word>> 0) & 0xff) ]
 		       ^ c[ 1*256 + ((word>> 8) & 0xff) ]
@@ -283,20 +303,55 @@ static void mul_Nx64_64x64_acc(uint64_t *v, uint64_t *x, uint64_t *c,
 	}
 }
 
+static void mul_Nx64_64x64_acc_worker(slong k, void *varg) {
+
+	lanczos_arg_t *arg = (lanczos_arg_t *) varg;
+	slong n = arg->ncols;
+
+	mul_Nx64_64x64_acc_range(arg->x, arg->c, arg->y,
+			(k * n) / arg->num_blocks, ((k + 1) * n) / arg->num_blocks);
+}
+
+static void mul_Nx64_64x64_acc(uint64_t *v, uint64_t *x, uint64_t *c,
+				uint64_t *y, slong n) {
+
+	/* let v[][] be a n x 64 matrix with elements in GF(2),
+	   represented as an array of n 64-bit words. Let c[][]
+	   be an 8 x 256 scratch matrix of 64-bit words.
+	   This code multiplies v[][] by the 64x64 matrix
+	   x[][], then XORs the n x 64 result into y[][] */
+
+	slong nb = lanczos_num_blocks(n);
+
+	precompute_Nx64_64x64(x, c);
+
+	if (nb == 1) {
+		mul_Nx64_64x64_acc_range(v, c, y, 0, n);
+	}
+	else {
+		lanczos_arg_t arg;
+
+		arg.ncols = n;
+		arg.x = v;
+		arg.y = y;
+		arg.c = c;
+		arg.num_blocks = nb;
+
+		flint_parallel_do(mul_Nx64_64x64_acc_worker, &arg, nb, nb,
+							FLINT_PARALLEL_UNIFORM);
+	}
+}
+
 /*-------------------------------------------------------------------*/
-static void mul_64xN_Nx64(uint64_t *x, uint64_t *y,
-			   uint64_t *c, uint64_t *xy, slong n) {
+static void mul_64xN_Nx64_range(uint64_t *x, uint64_t *y,
+			   uint64_t *c, slong start, slong stop) {
 
-	/* Let x and y be n x 64 matrices. This routine computes
-	   the 64 x 64 matrix xy[][] given by transpose(x) * y.
-	   c[][] is a 256 x 8 scratch matrix of 64-bit words. */
+	/* XOR the rows start to stop of y[] into the 8 x 256
+	   table c[][], indexed by the bytes of x[] */
 
 	slong i;
 
-	memset(c, 0, 256 * 8 * sizeof(uint64_t));
-	memset(xy, 0, 64 * sizeof(uint64_t));
-
-	for (i = 0; i < n; i++) {
+	for (i = start; i < stop; i++) {
 		uint64_t xi = x[i];
 		uint64_t yi = y[i];
 		c[ 0*256 + ( xi        & 0xff) ] ^= yi;
@@ -308,7 +363,54 @@ static void mul_64xN_Nx64(uint64_t *x, uint64_t *y,
 		c[ 6*256 + ((xi >> 48) & 0xff) ] ^= yi;
 		c[ 7*256 + ((xi >> 56)       ) ] ^= yi;
 	}
+}
+
+static void mul_64xN_Nx64_worker(slong k, void *varg) {
+
+	lanczos_arg_t *arg = (lanczos_arg_t *) varg;
+	slong n = arg->ncols;
+	uint64_t *c = arg->c + k * 256 * 8;
+
+	memset(c, 0, 256 * 8 * sizeof(uint64_t));
+	mul_64xN_Nx64_range(arg->x, arg->y, c,
+			(k * n) / arg->num_blocks, ((k + 1) * n) / arg->num_blocks);
+}
+
+static void mul_64xN_Nx64(uint64_t *x, uint64_t *y,
+			   uint64_t *c, uint64_t *xy, slong n) {
+
+	/* Let x and y be n x 64 matrices. This routine computes
+	   the 64 x 64 matrix xy[][] given by transpose(x) * y.
+	   c[][] is a 256 x 8 scratch matrix of 64-bit words,
+	   or num_blocks of these when working in parallel. */
+
+	slong i, k;
+	slong nb = lanczos_num_blocks(n);
+
+	memset(xy, 0, 64 * sizeof(uint64_t));
+
+	if (nb == 1) {
+		memset(c, 0, 256 * 8 * sizeof(uint64_t));
+		mul_64xN_Nx64_range(x, y, c, 0, n);
+	}
+	else {
+		lanczos_arg_t arg;
 
+		arg.ncols = n;
+		arg.x = x;
+		arg.y = y;
+		arg.c = c;
+		arg.num_blocks = nb;
+
+		flint_parallel_do(mul_64xN_Nx64_worker, &arg, nb, nb,
+							FLINT_PARALLEL_UNIFORM);
+
+		/* the tables are linear in y[], so they can be summed */
+
+		for (k = 1; k < nb; k++)
+			for (i = 0; i < 256 * 8; i++)
+				c[i] ^= c[k * 256 * 8 + i];
+	}
 
 	for(i = 0; i < 8; i++) {
 
@@ -485,20 +587,15 @@ static slong find_nonsingular_sub(uint64_t *t, slong *s,
 }
 
 /*-------------------------------------------------------------------*/
-void mul_MxN_Nx64(slong vsize, slong dense_rows,
-		slong ncols, la_col_t *A,
-		uint64_t *x, uint64_t *b) {
+static void mul_MxN_Nx64_range(slong dense_rows, la_col_t *A,
+		uint64_t *x, uint64_t *b, slong start, slong stop) {
 
-	/* Multiply the vector x[] by the matrix A (stored
-	   columnwise) and put the result in b[]. vsize
-	   refers to the number of uint64_t's allocated for
-	   x[] and b[]; vsize is probably different from ncols */
+	/* XOR the product of columns start to stop of A
+	   with x[] into b[] */
 
 	slong i, j;
 
-	memset(b, 0, vsize * sizeof(uint64_t));
-
-	for (i = 0; i < ncols; i++) {
+	for (i = start; i < stop; i++) {
 		la_col_t *col = A + i;
 		slong *row_entries = col->data;
 		uint64_t tmp = x[i];
@@ -509,7 +606,7 @@ void mul_MxN_Nx64(slong vsize, slong dense_rows,
 	}
 
 	if (dense_rows) {
-		for (i = 0; i < ncols; i++) {
+		for (i = start; i < stop; i++) {
 			la_col_t *col = A + i;
 			slong *row_entries = col->data + col->weight;
 			uint64_t tmp = x[i];
@@ -524,17 +621,85 @@ void mul_MxN_Nx64(slong vsize, slong dense_rows,
 	}
 }
 
-/*-------------------------------------------------------------------*/
-void mul_trans_MxN_Nx64(slong dense_rows, slong ncols,
-			la_col_t *A, uint64_t *x, uint64_t *b) {
+static void mul_MxN_Nx64_worker(slong k, void *varg) {
 
-	/* Multiply the vector x[] by the transpose of the
-	   matrix A and put the result in b[]. Since A is stored
-	   by columns, this is just a matrix-vector product */
+	/* block k of the columns goes to its own copy of the
+	   output vector; block 0 writes to b[] itself */
+
+	lanczos_arg_t *arg = (lanczos_arg_t *) varg;
+	slong n = arg->ncols;
+	uint64_t *b = (k == 0) ? arg->b : arg->c + (k - 1) * arg->vsize;
+
+	memset(b, 0, arg->vsize * sizeof(uint64_t));
+	mul_MxN_Nx64_range(arg->dense_rows, arg->A, arg->x, b,
+			(k * n) / arg->num_blocks, ((k + 1) * n) / arg->num_blocks);
+}
+
+static void mul_MxN_Nx64_reduce_worker(slong k, void *varg) {
+
+	/* XOR the partial products into block k of b[] */
+
+	lanczos_arg_t *arg = (lanczos_arg_t *) varg;
+	slong i, j, start, stop;
+
+	start = (k * arg->vsize) / arg->num_blocks;
+	stop = ((k + 1) * arg->vsize) / arg->num_blocks;
+
+	for (j = 1; j < arg->num_blocks; j++) {
+		uint64_t *c = arg->c + (j - 1) * arg->vsize;
+
+		for (i = start; i < stop; i++)
+			arg->b[i] ^= c[i];
+	}
+}
+
+void mul_MxN_Nx64(slong vsize, slong dense_rows,
+		slong ncols, la_col_t *A,
+		uint64_t *x, uint64_t *b) {
+
+	/* Multiply the vector x[] by the matrix A (stored
+	   columnwise) and put the result in b[]. vsize
+	   refers to the number of uint64_t's allocated for
+	   x[] and b[]; vsize is probably different from ncols */
+
+	slong nb = lanczos_num_blocks(ncols);
+
+	if (nb == 1) {
+		memset(b, 0, vsize * sizeof(uint64_t));
+		mul_MxN_Nx64_range(dense_rows, A, x, b, 0, ncols);
+	}
+	else {
+		lanczos_arg_t arg;
+
+		/* the scatter into b[] cannot be split by columns
+		   without write conflicts, so every block gets a
+		   private output vector and these are summed */
+
+		arg.vsize = vsize;
+		arg.dense_rows = dense_rows;
+		arg.ncols = ncols;
+		arg.A = A;
+		arg.x = x;
+		arg.b = b;
+		arg.c = (uint64_t *) flint_malloc((nb - 1) * vsize * sizeof(uint64_t));
+		arg.num_blocks = nb;
+
+		flint_parallel_do(mul_MxN_Nx64_worker, &arg, nb, nb,
+							FLINT_PARALLEL_UNIFORM);
+		flint_parallel_do(mul_MxN_Nx64_reduce_worker, &arg, nb, nb,
+							FLINT_PARALLEL_UNIFORM);
+
+		flint_free(arg.c);
+	}
+}
+
+/*-------------------------------------------------------------------*/
+static void mul_trans_MxN_Nx64_range(slong dense_rows, la_col_t *A,
+		uint64_t *x, uint64_t *b, slong start, slong stop) {
 
 	slong i, j;
 
-	for (i = 0; i < ncols; i++) {
+	for (i = start; i < stop; i++) {
 		la_col_t *col = A + i;
 		slong *row_entries = col->data;
 		uint64_t accum = 0;
@@ -546,7 +711,7 @@ void mul_trans_MxN_Nx64(slong dense_rows, slong ncols,
 	}
 
 	if (dense_rows) {
-		for (i = 0; i < ncols; i++) {
+		for (i = start; i < stop; i++) {
 			la_col_t *col = A + i;
 			slong *row_entries = col->data + col->weight;
 			uint64_t accum = b[i];
@@ -562,6 +727,43 @@ void mul_trans_MxN_Nx64(slong dense_rows, slong ncols,
 	}
 }
 
+static void mul_trans_MxN_Nx64_worker(slong k, void *varg) {
+
+	lanczos_arg_t *arg = (lanczos_arg_t *) varg;
+	slong n = arg->ncols;
+
+	mul_trans_MxN_Nx64_range(arg->dense_rows, arg->A, arg->x, arg->b,
+			(k * n) / arg->num_blocks, ((k + 1) * n) / arg->num_blocks);
+}
+
+void mul_trans_MxN_Nx64(slong dense_rows, slong ncols,
+			la_col_t *A, uint64_t *x, uint64_t *b) {
+
+	/* Multiply the vector x[] by the transpose of the
+	   matrix A and put the result in b[]. Since A is stored
+	   by columns, this is just a matrix-vector product, and
+	   the columns can be processed independently */
+
+	slong nb = lanczos_num_blocks(ncols);
+
+	if (nb == 1) {
+		mul_trans_MxN_Nx64_range(dense_rows, A, x, b, 0, ncols);
+	}
+	else {
+		lanczos_arg_t arg;
+
+		arg.dense_rows = dense_rows;
+		arg.ncols = ncols;
+		arg.A = A;
+		arg.x = x;
+		arg.b = b;
+		arg.num_blocks = nb;
+
+		flint_parallel_do(mul_trans_MxN_Nx64_worker, &arg, nb, nb,
+							FLINT_PARALLEL_UNIFORM);
+	}
+}
+
 /*-----------------------------------------------------------------------*/
 static void transpose_vector(slong ncols, uint64_t *v, uint64_t **trans) {
 
@@ -738,7 +940,8 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 	vnext = (uint64_t *)flint_malloc(vsize * sizeof(uint64_t));
 	x = (uint64_t *)flint_malloc(vsize * sizeof(uint64_t));
 	v0 = (uint64_t *)flint_malloc(vsize * sizeof(uint64_t));
-	scratch = (uint64_t *)flint_malloc(FLINT_MAX(vsize, 256 * 8) * sizeof(uint64_t));
+	scratch = (uint64_t *)flint_malloc(FLINT_MAX(vsize,
+			256 * 8 * lanczos_num_blocks(n)) * sizeof(uint64_t));
 
 	/* allocate all the 64x64 variables */
 
@@ -778,6 +981,11 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 	slong iter = 0;
 #endif
 
+	/* the kernels above all run in one scheduling region,
+	   so the helper threads are only requested once */
+
+	flint_task_begin(lanczos_num_blocks(n));
+
 	/* The computed solution 'x' starts off random,
 	   and v[0] starts off as B*x. This initial copy
 	   of v[0] must be saved off separately */
@@ -910,6 +1118,8 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 		dim1 = dim0;
 	}
 
+	flint_task_end();
+
 #if QS_DEBUG
 	flint_printf("lanczos halted after %wd iterations\n", iter);
 #endif
@@ -14,6 +14,7 @@
 #include "ulong_extras.h"
 #include "fmpz.h"
 #include "qsieve.h"
+#include "thread_support.h"
 
 #ifdef __GNUC__
 # define memset __builtin_memset
@@ -375,16 +376,8 @@ slong qsieve_evaluate_candidate(qs_t qs_inf, ulong i, unsigned char * sieve, qs_
 
          poly->num_factors = num_factors;
 
-#if FLINT_USES_PTHREAD
-         pthread_mutex_lock(&qs_inf->mutex);
-#endif
-	 qsieve_write_to_file(qs_inf, 1, Y, poly);
-
-         qs_inf->full_relation++;
+         qsieve_write_to_buffer(qs_inf, 1, Y, poly);
 
-#if FLINT_USES_PTHREAD
-         pthread_mutex_unlock(&qs_inf->mutex);
-#endif
          relations++;
       } else /* not a relation, perhaps a partial? */
       {
@@ -419,21 +412,8 @@ slong qsieve_evaluate_candidate(qs_t qs_inf, ulong i, unsigned char * sieve, qs_
 
                   poly->num_factors = num_factors;
 
-#if FLINT_USES_PTHREAD
-                  pthread_mutex_lock(&qs_inf->mutex);
-#endif
-                  /* store this partial in file */
-
-                  qsieve_write_to_file(qs_inf, prime, Y, poly);
-
-                  qs_inf->edges++;
-
-                  qsieve_add_to_hashtable(qs_inf, prime);
-
-#if FLINT_USES_PTHREAD
-                  pthread_mutex_unlock(&qs_inf->mutex);
-#endif
-
+                  /* store this partial, it is counted when flushed */
+                  qsieve_write_to_buffer(qs_inf, prime, Y, poly);
               }
           }
       }
@@ -544,13 +524,24 @@ static void qsieve_collect_relations_worker(void * varg)
 }
 
 
+/*
+    Relations are gathered in a buffer per thread, so that the sieving
+    threads only synchronise to fetch the next polynomial. The buffers are
+    written to the relation file, and the large primes of partials added
+    to the hash table, once all threads have finished.
+
+    Helper threads are only held for the duration of the call, so that
+    they are available to the linear algebra in between.
+*/
 slong qsieve_collect_relations(qs_t qs_inf, unsigned char * sieve)
 {
     slong i;
     _worker_arg_struct * args;
     slong relations;
-    const thread_pool_handle* handles = qs_inf->handles;
-    slong num_handles = qs_inf->num_handles;
+    thread_pool_handle * handles;
+    slong num_handles;
+
+    num_handles = flint_request_threads(&handles, qs_inf->num_handles + 1);
 
     args = (_worker_arg_struct *) flint_malloc((1 + num_handles)
                                                   *sizeof(_worker_arg_struct));
@@ -583,6 +574,11 @@ slong qsieve_collect_relations(qs_t qs_inf, unsigned char * sieve)
         relations += args[i].rels;
     }
 
+    flint_give_back_threads(handles, num_handles);
+
+    for (i = 0; i <= num_handles; i++)
+        qsieve_flush_relations(qs_inf, qs_inf->poly + i);
+
     flint_free(args);
 
     return relations;
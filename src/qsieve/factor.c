@@ -204,7 +204,10 @@ void qsieve_factor(fmpz_factor_t factors, const fmpz_t n)
     flint_printf("\nPolynomial Initialisation and Sieving\n");
 #endif
 
-    qs_inf->num_handles = flint_request_threads(&qs_inf->handles, flint_get_num_threads());
+    /* threads are only borrowed while sieving, see qsieve_collect_relations */
+    qs_inf->num_handles = FLINT_MIN(flint_get_num_threads(),
+                                    flint_get_num_available_threads()) - 1;
+    qs_inf->num_handles = FLINT_MAX(qs_inf->num_handles, 0);
 
     /* ensure cache lines don't overlap if num_handles > 0 */
     sieve = flint_malloc((qs_inf->sieve_size + sizeof(ulong)
@@ -481,8 +484,6 @@ cleanup:
     pthread_mutex_destroy(&qs_inf->mutex);
 #endif
 
-    flint_give_back_threads(qs_inf->handles, qs_inf->num_handles);
-
     flint_free(sieve);
     if (qs_inf->siqs != NULL && fclose((FILE *) qs_inf->siqs))
         flint_throw(FLINT_ERROR, "fclose fail\n");
@@ -17,6 +17,7 @@
 #include "qsieve.h"
 
 #ifdef __GNUC__
+# define memcpy __builtin_memcpy
 # define memset __builtin_memset
 #else
 # include <string.h>
@@ -169,6 +170,102 @@ void qsieve_write_to_file(qs_t qs_inf, mp_limb_t prime, const fmpz_t Y, const qs
     }
 }
 
+static void
+_qsieve_buffer_append(qs_poly_t poly, const void * data, slong len)
+{
+    memcpy(poly->rels + poly->rels_len, data, len);
+    poly->rels_len += len;
+}
+
+/*
+    Append a partial or full relation to the buffer of the thread owning
+    poly, using the same layout as qsieve_write_to_file. This needs no lock;
+    the buffers are written to the file by qsieve_flush_relations once the
+    sieving threads have finished.
+*/
+void qsieve_write_to_buffer(qs_t qs_inf, mp_limb_t prime, const fmpz_t Y, qs_poly_t poly)
+{
+    slong num_factors = poly->num_factors;
+    slong Ysz, Ylen;
+    slong write_size;
+    mp_limb_t abslimb;
+    mp_srcptr Yd;
+
+    Ysz = COEFF_IS_MPZ(*Y) ? COEFF_TO_PTR(*Y)->_mp_size : FLINT_SGN(*Y);
+
+    if (COEFF_IS_MPZ(*Y))
+    {
+        Yd = COEFF_TO_PTR(*Y)->_mp_d;
+        Ylen = FLINT_ABS(Ysz);
+    }
+    else
+    {
+        abslimb = FLINT_ABS(*Y);
+        Yd = &abslimb;
+        Ylen = 1;
+    }
+
+    write_size =
+        sizeof(slong)                           /* total write size */
+        + sizeof(mp_limb_t)                     /* large prime */
+        + sizeof(slong)                         /* number of small primes */
+        + sizeof(slong) * qs_inf->small_primes  /* small primes */
+        + sizeof(slong)                         /* number of factors */
+        + sizeof(fac_t) * num_factors           /* factors */
+        + sizeof(slong)                         /* Y->_mp_size */
+        + sizeof(mp_limb_t) * Ylen;             /* Y->_mp_d */
+
+    if (poly->rels_len + write_size > poly->rels_alloc)
+    {
+        poly->rels_alloc = FLINT_MAX(2 * poly->rels_alloc,
+                                     poly->rels_len + write_size);
+        poly->rels = flint_realloc(poly->rels, poly->rels_alloc);
+    }
+
+    _qsieve_buffer_append(poly, &write_size, sizeof(slong));
+    _qsieve_buffer_append(poly, &prime, sizeof(mp_limb_t));
+    _qsieve_buffer_append(poly, &qs_inf->small_primes, sizeof(slong));
+    _qsieve_buffer_append(poly, poly->small, sizeof(slong) * qs_inf->small_primes);
+    _qsieve_buffer_append(poly, &num_factors, sizeof(slong));
+    _qsieve_buffer_append(poly, poly->factor, sizeof(fac_t) * num_factors);
+    _qsieve_buffer_append(poly, &Ysz, sizeof(slong));
+    _qsieve_buffer_append(poly, Yd, sizeof(mp_limb_t) * Ylen);
+}
+
+/*
+    Write the relations buffered for poly to the relation file, counting
+    full relations and adding the large primes of partials to the hash
+    table, then empty the buffer. Must not be called concurrently.
+*/
+void qsieve_flush_relations(qs_t qs_inf, qs_poly_t poly)
+{
+    slong pos, write_size;
+    mp_limb_t prime;
+
+    if (poly->rels_len == 0)
+        return;
+
+    fwrite(poly->rels, 1, poly->rels_len, (FILE *) qs_inf->siqs);
+
+    for (pos = 0; pos < poly->rels_len; pos += write_size)
+    {
+        memcpy(&write_size, poly->rels + pos, sizeof(slong));
+        memcpy(&prime, poly->rels + pos + sizeof(slong), sizeof(mp_limb_t));
+
+        if (prime == 1)
+        {
+            qs_inf->full_relation++;
+        }
+        else
+        {
+            qs_inf->edges++;
+            qsieve_add_to_hashtable(qs_inf, prime);
+        }
+    }
+
+    poly->rels_len = 0;
+}
+
 /******************************************************************************
  *
  *  Hash table
@@ -49,6 +49,9 @@ mp_limb_t qsieve_poly_init(qs_t qs_inf)
       qs_inf->poly[i].soln2 = flint_malloc((num_primes + 16)*sizeof(mp_limb_t));
       qs_inf->poly[i].small = flint_malloc(qs_inf->small_primes*sizeof(mp_limb_t));
       qs_inf->poly[i].factor = flint_malloc(qs_inf->max_factors*sizeof(fac_t));
+      qs_inf->poly[i].rels = NULL;
+      qs_inf->poly[i].rels_len = 0;
+      qs_inf->poly[i].rels_alloc = 0;
    }
 
    A_inv2B = qs_inf->A_inv2B;
@@ -28,6 +28,30 @@ void flint_give_back_threads(thread_pool_handle * handles, slong num_handles);
 
 slong flint_get_num_available_threads(void);
 
+/* work-stealing tasks *******************************************************/
+
+typedef struct
+{
+    void (* fxn)(void *);
+    void * arg;
+    int done;
+}
+flint_task_struct;
+
+typedef flint_task_struct flint_task_t[1];
+
+void flint_task_init(flint_task_t task, void (* fxn)(void *), void * arg);
+
+void flint_task_spawn(flint_task_t task);
+
+void flint_task_join(flint_task_t task);
+
+slong flint_task_begin(int thread_limit);
+
+void flint_task_end(void);
+
+/* parallel loops ************************************************************/
+
 #define FLINT_PARALLEL_UNIFORM 1
 #define FLINT_PARALLEL_STRIDED 2
 #define FLINT_PARALLEL_DYNAMIC 4
@@ -0,0 +1,403 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "thread_pool.h"
+#include "thread_support.h"
+
+/*
+    Work-stealing scheduler.
+
+    The first thread which spawns a task (or calls flint_task_begin) while
+    not already inside a scheduling region becomes the root of a new region.
+    It borrows threads from the global thread pool and wakes them in a
+    stealing loop. Each participating thread owns a deque of spawned tasks:
+    the owner pushes and pops at the bottom, idle threads steal from the
+    top. A thread waiting in flint_task_join keeps executing other tasks
+    until the one it waits for has completed, so that parallel kernels
+    called from inside a task spawn work which the idle threads of the
+    region can pick up, instead of finding the thread pool drained.
+
+    The region ends, and the threads are given back to the pool, when the
+    root has joined everything it spawned and left every flint_task_begin.
+*/
+
+#define FLINT_TASK_THREADED (FLINT_USES_PTHREAD && FLINT_USES_TLS)
+
+void
+flint_task_init(flint_task_t task, void (* fxn)(void *), void * arg)
+{
+    task->fxn = fxn;
+    task->arg = arg;
+    task->done = 0;
+}
+
+#if FLINT_TASK_THREADED
+
+typedef struct _task_sched_struct task_sched_struct;
+
+typedef struct
+{
+    pthread_mutex_t mutex;
+    flint_task_struct ** tasks;
+    volatile slong top;         /* next task to be stolen */
+    volatile slong bottom;      /* one past the most recently pushed task */
+    slong alloc;
+    slong idx;                  /* 0 for the root of the region */
+    task_sched_struct * sched;
+}
+task_deque_struct;
+
+struct _task_sched_struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    task_deque_struct * deques;
+    slong num_workers;
+    thread_pool_handle * handles;
+    slong num_handles;
+    slong root_refs;
+    volatile slong sleeping;
+    volatile int stop;
+};
+
+static FLINT_TLS_PREFIX task_deque_struct * _flint_task_current = NULL;
+
+static void
+_task_deque_push(task_deque_struct * Q, flint_task_struct * task)
+{
+    pthread_mutex_lock(&Q->mutex);
+
+    if (Q->bottom >= Q->alloc)
+    {
+        if (Q->top > 0)
+        {
+            memmove(Q->tasks, Q->tasks + Q->top,
+                          (Q->bottom - Q->top) * sizeof(flint_task_struct *));
+            Q->bottom -= Q->top;
+            Q->top = 0;
+        }
+
+        if (Q->bottom >= Q->alloc)
+        {
+            Q->alloc = FLINT_MAX(WORD(16), 2 * Q->alloc);
+            Q->tasks = (flint_task_struct **) flint_realloc(Q->tasks,
+                                      Q->alloc * sizeof(flint_task_struct *));
+        }
+    }
+
+    Q->tasks[Q->bottom] = task;
+    Q->bottom++;
+
+    pthread_mutex_unlock(&Q->mutex);
+}
+
+/* owner end: most recently spawned task first */
+static flint_task_struct *
+_task_deque_pop(task_deque_struct * Q)
+{
+    flint_task_struct * task = NULL;
+
+    pthread_mutex_lock(&Q->mutex);
+
+    if (Q->bottom > Q->top)
+    {
+        Q->bottom--;
+        task = Q->tasks[Q->bottom];
+        if (Q->bottom == Q->top)
+            Q->top = Q->bottom = 0;
+    }
+
+    pthread_mutex_unlock(&Q->mutex);
+
+    return task;
+}
+
+/* thief end: oldest (and usually largest) task first */
+static flint_task_struct *
+_task_deque_steal(task_deque_struct * Q)
+{
+    flint_task_struct * task = NULL;
+
+    pthread_mutex_lock(&Q->mutex);
+
+    if (Q->bottom > Q->top)
+    {
+        task = Q->tasks[Q->top];
+        Q->top++;
+        if (Q->bottom == Q->top)
+            Q->top = Q->bottom = 0;
+    }
+
+    pthread_mutex_unlock(&Q->mutex);
+
+    return task;
+}
+
+/*
+    Look for something to run: first our own deque, then the others.
+    If careful is zero, deques which look empty are skipped without locking
+    them; a sleeping thread must call this with careful set before waiting.
+*/
+static flint_task_struct *
+_task_find(task_deque_struct * Q, int careful)
+{
+    task_sched_struct * S = Q->sched;
+    flint_task_struct * task;
+    slong k, n = S->num_workers;
+
+    task = _task_deque_pop(Q);
+
+    for (k = 1; task == NULL && k < n; k++)
+    {
+        task_deque_struct * V = S->deques + (Q->idx + k) % n;
+
+        if (careful || V->bottom != V->top)
+            task = _task_deque_steal(V);
+    }
+
+    return task;
+}
+
+/* task->done is only accessed under S->mutex once the task is spawned, so
+   a joiner which sees it set also sees everything the task wrote */
+static int
+_task_done(task_sched_struct * S, flint_task_struct * task)
+{
+    int done;
+
+    pthread_mutex_lock(&S->mutex);
+    done = task->done;
+    pthread_mutex_unlock(&S->mutex);
+
+    return done;
+}
+
+static void
+_task_run(task_sched_struct * S, flint_task_struct * task)
+{
+    task->fxn(task->arg);
+
+    pthread_mutex_lock(&S->mutex);
+    task->done = 1;
+    if (S->sleeping > 0)
+        pthread_cond_broadcast(&S->cond);
+    pthread_mutex_unlock(&S->mutex);
+}
+
+static void
+_task_helper(void * varg)
+{
+    task_deque_struct * Q = (task_deque_struct *) varg;
+    task_sched_struct * S = Q->sched;
+    flint_task_struct * task;
+
+    _flint_task_current = Q;
+
+    while (1)
+    {
+        task = _task_find(Q, 0);
+
+        if (task == NULL)
+        {
+            pthread_mutex_lock(&S->mutex);
+            S->sleeping++;
+            while (!S->stop && (task = _task_find(Q, 1)) == NULL)
+                pthread_cond_wait(&S->cond, &S->mutex);
+            S->sleeping--;
+            pthread_mutex_unlock(&S->mutex);
+
+            if (task == NULL)
+                break;
+        }
+
+        _task_run(S, task);
+    }
+
+    _flint_task_current = NULL;
+}
+
+slong
+flint_task_begin(int thread_limit)
+{
+    task_deque_struct * Q = _flint_task_current;
+    task_sched_struct * S;
+    slong i, max_workers;
+
+    if (Q != NULL)
+    {
+        if (Q->idx == 0)
+            Q->sched->root_refs++;
+
+        return Q->sched->num_workers;
+    }
+
+    if (thread_limit <= 0)
+        thread_limit = flint_get_num_threads();
+
+    S = (task_sched_struct *) flint_malloc(sizeof(task_sched_struct));
+
+    S->num_handles = flint_request_threads(&S->handles, thread_limit);
+    S->num_workers = S->num_handles + 1;
+    S->root_refs = 1;
+    S->sleeping = 0;
+    S->stop = 0;
+    pthread_mutex_init(&S->mutex, NULL);
+    pthread_cond_init(&S->cond, NULL);
+
+    S->deques = (task_deque_struct *) flint_malloc(
+                                    S->num_workers * sizeof(task_deque_struct));
+
+    for (i = 0; i < S->num_workers; i++)
+    {
+        pthread_mutex_init(&S->deques[i].mutex, NULL);
+        S->deques[i].tasks = NULL;
+        S->deques[i].top = 0;
+        S->deques[i].bottom = 0;
+        S->deques[i].alloc = 0;
+        S->deques[i].idx = i;
+        S->deques[i].sched = S;
+    }
+
+    _flint_task_current = S->deques;
+
+    /* helpers see the size of the region as their thread count */
+    max_workers = S->num_workers - 1;
+
+    for (i = 0; i < S->num_handles; i++)
+        thread_pool_wake(global_thread_pool, S->handles[i], max_workers,
+                                                 _task_helper, S->deques + i + 1);
+
+    return S->num_workers;
+}
+
+void
+flint_task_end(void)
+{
+    task_deque_struct * Q = _flint_task_current;
+    task_sched_struct * S;
+    slong i;
+
+    FLINT_ASSERT(Q != NULL);
+
+    if (Q->idx != 0)
+        return;
+
+    S = Q->sched;
+
+    if (--S->root_refs > 0)
+        return;
+
+    pthread_mutex_lock(&S->mutex);
+    S->stop = 1;
+    pthread_cond_broadcast(&S->cond);
+    pthread_mutex_unlock(&S->mutex);
+
+    for (i = 0; i < S->num_handles; i++)
+        thread_pool_wait(global_thread_pool, S->handles[i]);
+
+    flint_give_back_threads(S->handles, S->num_handles);
+
+    for (i = 0; i < S->num_workers; i++)
+    {
+        FLINT_ASSERT(S->deques[i].bottom == S->deques[i].top);
+        flint_free(S->deques[i].tasks);
+        pthread_mutex_destroy(&S->deques[i].mutex);
+    }
+
+    flint_free(S->deques);
+    pthread_cond_destroy(&S->cond);
+    pthread_mutex_destroy(&S->mutex);
+    flint_free(S);
+
+    _flint_task_current = NULL;
+}
+
+void
+flint_task_spawn(flint_task_t task)
+{
+    task_deque_struct * Q;
+    task_sched_struct * S;
+
+    flint_task_begin(0);
+
+    Q = _flint_task_current;
+    S = Q->sched;
+
+    task->done = 0;
+
+    _task_deque_push(Q, task);
+
+    pthread_mutex_lock(&S->mutex);
+    if (S->sleeping > 0)
+        pthread_cond_signal(&S->cond);
+    pthread_mutex_unlock(&S->mutex);
+}
+
+void
+flint_task_join(flint_task_t task)
+{
+    task_deque_struct * Q = _flint_task_current;
+    task_sched_struct * S;
+    flint_task_struct * t;
+
+    FLINT_ASSERT(Q != NULL);
+
+    S = Q->sched;
+
+    while (!_task_done(S, task))
+    {
+        t = _task_find(Q, 0);
+
+        if (t == NULL)
+        {
+            pthread_mutex_lock(&S->mutex);
+            S->sleeping++;
+            while (!task->done && (t = _task_find(Q, 1)) == NULL)
+                pthread_cond_wait(&S->cond, &S->mutex);
+            S->sleeping--;
+            pthread_mutex_unlock(&S->mutex);
+        }
+
+        if (t != NULL)
+            _task_run(S, t);
+    }
+
+    flint_task_end();
+}
+
+#else
+
+slong
+flint_task_begin(int thread_limit)
+{
+    return 1;
+}
+
+void
+flint_task_end(void)
+{
+}
+
+void
+flint_task_spawn(flint_task_t task)
+{
+    task->fxn(task->arg);
+    task->done = 1;
+}
+
+void
+flint_task_join(flint_task_t task)
+{
+    FLINT_ASSERT(task->done);
+}
+
+#endif
@@ -16,13 +16,15 @@
 
 #include "t-parallel_binary_splitting.c"
 #include "t-parallel_do.c"
+#include "t-task.c"
 
 /* Array of test functions ***************************************************/
 
 test_struct tests[] =
 {
     TEST_FUNCTION(thread_support_parallel_binary_splitting),
-    TEST_FUNCTION(thread_support_parallel_do)
+    TEST_FUNCTION(thread_support_parallel_do),
+    TEST_FUNCTION(thread_support_task)
 };
 
 /* main function *************************************************************/
@@ -0,0 +1,157 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "test_helpers.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    slong n;
+    slong res;
+}
+fib_arg_t;
+
+static void
+fib_task(void * varg)
+{
+    fib_arg_t * arg = (fib_arg_t *) varg;
+
+    if (arg->n < 2)
+    {
+        arg->res = arg->n;
+    }
+    else
+    {
+        fib_arg_t a, b;
+        flint_task_t task;
+
+        a.n = arg->n - 1;
+        b.n = arg->n - 2;
+
+        flint_task_init(task, fib_task, &a);
+        flint_task_spawn(task);
+        fib_task(&b);
+        flint_task_join(task);
+
+        arg->res = a.res + b.res;
+    }
+}
+
+typedef struct
+{
+    slong * res;
+    slong n;
+    int flags;
+}
+row_arg_t;
+
+static void
+inner_f(slong j, void * varg)
+{
+    slong * row = (slong *) varg;
+
+    row[j] = j + 1;
+}
+
+/* a parallel loop nested inside another parallel loop */
+static void
+outer_f(slong i, void * varg)
+{
+    row_arg_t * arg = (row_arg_t *) varg;
+
+    flint_parallel_do(inner_f, arg->res + i * arg->n, arg->n, 0, arg->flags);
+}
+
+TEST_FUNCTION_START(thread_support_task, state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        fib_arg_t arg;
+        slong i, fib[20];
+
+        flint_set_num_threads(n_randint(state, 10) + 1);
+
+        fib[0] = 0;
+        fib[1] = 1;
+        for (i = 2; i < 20; i++)
+            fib[i] = fib[i - 1] + fib[i - 2];
+
+        arg.n = n_randint(state, 20);
+        fib_task(&arg);
+
+        if (arg.res != fib[arg.n])
+        {
+            flint_printf("FAIL (fib)\n");
+            flint_printf("num_threads = %wd, n = %wd, res = %wd\n",
+                flint_get_num_threads(), arg.n, arg.res);
+            flint_abort();
+        }
+
+        if (flint_get_num_available_threads() != flint_get_num_threads())
+        {
+            flint_printf("FAIL (threads not given back)\n");
+            flint_abort();
+        }
+    }
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        row_arg_t arg;
+        slong i, j, m, n, begun;
+        int flags[3] = {FLINT_PARALLEL_UNIFORM, FLINT_PARALLEL_STRIDED,
+                                                    FLINT_PARALLEL_DYNAMIC};
+
+        flint_set_num_threads(n_randint(state, 10) + 1);
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+
+        arg.res = flint_calloc(m * n + 1, sizeof(slong));
+        arg.n = n;
+        arg.flags = flags[n_randint(state, 3)];
+
+        /* optionally run inside an explicit region */
+        begun = n_randint(state, 2);
+        if (begun)
+            flint_task_begin(0);
+
+        flint_parallel_do(outer_f, &arg, m, 0, flags[n_randint(state, 3)]);
+
+        if (begun)
+            flint_task_end();
+
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                if (arg.res[i * n + j] != j + 1)
+                {
+                    flint_printf("FAIL (nested parallel_do)\n");
+                    flint_printf("num_threads = %wd, i = %wd, j = %wd\n",
+                        flint_get_num_threads(), i, j);
+                    flint_abort();
+                }
+            }
+        }
+
+        if (flint_get_num_available_threads() != flint_get_num_threads())
+        {
+            flint_printf("FAIL (threads not given back)\n");
+            flint_abort();
+        }
+
+        flint_free(arg.res);
+    }
+
+    TEST_FUNCTION_END(state);
+}
@@ -145,6 +145,34 @@ worker(void * _work)
         work.f(i, work.args);
 }
 
+/* split [a, b) in halves until single indices remain; idle threads
+   steal the pending right halves */
+static void
+dynamic_worker(void * _work)
+{
+    work_chunk_t * work = (work_chunk_t *) _work;
+
+    if (work->b - work->a == 1)
+    {
+        work->f(work->a, work->args);
+    }
+    else if (work->b - work->a > 1)
+    {
+        work_chunk_t left, right;
+        flint_task_t task;
+        slong m = work->a + (work->b - work->a) / 2;
+
+        left = right = *work;
+        left.b = m;
+        right.a = m;
+
+        flint_task_init(task, dynamic_worker, &right);
+        flint_task_spawn(task);
+        dynamic_worker(&left);
+        flint_task_join(task);
+    }
+}
+
 void flint_parallel_do(do_func_t f, void * args, slong n, int thread_limit, int flags)
 {
     slong i;
@@ -161,30 +189,44 @@ void flint_parallel_do(do_func_t f, void * args, slong n, int thread_limit, int
     }
     else
     {
-        slong i, num_threads, num_workers;
-        thread_pool_handle * handles;
+        slong num_threads;
 
-        num_workers = flint_request_threads(&handles, thread_limit);
-        num_threads = num_workers + 1;
+        /* Inside a task this joins the running scheduler, so the chunks
+           below can be picked up by idle threads of an enclosing parallel
+           call. Otherwise it borrows threads from the pool. */
+        num_threads = flint_task_begin(thread_limit);
+        num_threads = FLINT_MIN(num_threads, thread_limit);
 
         if (flags & FLINT_PARALLEL_VERBOSE)
             flint_printf("parallel_do with num_threads = %wd\n", num_threads);
 
-        if (num_workers < 1)
+        if (num_threads <= 1)
         {
-            flint_give_back_threads(handles, num_workers);
-
             for (i = 0; i < n; i++)
                 f(i, args);
         }
+        else if (flags & FLINT_PARALLEL_DYNAMIC)
+        {
+            work_chunk_t work;
+
+            work.f = f;
+            work.args = args;
+            work.a = 0;
+            work.b = n;
+            work.step = 1;
+
+            dynamic_worker(&work);
+        }
         else
         {
             work_chunk_t * work;
+            flint_task_struct * tasks;
             slong chunk_size;
             TMP_INIT;
             TMP_START;
 
             work = TMP_ALLOC(num_threads * sizeof(work_chunk_t));
+            tasks = TMP_ALLOC(num_threads * sizeof(flint_task_struct));
 
             if (flags & FLINT_PARALLEL_STRIDED)
             {
@@ -219,17 +261,21 @@ void flint_parallel_do(do_func_t f, void * args, slong n, int thread_limit, int
                 }
             }
 
-            for (i = 0; i < num_workers; i++)
-                thread_pool_wake(global_thread_pool, handles[i], 0, worker, &work[i]);
+            for (i = 1; i < num_threads; i++)
+            {
+                flint_task_init(tasks + i, worker, work + i);
+                flint_task_spawn(tasks + i);
+            }
 
-            worker(&work[num_workers]);
+            worker(&work[0]);
 
-            for (i = 0; i < num_workers; i++)
-                thread_pool_wait(global_thread_pool, handles[i]);
+            for (i = num_threads - 1; i >= 1; i--)
+                flint_task_join(tasks + i);
 
-            flint_give_back_threads(handles, num_workers);
             TMP_END;
         }
+
+        flint_task_end();
     }
 }
 
@@ -272,10 +318,7 @@ flint_parallel_binary_splitting(void * res, bsplit_basecase_func_t basecase, bsp
     {
         void * left, * right;
         slong m = a + (b - a) / 2;
-        slong nw;
-        slong nw_save;
         slong nt;
-        thread_pool_handle * threads;
         TMP_INIT;
 
         TMP_START;
@@ -299,10 +342,9 @@ flint_parallel_binary_splitting(void * res, bsplit_basecase_func_t basecase, bsp
         if (thread_limit <= 0)
             thread_limit = flint_get_num_threads();
 
-        nt = thread_limit;
-        nw = flint_request_threads(&threads, FLINT_MIN(nt, 2)); /* request one extra worker */
+        nt = (thread_limit >= 2) ? flint_task_begin(thread_limit) : 1;
 
-        if (nw == 0)
+        if (nt <= 1)
         {
             flint_parallel_binary_splitting(left, basecase, merge, sizeof_res, init, clear, args, a, m, basecase_cutoff, thread_limit, flags);
             flint_parallel_binary_splitting(right, basecase, merge, sizeof_res, init, clear, args, m, b, basecase_cutoff, thread_limit, flags);
@@ -310,10 +352,7 @@ flint_parallel_binary_splitting(void * res, bsplit_basecase_func_t basecase, bsp
         else
         {
             flint_parallel_binary_splitting_t right_args;
-
-            FLINT_ASSERT(nt >= 2);
-
-            nw_save = flint_set_num_workers(nt - nt / 2 - 1);
+            flint_task_t task;
 
             right_args.res = right;
             right_args.basecase = basecase;
@@ -328,15 +367,16 @@ flint_parallel_binary_splitting(void * res, bsplit_basecase_func_t basecase, bsp
             right_args.thread_limit = thread_limit;
             right_args.flags = flags;
 
-            thread_pool_wake(global_thread_pool, threads[0], nt / 2 - 1, _bsplit_worker, &right_args);
+            flint_task_init(task, _bsplit_worker, &right_args);
+            flint_task_spawn(task);
 
             flint_parallel_binary_splitting(left, basecase, merge, sizeof_res, init, clear, args, a, m, basecase_cutoff, thread_limit, flags);
 
-            flint_reset_num_workers(nw_save);
-            thread_pool_wait(global_thread_pool, threads[0]);
+            flint_task_join(task);
         }
 
-        flint_give_back_threads(threads, nw);
+        if (thread_limit >= 2)
+            flint_task_end();
 
         merge(res, left, right, args);
 